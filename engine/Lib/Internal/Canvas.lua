@@ -145,6 +145,8 @@ function obe.Canvas.__set(tbl, key, value)
             error("Can't find obe.Canvas.Canvas attribute : " .. tostring(key));
         end
     end
+    -- Attributes are modified directly on the internal element
+    k.__ref:markDirty();
 end
 
 function obe.Canvas.__get(tbl, key)
@@ -602,6 +604,12 @@ obe.Canvas.Bases.Bezier = {
         },
         precision = function(self)
             return self.precision;
+        end,
+        adaptive = function(self)
+            return self.adaptive;
+        end,
+        flatness = function(self)
+            return self.flatness;
         end
     },
     setters = {
@@ -616,6 +624,12 @@ obe.Canvas.Bases.Bezier = {
         end,
         precision = function(self, precision)
             self.precision = precision;
+        end,
+        adaptive = function(self, adaptive)
+            self.adaptive = adaptive;
+        end,
+        flatness = function(self, flatness)
+            self.flatness = flatness;
         end
     }
 }
@@ -28,6 +28,7 @@ namespace sfe
         sf::FloatRect getLocalBounds() const;
         sf::FloatRect getGlobalBounds() const;
         void setVertices(std::array<sf::Vertex, 4>& vertices);
+        const sf::Vertex* getVertices() const; ///< Triangle strip of the 4 corners
 
     private:
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
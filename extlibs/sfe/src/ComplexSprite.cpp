@@ -108,6 +108,11 @@ namespace sfe
         m_vertices[3].position = vertices[3].position;
     }
 
+    const sf::Vertex* ComplexSprite::getVertices() const
+    {
+        return m_vertices;
+    }
+
     void ComplexSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_texture)
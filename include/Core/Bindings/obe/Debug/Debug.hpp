@@ -14,4 +14,5 @@ namespace obe::Debug::Bindings
     void LoadFunctionError(sol::state_view state);
     void LoadFunctionCritical(sol::state_view state);
     void LoadGlobalLog(sol::state_view state);
+    void LoadClassProfiler(sol::state_view state);
 };
\ No newline at end of file
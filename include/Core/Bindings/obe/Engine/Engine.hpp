@@ -9,4 +9,5 @@ namespace obe::Engine::Bindings
     void LoadClassEngine(sol::state_view state);
     void LoadClassResourceManagedObject(sol::state_view state);
     void LoadClassResourceManager(sol::state_view state);
+    void LoadClassTextureCacheStats(sol::state_view state);
 };
\ No newline at end of file
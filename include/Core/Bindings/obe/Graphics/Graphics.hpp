@@ -8,14 +8,20 @@ namespace obe::Graphics::Bindings
 {
     void LoadClassColor(sol::state_view state);
     void LoadClassFont(sol::state_view state);
+    void LoadClassParticleEmitter(sol::state_view state);
+    void LoadClassParticleEmitterSettings(sol::state_view state);
     void LoadClassPositionTransformer(sol::state_view state);
+    void LoadClassRenderStats(sol::state_view state);
     void LoadClassRenderTarget(sol::state_view state);
+    void LoadClassRenderable(sol::state_view state);
     void LoadClassRichText(sol::state_view state);
     void LoadClassShader(sol::state_view state);
+    void LoadClassSoftwareRenderTarget(sol::state_view state);
     void LoadClassSprite(sol::state_view state);
     void LoadClassSpriteHandlePoint(sol::state_view state);
     void LoadClassText(sol::state_view state);
     void LoadClassTexture(sol::state_view state);
+    void LoadClassTileLayer(sol::state_view state);
     void LoadEnumSpriteHandlePointType(sol::state_view state);
     void LoadFunctionInitPositionTransformer(sol::state_view state);
     void LoadFunctionMakeNullTexture(sol::state_view state);
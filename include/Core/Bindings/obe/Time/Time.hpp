@@ -9,7 +9,10 @@ namespace obe::Time::Bindings
     void LoadClassChronometer(sol::state_view state);
     void LoadClassFramerateCounter(sol::state_view state);
     void LoadClassFramerateManager(sol::state_view state);
+    void LoadClassFrameTimeHistogram(sol::state_view state);
     void LoadFunctionEpoch(sol::state_view state);
+    void LoadFunctionNow(sol::state_view state);
+    void LoadFunctionPreciseNow(sol::state_view state);
     void LoadGlobalSeconds(sol::state_view state);
     void LoadGlobalMilliseconds(sol::state_view state);
     void LoadGlobalMicroseconds(sol::state_view state);
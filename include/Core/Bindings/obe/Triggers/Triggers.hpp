@@ -6,10 +6,16 @@ namespace sol
 };
 namespace obe::Triggers::Bindings
 {
+    void LoadClassCallbackHandle(sol::state_view state);
     void LoadClassCallbackScheduler(sol::state_view state);
     void LoadClassTrigger(sol::state_view state);
+    void LoadClassTriggerCallbackStats(sol::state_view state);
     void LoadClassTriggerEnv(sol::state_view state);
     void LoadClassTriggerGroup(sol::state_view state);
     void LoadClassTriggerManager(sol::state_view state);
+    void LoadClassTriggerQueue(sol::state_view state);
+    void LoadClassTriggerQueueStats(sol::state_view state);
+    void LoadClassTriggerStatistics(sol::state_view state);
     void LoadEnumCallbackSchedulerState(sol::state_view state);
+    void LoadEnumTriggerDispatchMode(sol::state_view state);
 };
\ No newline at end of file
@@ -8,6 +8,8 @@ namespace obe::Utils::Math::Bindings
 {
     void LoadFunctionRandint(sol::state_view state);
     void LoadFunctionRandfloat(sol::state_view state);
+    void LoadFunctionSetSeed(sol::state_view state);
+    void LoadFunctionGetSeed(sol::state_view state);
     void LoadFunctionGetMin(sol::state_view state);
     void LoadFunctionGetMax(sol::state_view state);
     void LoadFunctionIsBetween(sol::state_view state);
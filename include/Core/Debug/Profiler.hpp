@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace obe::Debug
+{
+    /**
+     * \brief Records named time intervals (zones) of every thread and exports
+     *        them as a Chrome trace (chrome://tracing, Perfetto)
+     * \note Each thread records its zones in its own fixed size ring buffer, the
+     *       oldest zones are overwritten when it is full. Defining
+     *       OBE_PROFILER_DISABLED (CMake option OBE_ENABLE_PROFILER) removes all
+     *       zones of the engine at compile time
+     */
+    class Profiler
+    {
+    private:
+        static std::atomic<bool> Enabled;
+        static std::atomic<std::uint64_t> Frame;
+
+    public:
+        /**
+         * \brief Starts or stops recording zones
+         */
+        static void SetEnabled(bool enabled);
+        static bool IsEnabled();
+        /**
+         * \brief Sets the amount of zones kept for each thread, recorded zones
+         *        are discarded
+         */
+        static void SetCapacity(std::size_t capacity);
+        /**
+         * \brief Starts a new frame, zones are tagged with the frame they
+         *        started in
+         */
+        static void BeginFrame();
+        static std::uint64_t GetFrame();
+        /**
+         * \brief Sets the name of the calling thread in exported traces
+         */
+        static void SetThreadName(const std::string& name);
+        /**
+         * \nobind
+         * \brief Get a copy of a zone name that lives as long as the program
+         */
+        static const char* Intern(std::string_view name);
+        /**
+         * \brief Opens a zone on the calling thread, zones have to be closed in
+         *        the reverse order they were opened
+         */
+        static void BeginZone(const std::string& name);
+        /**
+         * \brief Closes the last zone opened with BeginZone on the calling thread
+         */
+        static void EndZone();
+        /**
+         * \nobind
+         * \brief Records a zone that already ended
+         */
+        static void Record(const char* name, std::uint64_t start, std::uint64_t end,
+            std::uint64_t frame, unsigned int depth);
+        /**
+         * \nobind
+         * \brief Get the current time of the profiler clock (in nanoseconds)
+         */
+        static std::uint64_t Now();
+        /**
+         * \brief Removes all recorded zones
+         */
+        static void Clear();
+        /**
+         * \brief Writes the zones started between two frames as Chrome trace
+         *        JSON
+         * \param path Path of the file to write
+         * \param firstFrame First frame to export
+         * \param lastFrame Last frame to export (included)
+         * \return Amount of exported zones
+         */
+        static std::size_t ExportChromeTrace(
+            const std::string& path, std::uint64_t firstFrame, std::uint64_t lastFrame);
+    };
+
+    /**
+     * \nobind
+     * \brief Records a zone lasting from its construction to its destruction
+     */
+    class ProfilerZone
+    {
+    private:
+        const char* m_name;
+        std::uint64_t m_start = 0;
+        std::uint64_t m_frame = 0;
+        unsigned int m_depth = 0;
+        bool m_active;
+
+    public:
+        /**
+         * \param name Name of the zone, it has to outlive the profiler (string
+         *        literal or string returned by Profiler::Intern)
+         */
+        explicit ProfilerZone(const char* name);
+        ~ProfilerZone();
+        ProfilerZone(const ProfilerZone&) = delete;
+        ProfilerZone& operator=(const ProfilerZone&) = delete;
+    };
+} // namespace obe::Debug
+
+#if defined(OBE_PROFILER_DISABLED)
+#define OBE_PROFILE_ZONE(name)
+#else
+#define OBE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OBE_PROFILE_CONCAT(a, b) OBE_PROFILE_CONCAT_IMPL(a, b)
+/**
+ * \brief Profiles the rest of the enclosing scope as a zone named name
+ */
+#define OBE_PROFILE_ZONE(name)                                                           \
+    const ::obe::Debug::ProfilerZone OBE_PROFILE_CONCAT(obeProfilerZone, __LINE__)(name)
+#endif
@@ -3,8 +3,10 @@
 #include <Audio/AudioManager.hpp>
 #include <Config/Config.hpp>
 #include <Engine/ResourceManager.hpp>
+#include <Graphics/RenderStats.hpp>
 #include <Input/InputManager.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/GarbageCollector.hpp>
 #include <System/Cursor.hpp>
 #include <System/Plugin.hpp>
 #include <System/Window.hpp>
@@ -25,6 +27,7 @@ namespace obe::Engine
         bool m_initialized = false;
         std::vector<std::unique_ptr<System::Plugin>> m_plugins;
         std::unique_ptr<sol::state> m_lua;
+        std::unique_ptr<Script::GarbageCollector> m_gc;
         std::unique_ptr<Scene::Scene> m_scene;
         std::unique_ptr<System::Cursor> m_cursor;
         std::unique_ptr<System::Window> m_window;
@@ -39,6 +42,24 @@ namespace obe::Engine
 
         // TriggerGroups
         Triggers::TriggerGroupPtr t_game {};
+        Triggers::TriggerHandle m_updateTrigger;
+        Triggers::TriggerHandle m_fixedUpdateTrigger;
+        Triggers::TriggerHandle m_renderTrigger;
+        // Amount of Trigger callbacks logged at exit by the TriggerStatistics
+        std::size_t m_triggerStatsDumpCount = 0;
+
+        // Headless mode
+        vili::node m_configOverrides = vili::object {};
+        bool m_headless = false;
+        std::size_t m_headlessFrames = 0;
+        Time::TimeUnit m_headlessTimestep = 0;
+        bool m_running = false;
+
+        // Render statistics
+        double m_renderStatsLogInterval = 0;
+        std::size_t m_renderStatsFrames = 0;
+        Graphics::RenderStats m_renderStatsTotal;
+        std::chrono::steady_clock::time_point m_renderStatsLogStart;
 
         // Initialization
         void initConfig();
@@ -49,14 +70,21 @@ namespace obe::Engine
         void initFramerate();
         void initResources();
         void initWindow();
+        void initGraphics();
         void initCursor();
         void initPlugins();
         void initScene();
+        void initHeadless();
+        void initInputRecording();
 
         // Main loop
+        bool updateFramerate();
+        void handleWindowEvent(const sf::Event& event) const;
         void handleWindowEvents() const;
         void update() const;
         void render();
+        void logRenderStats();
+        void runHeadless();
 
         // Cleaning
         void clean() const;
@@ -66,8 +94,23 @@ namespace obe::Engine
         Engine();
         ~Engine();
 
+        /**
+         * \nobind
+         * \brief Sets configuration values that replace the ones of the
+         *        configuration files (command line arguments), has to be called
+         *        before init
+         */
+        void overrideConfiguration(const vili::node& overrides);
         void init();
         void run();
+        /**
+         * \brief Ends the main loop at the end of the current frame
+         */
+        void stop();
+        /**
+         * \brief Check if the engine runs without window, cursor and rendering
+         */
+        [[nodiscard]] bool isHeadless() const;
 
         /**
          * \bind{Audio}
@@ -108,12 +151,25 @@ namespace obe::Engine
         /**
          * \bind{Cursor}
          * \asproperty
+         * \throw UnavailableInHeadlessMode if the engine runs in headless mode
          */
         System::Cursor& getCursor() const;
         /**
          * \bind{Window}
          * \asproperty
+         * \throw UnavailableInHeadlessMode if the engine runs in headless mode
          */
         System::Window& getWindow() const;
+        /**
+         * \bind{GarbageCollector}
+         * \asproperty
+         */
+        Script::GarbageCollector& getGarbageCollector() const;
+        /**
+         * \brief Get the rendering counters of the last rendered frame
+         * \bind{Stats}
+         * \asproperty
+         */
+        const Graphics::RenderStats& getRenderStats() const;
     };
 }
\ No newline at end of file
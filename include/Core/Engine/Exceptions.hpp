@@ -69,6 +69,32 @@ namespace obe::Engine::Exceptions
         }
     };
 
+    class ShaderLoadingError : public Exception
+    {
+    public:
+        ShaderLoadingError(
+            std::string_view path, std::vector<std::string> mounts, DebugInfo info)
+            : Exception("ShaderLoadingError", info)
+        {
+            this->error("Could not load Shader with path '{}'", path);
+            this->hint("Check that the Shader compiles and can be found in the "
+                       "following paths ({})",
+                fmt::join(mounts, ", "));
+        }
+    };
+
+    class UnavailableInHeadlessMode : public Exception
+    {
+    public:
+        UnavailableInHeadlessMode(std::string_view component, DebugInfo info)
+            : Exception("UnavailableInHeadlessMode", info)
+        {
+            this->error("{} is not available when the engine runs in headless mode",
+                component);
+            this->hint("Check Engine:isHeadless() before using it");
+        }
+    };
+
     class UnitializedEngine : public Exception
     {
     public:
@@ -1,19 +1,57 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <unordered_map>
 
 #include <SFML/Graphics/Font.hpp>
 
 #include <Graphics/Font.hpp>
+#include <Graphics/Shader.hpp>
 #include <Graphics/Texture.hpp>
+#include <Engine/TextureFileCache.hpp>
+#include <Engine/TextureLru.hpp>
+#include <Graphics/TextureAtlas.hpp>
 #include <Triggers/TriggerGroup.hpp>
+#include <Utils/ExecUtils.hpp>
+
+#include <vili/node.hpp>
 
 namespace obe::Engine
 {
     template <class T> using ResourceStore = std::unordered_map<std::string, T>;
     using TexturePair = std::pair<std::unique_ptr<Graphics::Texture>,
         std::unique_ptr<Graphics::Texture>>;
+    using TextureAtlasPair = std::pair<std::unique_ptr<Graphics::TextureAtlas>,
+        std::unique_ptr<Graphics::TextureAtlas>>;
+    /**
+     * \brief Counters of the texture cache of a ResourceManager
+     */
+    struct TextureCacheStats
+    {
+        /**
+         * \brief Amount of texture requests served from the cache
+         */
+        std::size_t hits = 0;
+        /**
+         * \brief Amount of texture requests that required loading the texture
+         */
+        std::size_t misses = 0;
+        /**
+         * \brief Amount of textures evicted to stay within the memory budget
+         */
+        std::size_t evictions = 0;
+        /**
+         * \brief Bytes of GPU memory used by cached textures and atlas pages
+         */
+        std::size_t residentBytes = 0;
+        /**
+         * \brief Bytes of CPU memory used by decoded images waiting for upload
+         */
+        std::size_t pendingBytes = 0;
+    };
+
     /**
      * \brief Class that manages and caches textures}
      */
@@ -22,12 +60,77 @@ namespace obe::Engine
     private:
         Triggers::TriggerGroupPtr t_resources;
         ResourceStore<std::shared_ptr<Graphics::Font>> m_fonts;
+        ResourceStore<std::shared_ptr<Graphics::Shader>> m_shaders;
         ResourceStore<TexturePair> m_textures;
+        TextureAtlasPair m_atlases;
+        bool m_atlasEnabled = false;
+        unsigned int m_atlasPageSize = 2048;
+        unsigned int m_atlasPadding = 1;
+        unsigned int m_atlasMaxImageSize = 256;
+        TextureFileCache m_fileCache;
+
+        struct PendingTexture
+        {
+            std::string path;
+            std::shared_ptr<sf::Texture> texture;
+            bool antiAliasing;
+            std::shared_ptr<bool> loading;
+        };
+        struct DecodedImage
+        {
+            std::size_t request;
+            sf::Image image;
+            bool success;
+        };
+        TextureLru m_textureLru;
+        std::size_t m_gpuMemoryBudget = 0;
+        std::size_t m_cpuMemoryBudget = 0;
+        TextureCacheStats m_textureCacheStats;
+
+        std::unordered_map<std::size_t, PendingTexture> m_pendingTextures;
+        std::size_t m_nextTextureRequest = 0;
+        std::queue<DecodedImage> m_decodedImages;
+        std::size_t m_decodedBytes = 0;
+        mutable std::mutex m_decodedImagesMutex;
+        sf::Image m_placeholderImage;
+        std::size_t m_uploadBudget = 4 * 1024 * 1024;
+        unsigned int m_decodeWorkers = 2;
+        // Declared last so workers are joined before anything they use is destroyed
+        std::unique_ptr<Utils::Exec::ThreadPool> m_decoders;
+
+        std::unique_ptr<Graphics::Texture> packTexture(
+            const sf::Image& image, bool antiAliasing);
+        bool decodeImage(
+            const std::string& path, const std::string& realPath, sf::Image& image) const;
+        std::unique_ptr<Graphics::Texture>& getTextureSlot(
+            const std::string& path, bool antiAliasing);
+        void trackTexture(const std::string& path, bool antiAliasing);
+        void touchTexture(const std::string& path, bool antiAliasing);
+        void releaseTexture(const TextureKey& key);
+        void evictTextures();
+        [[nodiscard]] std::size_t getAtlasBytes() const;
 
     public:
         bool defaultAntiAliasing;
         ResourceManager();
+        /**
+         * \brief Configures the ResourceManager
+         * \param config Configuration of the ResourceManager
+         */
+        void configure(vili::node& config);
         std::shared_ptr<Graphics::Font> getFont(const std::string& path);
+        /**
+         * \brief Get the shader program compiled from the given path and defines.
+         *        Objects requesting the same path and defines share the program
+         * \param path Relative of absolute path to the fragment shader,
+         *        it uses the obe::System::Path loading system
+         * \param defines Macros defined when compiling the shader, either
+         *        "NAME" or "NAME=VALUE" (their order does not matter)
+         * \return A pointer to the shader stored in the cache
+         * \throw ShaderLoadingError if the shader can't be found or compiled
+         */
+        std::shared_ptr<Graphics::Shader> getShader(
+            const std::string& path, const std::vector<std::string>& defines = {});
         /**
          * \brief Get the texture at the given path.
          *        If it's already in cache it returns the cached version.
@@ -39,7 +142,97 @@ namespace obe::Engine
          */
         const Graphics::Texture& getTexture(const std::string& path, bool antiAliasing);
         const Graphics::Texture& getTexture(const std::string& path);
+        /**
+         * \brief Get the texture at the given path without blocking on image decoding.
+         *        When the texture is not in cache, the image is decoded by a worker
+         *        thread and the returned texture displays the placeholder until
+         *        update uploads the real content (textures loaded this way are
+         *        never packed in an atlas)
+         * \param path Relative of absolute path to the texture,
+         *        it uses the obe::System::Path loading system
+         * \param antiAliasing Uses Anti-Aliasing for the texture when first loading it
+         * \return A reference to the texture stored in the cache
+         */
+        const Graphics::Texture& getTextureAsync(
+            const std::string& path, bool antiAliasing);
+        const Graphics::Texture& getTextureAsync(const std::string& path);
+        /**
+         * \brief Sets the texture displayed while asynchronous textures are loading
+         *        (defaults to the NullTexture)
+         * \param texture Texture to copy the placeholder content from
+         */
+        void setPlaceholderTexture(const Graphics::Texture& texture);
+        /**
+         * \brief Sets the maximum amount of texture data uploaded by each update
+         *        (at least one texture is always uploaded)
+         * \param bytes Amount of bytes (4 bytes per pixel)
+         */
+        void setUploadBudget(std::size_t bytes);
+        [[nodiscard]] std::size_t getUploadBudget() const;
+        /**
+         * \brief Get the amount of asynchronous textures not uploaded yet
+         * \return The amount of textures still displaying the placeholder
+         */
+        [[nodiscard]] std::size_t getPendingTextureCount() const;
+        /**
+         * \brief Sets the amount of GPU memory cached textures can use, least
+         *        recently used textures that are no longer referenced are evicted
+         *        when it is exceeded
+         * \param bytes Amount of bytes (0 for no limit)
+         */
+        void setGpuMemoryBudget(std::size_t bytes);
+        [[nodiscard]] std::size_t getGpuMemoryBudget() const;
+        /**
+         * \brief Sets the amount of CPU memory decoded images waiting for upload can
+         *        use, the upload budget is ignored while it is exceeded
+         * \param bytes Amount of bytes (0 for no limit)
+         */
+        void setCpuMemoryBudget(std::size_t bytes);
+        [[nodiscard]] std::size_t getCpuMemoryBudget() const;
+        /**
+         * \brief Get the counters of the texture cache
+         * \return A TextureCacheStats with the current values of the counters
+         */
+        [[nodiscard]] TextureCacheStats getTextureCacheStats() const;
+        /**
+         * \brief Uploads the textures decoded by the worker threads within the
+         *        upload budget then evicts textures exceeding the GPU memory budget
+         *        (called once per frame by the Engine)
+         */
+        void update();
+        /**
+         * \brief Enables the texture atlas mode, images small enough are then packed
+         *        into shared atlas pages when first loaded
+         *        (Textures already in cache are not affected)
+         * \param pageSize Width and height of each atlas page (in pixels)
+         * \param padding Amount of pixels extruded around each packed image
+         * \param maxImageSize Images with a width or height above this size
+         *        get their own Texture
+         */
+        void enableAtlas(unsigned int pageSize = 2048, unsigned int padding = 1,
+            unsigned int maxImageSize = 256);
+        /**
+         * \brief Disables the texture atlas mode for the next loaded textures
+         */
+        void disableAtlas();
+        /**
+         * \brief Check if the texture atlas mode is enabled
+         * \return true if small textures are packed in atlas pages, false otherwise
+         */
+        [[nodiscard]] bool isAtlasEnabled() const;
+        /**
+         * \brief Enables the texture file cache, decoded images are then stored as
+         *        raw pixels next to the mounted paths and loaded from there while
+         *        their source file is unchanged
+         * \param directory Name of the cache directory created in the mounted paths
+         */
+        void enableFileCache(const std::string& directory = ".cache");
+        void disableFileCache();
+        [[nodiscard]] bool isFileCacheEnabled() const;
 
+        /**
+         * \brief Frees all cached textures and shaders that are no longer referenced
+         */
         void clean();
     };
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace obe::Engine
+{
+    /**
+     * \brief Header of the files written by the TextureFileCache,
+     *        followed by width * height RGBA pixels
+     */
+    struct TextureFileCacheHeader
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint64_t sourceSize;
+        /**
+         * \brief Modification time of the source image (in nanoseconds)
+         */
+        std::int64_t sourceModificationTime;
+    };
+
+    /**
+     * \brief Stores decoded images as raw RGBA files so textures can be loaded
+     *        without decoding their source image as long as it does not change.
+     *        Cache files are stored in a directory next to the mounted path the
+     *        source image comes from and are memory-mapped when loaded
+     * \note Loading and storing can be done by worker threads while the cache
+     *       is enabled or disabled
+     */
+    class TextureFileCache
+    {
+    private:
+        bool m_enabled = false;
+        std::string m_directory = ".cache";
+        mutable std::mutex m_mutex;
+
+        /**
+         * \brief Get the cache path of an image, empty if the cache is disabled
+         *        or if the image can't be cached
+         */
+        [[nodiscard]] std::string getCachePath(
+            const std::string& path, const std::string& realPath) const;
+
+    public:
+        /**
+         * \brief Enables the cache
+         * \param directory Name of the cache directory created in the mounted paths
+         */
+        void enable(const std::string& directory = ".cache");
+        void disable();
+        [[nodiscard]] bool isEnabled() const;
+        /**
+         * \brief Uploads the cached pixels of an image directly to a texture
+         * \param path Path of the image relative to the mounted paths
+         * \param realPath Path of the image found using the mounted paths
+         * \param texture Texture to load the pixels into
+         * \return true if an up-to-date cache file was found, false otherwise
+         */
+        bool loadTexture(const std::string& path, const std::string& realPath,
+            sf::Texture& texture) const;
+        /**
+         * \brief Loads the cached pixels of an image
+         * \param path Path of the image relative to the mounted paths
+         * \param realPath Path of the image found using the mounted paths
+         * \param image Image to load the pixels into
+         * \return true if an up-to-date cache file was found, false otherwise
+         */
+        bool loadImage(
+            const std::string& path, const std::string& realPath, sf::Image& image) const;
+        /**
+         * \brief Writes the cache file of a decoded image (can be called from any thread)
+         * \param path Path of the image relative to the mounted paths
+         * \param realPath Path of the image found using the mounted paths
+         * \param image Decoded image
+         * \return true if the cache file has been written, false otherwise
+         */
+        bool store(const std::string& path, const std::string& realPath,
+            const sf::Image& image) const;
+    };
+} // namespace obe::Engine
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace obe::Engine
+{
+    /**
+     * \brief Path and anti-aliasing of a texture of the ResourceManager cache
+     */
+    using TextureKey = std::pair<std::string, bool>;
+
+    /**
+     * \brief Memory used by cached textures in least recently used order,
+     *        used by the ResourceManager to pick the textures to evict
+     */
+    class TextureLru
+    {
+    private:
+        struct TextureUsage
+        {
+            std::size_t bytes;
+            std::list<TextureKey>::iterator lruPosition;
+        };
+        // Most recently used textures first
+        std::list<TextureKey> m_order;
+        std::map<TextureKey, TextureUsage> m_usages;
+        std::size_t m_bytes = 0;
+
+    public:
+        /**
+         * \brief Adds a texture (or updates its size) and marks it as the most
+         *        recently used one
+         */
+        void track(const TextureKey& key, std::size_t bytes);
+        /**
+         * \brief Marks a tracked texture as the most recently used one
+         */
+        void touch(const TextureKey& key);
+        /**
+         * \brief Stops tracking a texture
+         */
+        void release(const TextureKey& key);
+        [[nodiscard]] bool contains(const TextureKey& key) const;
+        /**
+         * \brief Get the amount of bytes used by all tracked textures
+         */
+        [[nodiscard]] std::size_t getBytes() const;
+        /**
+         * \brief Get the tracked textures from the least recently used one
+         */
+        [[nodiscard]] std::vector<TextureKey> getOrder() const;
+        /**
+         * \brief Picks the textures to evict to get within a memory budget,
+         *        least recently used first (tracking is not modified)
+         * \param residentBytes Memory currently used, including memory that is
+         *        not tracked (atlas pages for example)
+         * \param budget Memory budget to get within
+         * \param isEvictable Tells if a texture can be evicted (textures still
+         *        referenced outside of the cache can't)
+         * \return The textures to evict, in eviction order
+         */
+        [[nodiscard]] std::vector<TextureKey> selectEvictions(std::size_t residentBytes,
+            std::size_t budget,
+            const std::function<bool(const TextureKey&)>& isEvictable) const;
+    };
+} // namespace obe::Engine
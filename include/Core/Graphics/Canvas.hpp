@@ -1,14 +1,19 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 #include <sfe/RichText.hpp>
 
 #include <Debug/Logger.hpp>
 #include <Graphics/Exceptions.hpp>
 #include <Graphics/Shapes.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Graphics/Text.hpp>
 #include <Transform/Polygon.hpp>
@@ -35,11 +40,42 @@ namespace obe::Graphics::Canvas
     std::ostream& operator<<(std::ostream& os, CanvasElementType type);
 
     class Canvas;
+    /**
+     * \nobind
+     * \brief Vertices of consecutive CanvasElements sharing the same primitive
+     *        type, drawn with a single draw call
+     */
+    class CanvasBatch
+    {
+    private:
+        RenderTarget m_target;
+        sf::VertexArray m_vertices;
+
+    public:
+        explicit CanvasBatch(RenderTarget target);
+        /**
+         * \brief Get the vertices of the batch for the given primitive type,
+         *        pending vertices of another primitive type are drawn first
+         * \param type Primitive type of the vertices that will be appended
+         * \return A reference to the vertices of the batch
+         */
+        sf::VertexArray& get(sf::PrimitiveType type);
+        /**
+         * \brief Draws the pending vertices
+         */
+        void flush();
+    };
+
     /**
      * \brief A Drawable Canvas Element
      */
     class CanvasElement : public Types::ProtectedIdentifiable
     {
+    private:
+        friend class Canvas;
+        bool m_dirty = true;
+        std::optional<sf::FloatRect> m_renderedBounds;
+
     public:
         static constexpr CanvasElementType Type = CanvasElementType::CanvasElement;
 
@@ -62,8 +98,34 @@ namespace obe::Graphics::Canvas
          * \param target Target where to render the result
          */
         virtual void draw(RenderTarget target) = 0;
+        /**
+         * \nobind
+         * \brief Appends the vertices of the element to a batch instead of drawing it
+         * \param batch Batch of the Canvas being drawn
+         * \return true if the element has been batched, false if it has to be
+         *         drawn on its own
+         */
+        virtual bool batch(CanvasBatch& batch) const;
+        /**
+         * \nobind
+         * \brief Get the area of the Canvas covered by the element
+         * \return The bounding rectangle of the element (in pixels)
+         */
+        [[nodiscard]] virtual sf::FloatRect getBounds() const = 0;
         virtual ~CanvasElement() = default;
 
+        /**
+         * \brief Notifies the Canvas that the element has been modified and
+         *        needs to be drawn again on next render
+         *        (required after modifying the element attributes directly)
+         */
+        void markDirty();
+        /**
+         * \brief Check if the element has been modified since the last render
+         * \return true if the element needs to be drawn again, false otherwise
+         */
+        [[nodiscard]] bool isDirty() const;
+
         /**
          * \brief Change layer or object and will ask the Canvas to reorder
          *        elements automatically
@@ -97,6 +159,8 @@ namespace obe::Graphics::Canvas
          * \param target Target where to draw the Line to
          */
         void draw(RenderTarget target) override;
+        bool batch(CanvasBatch& batch) const override;
+        [[nodiscard]] sf::FloatRect getBounds() const override;
     };
 
     /**
@@ -131,6 +195,8 @@ namespace obe::Graphics::Canvas
          * \param target Target where to draw the Rectangle to
          */
         void draw(RenderTarget target) override;
+        bool batch(CanvasBatch& batch) const override;
+        [[nodiscard]] sf::FloatRect getBounds() const override;
     };
 
     /**
@@ -179,6 +245,7 @@ namespace obe::Graphics::Canvas
          * \param target Target where to draw the Text to
          */
         void draw(RenderTarget target) override;
+        [[nodiscard]] sf::FloatRect getBounds() const override;
         void refresh();
         /**
          * \bind{text}
@@ -208,6 +275,8 @@ namespace obe::Graphics::Canvas
          * \param target Target where to draw the Circle to
          */
         void draw(RenderTarget target) override;
+        bool batch(CanvasBatch& batch) const override;
+        [[nodiscard]] sf::FloatRect getBounds() const override;
     };
 
     /**
@@ -224,6 +293,8 @@ namespace obe::Graphics::Canvas
         explicit Polygon(Canvas& parent, const std::string& id);
 
         void draw(RenderTarget target) override;
+        bool batch(CanvasBatch& batch) const override;
+        [[nodiscard]] sf::FloatRect getBounds() const override;
     };
 
     /**
@@ -231,18 +302,52 @@ namespace obe::Graphics::Canvas
      */
     class Bezier : public CanvasElement
     {
+    private:
+        std::vector<sf::Vector2f> m_cachedPoints;
+        std::vector<Graphics::Color> m_cachedColors;
+        unsigned int m_cachedPrecision = 0;
+        bool m_cachedAdaptive = false;
+        float m_cachedFlatness = 0;
+        std::vector<sf::Vertex> m_vertices;
+        /**
+         * \brief Converts the control points to pixels
+         * \return true if the curve changed since the vertices were computed
+         */
+        bool updateControlPoints();
+        void tessellate();
+        void tessellateAdaptive();
+
     public:
         static constexpr CanvasElementType Type = CanvasElementType::Bezier;
         std::vector<Transform::UnitVector> points;
         std::vector<Graphics::Color> colors;
+        /**
+         * \brief Amount of vertices computed for each cubic curve
+         */
         unsigned int precision = 10;
+        /**
+         * \brief Subdivides each cubic curve until its segments are flat enough
+         *        instead of computing a fixed amount of vertices
+         */
+        bool adaptive = false;
+        /**
+         * \brief Maximum distance (in pixels) between the curve and its segments
+         *        when adaptive is enabled
+         */
+        float flatness = 0.5f;
 
         explicit Bezier(Canvas& parent, const std::string& id);
         /**
-         * \brief Draw the Bezier Curve
+         * \brief Draw the Bezier Curve, vertices are computed again only when
+         *        points, colors, precision or the adaptive settings change
          * \param target Target where to draw the Sprite to
          */
         void draw(RenderTarget target) override;
+        /**
+         * \brief Get the bounding rectangle of the control points
+         *        (the curve always lies inside of it)
+         */
+        [[nodiscard]] sf::FloatRect getBounds() const override;
     };
 
     /**
@@ -253,18 +358,34 @@ namespace obe::Graphics::Canvas
     class Canvas
     {
     private:
-        sf::RenderTexture m_canvas;
+        std::shared_ptr<sf::RenderTexture> m_canvas;
+        // Previous texture of the Canvas, reused once the render thread is done
+        std::shared_ptr<sf::RenderTexture> m_spareCanvas;
+        std::unique_ptr<SoftwareRenderTarget> m_softwareCanvas;
+        sf::Texture m_softwareTexture;
         std::vector<CanvasElement::Ptr> m_elements {};
+        std::unordered_map<std::string, CanvasElement*> m_elementsById;
         bool m_sortRequired = true;
+        bool m_dirty = true;
+        bool m_redrawRequired = true;
+        std::optional<sf::FloatRect> m_removedBounds;
         void sortElements();
+        void redraw(const std::optional<sf::IntRect>& region);
+        void swapCanvasTexture(bool keepContent);
+        [[nodiscard]] RenderTarget getCanvasTarget();
+        [[nodiscard]] const sf::Texture& getCanvasTexture() const;
+
+        friend class CanvasElement;
 
     public:
         /**
-         * \brief Create a new Canvas
+         * \brief Create a new Canvas, it is rasterized on the CPU when the
+         *        software renderer is enabled
          * \param width Width of the Canvas (in pixels)
          * \param height Height of the Canvas (in pixels)
          */
         Canvas(unsigned int width, unsigned int height);
+        ~Canvas();
 
         /**
          * \brief Adds a new CanvasElement of type T to the Canvas
@@ -294,7 +415,12 @@ namespace obe::Graphics::Canvas
         CanvasElement* get(const std::string& id);
 
         /**
-         * \brief Render all the Canvas content to the Sprite target
+         * \brief Render the Canvas content to the Sprite target.
+         *        Only the area covered by modified elements is drawn again,
+         *        the cached texture is used as is when nothing changed.
+         *        Consecutive untextured lines and shapes are batched together
+         * \note With a render thread, the Canvas draws in another texture while
+         *       the previous one may still be used by the frames being rendered
          */
         void render(Sprite& target);
         /**
@@ -315,6 +441,15 @@ namespace obe::Graphics::Canvas
          * \brief Ask the Canvas to sort elements for the next rendering
          */
         void requiresSort();
+        /**
+         * \brief Ask the Canvas to draw all elements again on next render
+         */
+        void markDirty();
+        /**
+         * \brief Check if the Canvas content changed since the last render
+         * \return true if the next render will draw elements, false otherwise
+         */
+        [[nodiscard]] bool isDirty() const;
     };
 
     template <class T> inline T& Canvas::add(const std::string& id)
@@ -342,6 +477,7 @@ namespace obe::Graphics::Canvas
                     return newElement->layer <= elem->layer;
                 });
             auto elem_it = m_elements.insert(insert_it, std::move(newElement));
+            m_elementsById.emplace(id, elem_it->get());
             return *static_cast<T*>(elem_it->get());
         }
     }
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <Graphics/Color.hpp>
+#include <Graphics/Shader.hpp>
+
+namespace sf
+{
+    class Drawable;
+    class RenderTarget;
+}
+
+namespace obe::Graphics
+{
+    /**
+     * \nobind
+     * \brief Records the draw calls of a frame so they can be replayed later
+     *        on another thread, drawables are stored as plain vertices
+     * \note Textures and shaders are referenced, not copied. The resources
+     *       retained with the frame are kept alive until the buffer is reset by
+     *       its owner, uniform values are copied with each draw call
+     */
+    class DrawCommandBuffer
+    {
+    private:
+        enum class CommandType
+        {
+            Clear,
+            SetView,
+            Draw
+        };
+        struct Command
+        {
+            CommandType type;
+            // First vertex of a Draw command or view index of a SetView command
+            std::size_t first = 0;
+            std::size_t count = 0;
+            sf::PrimitiveType primitive = sf::Points;
+            sf::RenderStates states;
+            sf::Color color;
+            // Shader receiving the uniforms at index `uniforms` before drawing
+            Shader* shader = nullptr;
+            std::size_t uniforms = 0;
+        };
+        std::vector<Command> m_commands;
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<sf::View> m_views;
+        std::vector<ShaderUniforms> m_uniforms;
+        std::vector<std::shared_ptr<const void>> m_resources;
+        sf::View m_defaultView;
+        sf::Vector2u m_size;
+
+    public:
+        /**
+         * \brief Removes all recorded commands while keeping the allocated memory,
+         *        retained resources are kept until releaseResources is called
+         * \param size Size of the target the commands will be replayed on
+         * \param view View active at the beginning of the frame
+         * \param defaultView Default view of the target
+         */
+        void reset(sf::Vector2u size, const sf::View& view, const sf::View& defaultView);
+        void clear(const Color& color);
+        void setView(const sf::View& view);
+        [[nodiscard]] const sf::View& getView() const;
+        [[nodiscard]] const sf::View& getDefaultView() const;
+        [[nodiscard]] sf::Vector2u getSize() const;
+        /**
+         * \brief Records a SFML or ObEngine drawable (sprites, shapes, vertex
+         *        arrays and texts), other drawables are ignored with a warning
+         */
+        void draw(const sf::Drawable& drawable,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+        /**
+         * \brief Records a drawable using a shared Shader, the uniforms are
+         *        copied and applied to the Shader right before it is replayed
+         */
+        void draw(
+            const sf::Drawable& drawable, Shader& shader, const ShaderUniforms& uniforms);
+        /**
+         * \brief Keeps a resource used by the recorded commands alive until the
+         *        buffer is done being replayed
+         */
+        void retain(std::shared_ptr<const void> resource);
+        /**
+         * \brief Drops the retained resources, the buffer must not be used by
+         *        the render thread anymore
+         */
+        void releaseResources();
+        /**
+         * \brief Executes all recorded commands on a target
+         */
+        void replay(sf::RenderTarget& target) const;
+        [[nodiscard]] std::size_t getCommandAmount() const;
+        [[nodiscard]] std::size_t getVertexAmount() const;
+    };
+} // namespace obe::Graphics
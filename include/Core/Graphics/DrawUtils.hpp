@@ -1,6 +1,7 @@
 #pragma once
 
 #include <any>
+#include <functional>
 #include <unordered_map>
 
 #include <Graphics/Color.hpp>
@@ -8,6 +9,8 @@
 #include <Transform/UnitVector.hpp>
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/System/Vector2.hpp>
 
 /**
@@ -57,4 +60,30 @@ namespace obe::Graphics::Utils
      */
     void drawPolygon(RenderTarget surface, std::vector<Transform::UnitVector>& points,
         const DrawPolygonOptions& options);
+    /**
+     * \nobind
+     * \brief Converts a convex shape to triangles, the same way SFML draws it
+     * \param shape Shape to convert (its transform is applied to the vertices)
+     * \param fill Triangles of the inside of the shape (with texture coordinates)
+     * \param outline Triangles of the outline of the shape (never textured)
+     */
+    void tessellateShape(
+        const sf::Shape& shape, sf::VertexArray& fill, sf::VertexArray& outline);
+    /**
+     * \nobind
+     * \brief Receives the primitives a drawable is made of
+     */
+    using PrimitiveCallback = std::function<void(const sf::Vertex* vertices,
+        std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)>;
+    /**
+     * \nobind
+     * \brief Splits a SFML or ObEngine drawable (sprites, shapes, vertex arrays
+     *        and texts) into the primitives SFML would draw for it
+     * \param drawable Drawable to split
+     * \param states Render states the drawable is drawn with
+     * \param callback Function called for each primitive
+     * \return false if the type of drawable is not supported
+     */
+    bool decomposeDrawable(const sf::Drawable& drawable, const sf::RenderStates& states,
+        const PrimitiveCallback& callback);
 } // namespace obe::Graphics::Utils
\ No newline at end of file
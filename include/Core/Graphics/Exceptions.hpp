@@ -58,4 +58,40 @@ namespace obe::Graphics::Exceptions
             this->error("Invalid value for 'color' attribute, expected 'object' or 'string' and got '{}' (value: {})", type, value);
         }
     };
+
+    class UnsupportedBySoftwareRenderer : public Exception
+    {
+    public:
+        UnsupportedBySoftwareRenderer(std::string_view operation, DebugInfo info)
+            : Exception("UnsupportedBySoftwareRenderer", info)
+        {
+            this->error("Impossible to {} when using the software renderer", operation);
+            this->hint("Set 'renderer' to \"opengl\" in the Window configuration");
+        }
+    };
+
+    class UnsupportedByRenderThread : public Exception
+    {
+    public:
+        UnsupportedByRenderThread(std::string_view operation, DebugInfo info)
+            : Exception("UnsupportedByRenderThread", info)
+        {
+            this->error("Impossible to {} when the render thread is enabled", operation);
+            this->hint("Set 'renderThread' to false in the Window configuration");
+        }
+    };
+
+    class InvalidTileAmount : public Exception
+    {
+    public:
+        InvalidTileAmount(std::string_view layerId, std::size_t width, std::size_t height,
+            std::size_t tileAmount, DebugInfo info)
+            : Exception("InvalidTileAmount", info)
+        {
+            this->error("TileLayer '{}' has a size of {}x{} tiles but contains {} tiles",
+                layerId, width, height, tileAmount);
+            this->hint("The 'tiles' array must contain width * height tiles (use 0 for "
+                       "empty cells)");
+        }
+    };
 }
\ No newline at end of file
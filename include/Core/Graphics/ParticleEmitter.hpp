@@ -0,0 +1,177 @@
+#pragma once
+
+#include <future>
+#include <random>
+#include <vector>
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <Component/Component.hpp>
+#include <Graphics/Color.hpp>
+#include <Graphics/Renderable.hpp>
+#include <Graphics/Texture.hpp>
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Engine
+{
+    class ResourceManager;
+}
+
+namespace obe::Graphics
+{
+    /**
+     * \brief Parameters used to spawn and animate the particles of a
+     *        ParticleEmitter, distances are expressed in SceneUnits
+     */
+    struct ParticleEmitterSettings
+    {
+        /**
+         * \brief Amount of particles spawned each second
+         */
+        double rate = 50;
+        /**
+         * \brief Maximum amount of particles alive at the same time
+         */
+        std::size_t maxParticles = 1000;
+        /**
+         * \brief Minimum lifetime of a particle (in seconds)
+         * \note Lifetimes shorter than a millisecond are raised to a millisecond
+         */
+        double minLifetime = 1;
+        /**
+         * \brief Maximum lifetime of a particle (in seconds)
+         */
+        double maxLifetime = 1;
+        /**
+         * \brief Minimum initial speed of a particle (in SceneUnits per second)
+         */
+        double minSpeed = 0.1;
+        /**
+         * \brief Maximum initial speed of a particle (in SceneUnits per second)
+         */
+        double maxSpeed = 0.2;
+        /**
+         * \brief Emission angle (in degrees, 0 is right and 90 is up)
+         */
+        double direction = 90;
+        /**
+         * \brief Maximum deviation from the emission angle (in degrees)
+         */
+        double spread = 30;
+        /**
+         * \brief Acceleration applied to all particles (in SceneUnits per
+         *        second squared)
+         */
+        double gravityX = 0;
+        double gravityY = 0;
+        /**
+         * \brief Size of a particle when it spawns (in SceneUnits)
+         */
+        double startSize = 0.02;
+        /**
+         * \brief Size of a particle when it dies (in SceneUnits)
+         */
+        double endSize = 0.02;
+        Color startColor = Color(255, 255, 255, 255);
+        Color endColor = Color(255, 255, 255, 0);
+    };
+
+    /**
+     * \brief A Component spawning and drawing a large amount of small quads
+     *        (smoke, sparks, rain, ...)
+     * \note Particles are stored as a structure of arrays and simulated on a
+     *       worker thread while the previous frame is drawn, what is drawn is
+     *       therefore one update late
+     */
+    class ParticleEmitter : public Renderable,
+                            public Component::Component<ParticleEmitter>
+    {
+    private:
+        ParticleEmitterSettings m_settings;
+        Transform::UnitVector m_position;
+        bool m_emitting = true;
+        std::string m_path;
+        Texture m_texture;
+        Engine::ResourceManager* m_resources = nullptr;
+
+        // Particles, only touched by the simulation job while it runs
+        std::vector<float> m_positionX;
+        std::vector<float> m_positionY;
+        std::vector<float> m_velocityX;
+        std::vector<float> m_velocityY;
+        std::vector<float> m_age;
+        std::vector<float> m_lifetime;
+        std::minstd_rand m_random;
+
+        double m_spawnAccumulator = 0;
+        std::size_t m_burst = 0;
+        double m_lastUpdate = 0;
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<sf::Vertex> m_nextVertices;
+        std::future<void> m_job;
+
+        void waitForSimulation();
+        void simulate(const ParticleEmitterSettings& settings, float dt,
+            std::size_t spawnAmount, float originX, float originY);
+        void buildVertices(const ParticleEmitterSettings& settings, float pixelsX,
+            float pixelsY, const sf::FloatRect& textureRect);
+
+    public:
+        /**
+         * \nobind
+         */
+        static constexpr std::string_view ComponentType = "ParticleEmitter";
+        explicit ParticleEmitter(const std::string& id);
+        ~ParticleEmitter() override;
+        ParticleEmitter(const ParticleEmitter&) = delete;
+        ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+        void attachResourceManager(Engine::ResourceManager& resources);
+
+        /**
+         * \brief Spawns and moves the particles according to the time elapsed
+         *        since the last update
+         */
+        void update();
+        /**
+         * \brief Draws all particles using a single draw call
+         * \param surface Target where to draw the particles
+         * \param camera Position of the camera (in ScenePixels)
+         */
+        void draw(RenderTarget surface, const Transform::UnitVector& camera) override;
+
+        /**
+         * \brief Removes all alive particles
+         */
+        void clear();
+        /**
+         * \brief Spawns the given amount of particles at once
+         * \param amount Amount of particles to spawn
+         */
+        void burst(std::size_t amount);
+        /**
+         * \brief Get the amount of particles alive
+         */
+        [[nodiscard]] std::size_t getParticleAmount();
+
+        void setSettings(const ParticleEmitterSettings& settings);
+        [[nodiscard]] ParticleEmitterSettings getSettings() const;
+        void setPosition(const Transform::UnitVector& position);
+        [[nodiscard]] Transform::UnitVector getPosition() const;
+        /**
+         * \brief Starts or stops the spawning of particles, particles already
+         *        alive keep being animated
+         */
+        void setEmitting(bool emitting);
+        [[nodiscard]] bool isEmitting() const;
+        /**
+         * \brief Loads the Texture used by each particle
+         * \param path Path to the Texture, an empty path draws plain quads
+         */
+        void loadTexture(const std::string& path);
+        [[nodiscard]] std::string getTexturePath() const;
+
+        [[nodiscard]] vili::node dump() const override;
+        void load(vili::node& data) override;
+    };
+} // namespace obe::Graphics
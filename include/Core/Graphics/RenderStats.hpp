@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <SFML/Graphics/RenderStates.hpp>
+
+namespace sf
+{
+    class Shape;
+    class VertexArray;
+    class VertexBuffer;
+}
+
+namespace sfe
+{
+    class ComplexSprite;
+}
+
+namespace obe::Graphics
+{
+    class RichText;
+
+    /**
+     * \brief Counters of the rendering work done during one frame
+     */
+    struct RenderStats
+    {
+        /**
+         * \brief Amount of draw calls sent to the render targets
+         */
+        std::size_t drawCalls = 0;
+        /**
+         * \brief Amount of vertices sent to the render targets
+         */
+        std::size_t vertices = 0;
+        /**
+         * \brief Amount of draw calls using another texture than the previous one
+         */
+        std::size_t textureBinds = 0;
+        /**
+         * \brief Amount of draw calls using another shader than the previous one
+         */
+        std::size_t shaderSwitches = 0;
+        /**
+         * \brief Amount of Sprites drawn
+         */
+        std::size_t sprites = 0;
+        /**
+         * \brief Amount of Sprites skipped because they were outside of the view
+         */
+        std::size_t culledSprites = 0;
+        /**
+         * \brief Amount of Canvas textures drawn again
+         */
+        std::size_t canvasRedraws = 0;
+        /**
+         * \brief Time spent rendering the frame (in milliseconds)
+         */
+        double renderTime = 0;
+    };
+
+    /**
+     * \nobind
+     * \brief Collects the RenderStats of the frame being rendered, it is fed by
+     *        the RenderTarget wrappers for raw vertices and by the callers
+     *        drawing a drawable, which know its type
+     * \note Disabled by default, counting is skipped until SetEnabled(true)
+     */
+    class RenderStatsCollector
+    {
+    private:
+        static bool Enabled;
+        static RenderStats Current;
+        static RenderStats LastFrame;
+        static const sf::Texture* LastTexture;
+        static const sf::Shader* LastShader;
+        static std::chrono::steady_clock::time_point FrameStart;
+
+    public:
+        static void SetEnabled(bool enabled);
+        [[nodiscard]] static bool IsEnabled();
+        /**
+         * \brief Resets the counters of the current frame
+         */
+        static void BeginFrame();
+        /**
+         * \brief Stores the counters of the current frame, they can then be
+         *        retrieved using GetLastFrame
+         */
+        static void EndFrame();
+        /**
+         * \brief Counts a draw call of raw vertices
+         */
+        static void CountDraw(std::size_t vertexCount, const sf::RenderStates& states);
+        /**
+         * \brief Counts the draw calls and vertices a drawable will generate
+         */
+        static void CountDraw(
+            const sfe::ComplexSprite& sprite, const sf::RenderStates& states);
+        static void CountDraw(const sf::Shape& shape, const sf::RenderStates& states);
+        static void CountDraw(
+            const sf::VertexArray& vertices, const sf::RenderStates& states);
+        static void CountDraw(
+            const sf::VertexBuffer& buffer, const sf::RenderStates& states);
+        static void CountDraw(const RichText& text, const sf::RenderStates& states);
+        /**
+         * \param culled true if the Sprite has been skipped because it is
+         *        outside of the view
+         */
+        static void CountSprite(bool culled);
+        static void CountCanvasRedraw();
+        [[nodiscard]] static const RenderStats& GetLastFrame();
+    };
+} // namespace obe::Graphics
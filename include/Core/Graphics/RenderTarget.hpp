@@ -3,56 +3,216 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <Graphics/DrawCommandBuffer.hpp>
+#include <Graphics/Exceptions.hpp>
+#include <Graphics/RenderStats.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
+
 namespace obe::Graphics
 {
     class RenderTarget
     {
     private:
-        sf::RenderTarget& m_target;
+        sf::RenderTarget* m_target = nullptr;
+        SoftwareRenderTarget* m_softwareTarget = nullptr;
+        DrawCommandBuffer* m_commands = nullptr;
 
     public:
         RenderTarget(sf::RenderTarget& target);
         RenderTarget(sf::RenderWindow& window);
+        RenderTarget(SoftwareRenderTarget& target);
+        RenderTarget(DrawCommandBuffer& commands);
 
+        /**
+         * \note The draw call is not counted in the RenderStats, the caller
+         *       knows the type of the drawable and counts it with
+         *       RenderStatsCollector::CountDraw
+         */
         void draw(const sf::Drawable& drawable,
             const sf::RenderStates& states = sf::RenderStates::Default) const;
         void draw(const sf::Vertex* vertices, std::size_t vertexCount,
             sf::PrimitiveType type,
             const sf::RenderStates& states = sf::RenderStates::Default) const;
+        /**
+         * \brief Draws with a shared Shader, the uniforms are applied right
+         *        before the draw call (which may happen on the render thread)
+         * \note The draw call is not counted in the RenderStats either
+         */
+        void draw(const sf::Drawable& drawable, Shader& shader,
+            const ShaderUniforms& uniforms) const;
+        /**
+         * \brief Keeps a resource used by the draw calls alive until they are
+         *        executed, only needed when the target is deferred
+         */
+        void retain(std::shared_ptr<const void> resource) const;
+
+        /**
+         * \brief Check if the target is rasterized on the CPU
+         */
+        [[nodiscard]] bool isSoftware() const;
+        /**
+         * \brief Check if draw calls are recorded and executed later by the
+         *        render thread
+         */
+        [[nodiscard]] bool isDeferred() const;
+        void clear(const Color& color) const;
+        [[nodiscard]] sf::Vector2u getSize() const;
+        void setView(const sf::View& view) const;
+        [[nodiscard]] const sf::View& getView() const;
+        [[nodiscard]] const sf::View& getDefaultView() const;
 
+        /**
+         * \throw UnsupportedBySoftwareRenderer if the target is a SoftwareRenderTarget
+         * \throw UnsupportedByRenderThread if the target is a DrawCommandBuffer
+         */
         operator sf::RenderTarget&();
+        /**
+         * \throw UnsupportedBySoftwareRenderer if the target is a SoftwareRenderTarget
+         * \throw UnsupportedByRenderThread if the target is a DrawCommandBuffer
+         */
         operator const sf::RenderTarget&() const;
     };
 
     inline RenderTarget::RenderTarget(sf::RenderTarget& target)
-        : m_target(target)
+        : m_target(&target)
     {
     }
 
     inline RenderTarget::RenderTarget(sf::RenderWindow& window)
-        : m_target(window)
+        : m_target(&window)
+    {
+    }
+
+    inline RenderTarget::RenderTarget(SoftwareRenderTarget& target)
+        : m_softwareTarget(&target)
+    {
+    }
+
+    inline RenderTarget::RenderTarget(DrawCommandBuffer& commands)
+        : m_commands(&commands)
     {
     }
 
     inline void RenderTarget::draw(
         const sf::Drawable& drawable, const sf::RenderStates& states) const
     {
-        m_target.draw(drawable, states);
+        if (m_softwareTarget)
+            m_softwareTarget->draw(drawable, states);
+        else if (m_commands)
+            m_commands->draw(drawable, states);
+        else
+            m_target->draw(drawable, states);
     }
 
     inline void RenderTarget::draw(const sf::Vertex* vertices, std::size_t vertexCount,
         sf::PrimitiveType type, const sf::RenderStates& states) const
     {
-        m_target.draw(vertices, vertexCount, type, states);
+        RenderStatsCollector::CountDraw(vertexCount, states);
+        if (m_softwareTarget)
+            m_softwareTarget->draw(vertices, vertexCount, type, states);
+        else if (m_commands)
+            m_commands->draw(vertices, vertexCount, type, states);
+        else
+            m_target->draw(vertices, vertexCount, type, states);
+    }
+
+    inline void RenderTarget::draw(const sf::Drawable& drawable, Shader& shader,
+        const ShaderUniforms& uniforms) const
+    {
+        const sf::RenderStates states(&shader);
+        if (m_softwareTarget)
+            m_softwareTarget->draw(drawable, states);
+        else if (m_commands)
+            m_commands->draw(drawable, shader, uniforms);
+        else
+        {
+            shader.applyUniforms(uniforms);
+            m_target->draw(drawable, states);
+        }
+    }
+
+    inline void RenderTarget::retain(std::shared_ptr<const void> resource) const
+    {
+        if (m_commands)
+            m_commands->retain(std::move(resource));
+    }
+
+    inline bool RenderTarget::isSoftware() const
+    {
+        return m_softwareTarget != nullptr;
+    }
+
+    inline bool RenderTarget::isDeferred() const
+    {
+        return m_commands != nullptr;
+    }
+
+    inline void RenderTarget::clear(const Color& color) const
+    {
+        if (m_softwareTarget)
+            m_softwareTarget->clear(color);
+        else if (m_commands)
+            m_commands->clear(color);
+        else
+            m_target->clear(color);
+    }
+
+    inline sf::Vector2u RenderTarget::getSize() const
+    {
+        if (m_softwareTarget)
+            return m_softwareTarget->getSize();
+        if (m_commands)
+            return m_commands->getSize();
+        return m_target->getSize();
+    }
+
+    inline void RenderTarget::setView(const sf::View& view) const
+    {
+        if (m_softwareTarget)
+            m_softwareTarget->setView(view);
+        else if (m_commands)
+            m_commands->setView(view);
+        else
+            m_target->setView(view);
+    }
+
+    inline const sf::View& RenderTarget::getView() const
+    {
+        if (m_softwareTarget)
+            return m_softwareTarget->getView();
+        if (m_commands)
+            return m_commands->getView();
+        return m_target->getView();
+    }
+
+    inline const sf::View& RenderTarget::getDefaultView() const
+    {
+        if (m_softwareTarget)
+            return m_softwareTarget->getDefaultView();
+        if (m_commands)
+            return m_commands->getDefaultView();
+        return m_target->getDefaultView();
     }
 
     inline RenderTarget::operator sf::RenderTarget&()
     {
-        return m_target;
+        if (m_softwareTarget)
+            throw Exceptions::UnsupportedBySoftwareRenderer(
+                "access the underlying sf::RenderTarget", EXC_INFO);
+        if (m_commands)
+            throw Exceptions::UnsupportedByRenderThread(
+                "access the underlying sf::RenderTarget", EXC_INFO);
+        return *m_target;
     }
 
     inline RenderTarget::operator const sf::RenderTarget&() const
     {
-        return m_target;
+        if (m_softwareTarget)
+            throw Exceptions::UnsupportedBySoftwareRenderer(
+                "access the underlying sf::RenderTarget", EXC_INFO);
+        if (m_commands)
+            throw Exceptions::UnsupportedByRenderThread(
+                "access the underlying sf::RenderTarget", EXC_INFO);
+        return *m_target;
     }
 }
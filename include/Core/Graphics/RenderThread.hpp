@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <Graphics/DrawCommandBuffer.hpp>
+#include <Utils/ExecUtils.hpp>
+
+namespace sf
+{
+    class RenderWindow;
+}
+
+namespace obe::Graphics
+{
+    /**
+     * \nobind
+     * \brief Owns the OpenGL context of a window and executes the draw
+     *        commands recorded by the main thread
+     * \note The main thread records frame N while frame N - 1 is rendered. If
+     *       the main thread is faster than the render thread, unrendered frames
+     *       are replaced by newer ones instead of blocking the main thread.
+     *       Resources retained by a frame are released once a newer frame has
+     *       been rendered, dropped frames hand them over to the next frame
+     */
+    class RenderThread
+    {
+    private:
+        sf::RenderWindow& m_window;
+        obe::Utils::Exec::TripleBuffer<DrawCommandBuffer> m_frames;
+        std::thread m_thread;
+        std::atomic<bool> m_running = false;
+        // Only used to wake up the render thread, frames are exchanged without locks
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wake;
+        bool m_pending = false;
+        std::atomic<int> m_verticalSync = -1;
+        std::atomic<std::size_t> m_renderedFrames = 0;
+        std::atomic<std::size_t> m_droppedFrames = 0;
+        static RenderThread* Current;
+
+        void run();
+
+    public:
+        explicit RenderThread(sf::RenderWindow& window);
+        ~RenderThread();
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        /**
+         * \brief Hands the OpenGL context of the window to the render thread
+         */
+        void start();
+        /**
+         * \brief Waits for the frame being rendered and gives the OpenGL
+         *        context back to the calling thread
+         */
+        void stop();
+        [[nodiscard]] bool isRunning() const;
+
+        /**
+         * \brief Get the buffer recording the frame being built
+         */
+        DrawCommandBuffer& getFrame();
+        /**
+         * \brief Sends the recorded frame to the render thread and starts a new
+         *        one, the view of the previous frame is kept
+         */
+        void submitFrame();
+        /**
+         * \brief Enables or disables vertical synchronization, it is applied by
+         *        the render thread before its next frame
+         */
+        void setVerticalSyncEnabled(bool enabled);
+
+        [[nodiscard]] std::size_t getRenderedFrameAmount() const;
+        /**
+         * \brief Get the amount of frames replaced by a newer frame before the
+         *        render thread could draw them
+         */
+        [[nodiscard]] std::size_t getDroppedFrameAmount() const;
+
+        /**
+         * \brief Check if a render thread may be replaying recorded frames
+         */
+        [[nodiscard]] static bool IsActive();
+        /**
+         * \brief Keeps a resource alive until every frame recorded so far has
+         *        been rendered, it is released right away when no render thread
+         *        is running. Must be called from the thread recording the frames
+         */
+        static void ReleaseAfterPresent(std::shared_ptr<const void> resource);
+    };
+} // namespace obe::Graphics
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Graphics/RenderTarget.hpp>
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \brief Element drawn by the Scene in between Sprites according to its
+     *        layer and z-depth
+     */
+    class Renderable
+    {
+    protected:
+        int m_layer = 1;
+        int m_zdepth = 0;
+        bool m_visible = true;
+
+    public:
+        virtual ~Renderable() = default;
+        /**
+         * \brief Draws the element
+         * \param surface Target where to draw the element
+         * \param camera Position of the camera (in ScenePixels)
+         */
+        virtual void draw(RenderTarget surface, const Transform::UnitVector& camera) = 0;
+
+        void setLayer(int layer);
+        [[nodiscard]] int getLayer() const;
+        void setZDepth(int zdepth);
+        [[nodiscard]] int getZDepth() const;
+        void setVisible(bool visible);
+        [[nodiscard]] bool isVisible() const;
+    };
+} // namespace obe::Graphics
@@ -1,20 +1,62 @@
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
 #include <SFML/Graphics/Shader.hpp>
 #include <vili/node.hpp>
 
+#include <Graphics/Color.hpp>
 #include <Types/Serializable.hpp>
 
 namespace obe::Graphics
 {
+    /**
+     * \nobind
+     */
+    using ShaderUniformValue = std::variant<float, sf::Vector2f, sf::Vector3f, Color>;
+
+    /**
+     * \brief Uniform values of an object drawn with a shared Shader, they are
+     *        only sent to the Shader when they differ from the bound values
+     * \note Uniforms missing from the set are reset to their Shader default
+     *       when the object is drawn, so values of the previous object never
+     *       leak into the next one
+     * \nobind
+     */
+    class ShaderUniforms
+    {
+    private:
+        std::vector<std::pair<std::string, ShaderUniformValue>> m_values;
+
+    public:
+        void set(const std::string& name, const ShaderUniformValue& value);
+        void remove(const std::string& name);
+        void clear();
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] const std::vector<std::pair<std::string, ShaderUniformValue>>&
+        getValues() const;
+    };
+
     /**
      * \brief Shader class to use GLSL
+     * \note A Shader shared by several objects keeps track of the last value
+     *       sent for each uniform. Before an object is drawn, every uniform
+     *       it does not set goes back to the default registered with
+     *       setUniformDefault (or to zero when there is none)
      * \bind{Shader}
      */
     class Shader : public sf::Shader, public Types::Serializable
     {
     private:
         std::string m_path;
+        std::vector<std::string> m_defines;
+        std::unordered_map<std::string, ShaderUniformValue> m_boundUniforms;
+        std::unordered_map<std::string, ShaderUniformValue> m_defaultUniforms;
+        void sendUniform(const std::string& name, const ShaderUniformValue& value);
 
     public:
         Shader();
@@ -29,6 +71,45 @@ namespace obe::Graphics
          * \param data Vili Node containing the data of the Shader
          */
         void load(vili::node& data) override;
-        void loadShader(const std::string& path);
+        /**
+         * \brief Compiles the fragment shader at the given path
+         * \param path Path to the shader source, it uses the obe::System::Path
+         *        loading system
+         * \param defines Macros inserted after the #version directive, either
+         *        "NAME" or "NAME=VALUE"
+         * \return true if the shader has been compiled, false otherwise
+         */
+        bool loadShader(
+            const std::string& path, const std::vector<std::string>& defines = {});
+        [[nodiscard]] std::string getPath() const;
+        [[nodiscard]] std::vector<std::string> getDefines() const;
+        /**
+         * \brief Sets the value a float uniform takes when the drawn object
+         *        does not set it
+         * \param name Name of the uniform in the shader
+         * \param value Default value of the uniform
+         */
+        void setUniformDefault(const std::string& name, float value);
+        /**
+         * \brief Sets the default value of a vec2 uniform
+         */
+        void setUniformDefault(const std::string& name, float x, float y);
+        /**
+         * \brief Sets the default value of a vec3 uniform
+         */
+        void setUniformDefault(const std::string& name, float x, float y, float z);
+        /**
+         * \brief Sets the default value of a vec4 uniform
+         */
+        void setUniformDefault(const std::string& name, const Color& color);
+        /**
+         * \nobind
+         * \brief Makes the Shader state match the given uniforms: the uniforms
+         *        of the previous object that are not in the set are reset to
+         *        their default, then the values that differ from the bound
+         *        ones are sent. Uniforms set directly with setUniform are not
+         *        tracked
+         */
+        void applyUniforms(const ShaderUniforms& uniforms);
     };
 } // namespace obe::Graphics
\ No newline at end of file
@@ -152,8 +152,8 @@ namespace obe::Graphics::Shapes
     // Shape methods
     template <class T> void Shape<T>::setTexture(const Texture& texture)
     {
-        static_cast<T&>(*this).shape.setTexture(
-            &texture.operator const sf::Texture&(), true);
+        static_cast<T&>(*this).shape.setTexture(&texture.operator const sf::Texture&());
+        static_cast<T&>(*this).shape.setTextureRect(texture.getTextureRect());
     }
 
     template <class T> void Shape<T>::setTextureRect(const Transform::Rect& rect)
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <Graphics/Color.hpp>
+
+namespace sf
+{
+    class Drawable;
+    class RenderTexture;
+}
+
+namespace obe::Graphics
+{
+    /**
+     * \brief A render target rasterizing everything on the CPU into a framebuffer
+     *        stored in memory, it is used to render without a GPU (benchmarks,
+     *        comparisons against reference images, simulation machines)
+     * \note Shaders are ignored. Texture pixels are read back from the GPU
+     *       once and cached until InvalidateTexture is called, which the
+     *       engine does whenever it modifies or destroys a texture (Texture,
+     *       TextureAtlas, Canvas and the glyph pages of RichText). Textures
+     *       modified directly through SFML have to be invalidated by hand
+     */
+    class SoftwareRenderTarget
+    {
+    private:
+        struct CachedTexture
+        {
+            sf::Image image;
+        };
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        std::vector<std::uint8_t> m_pixels;
+        sf::View m_view;
+        sf::View m_defaultView;
+        std::size_t m_drawCalls = 0;
+        static std::unordered_map<const sf::Texture*, CachedTexture> TextureCache;
+        // Textures can be released on the render thread
+        static std::mutex TextureCacheMutex;
+        static bool Enabled;
+
+        [[nodiscard]] const sf::Image* getTextureImage(const sf::Texture* texture) const;
+        [[nodiscard]] sf::IntRect getViewport() const;
+        [[nodiscard]] bool isInside(int x, int y, const sf::IntRect& viewport) const;
+        void blend(int x, int y, const sf::Color& source, const sf::BlendMode& mode);
+        void drawTriangle(const sf::Vertex* vertices, const sf::Image* texture,
+            bool smooth, bool repeated, const sf::BlendMode& mode);
+        void drawLine(
+            const sf::Vertex& first, const sf::Vertex& second, const sf::BlendMode& mode);
+
+    public:
+        SoftwareRenderTarget() = default;
+        /**
+         * \brief Creates a new SoftwareRenderTarget
+         * \param width Width of the framebuffer (in pixels)
+         * \param height Height of the framebuffer (in pixels)
+         */
+        SoftwareRenderTarget(unsigned int width, unsigned int height);
+        /**
+         * \brief Resizes the framebuffer and resets the view
+         * \param width Width of the framebuffer (in pixels)
+         * \param height Height of the framebuffer (in pixels)
+         */
+        void create(unsigned int width, unsigned int height);
+        [[nodiscard]] sf::Vector2u getSize() const;
+
+        void clear(const Color& color = Color(0, 0, 0));
+        void setView(const sf::View& view);
+        [[nodiscard]] const sf::View& getView() const;
+        [[nodiscard]] const sf::View& getDefaultView() const;
+
+        /**
+         * \nobind
+         * \brief Draws a SFML or ObEngine drawable (sprites, shapes, vertex
+         *        arrays and texts), other drawables are ignored with a warning
+         */
+        void draw(const sf::Drawable& drawable,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+        /**
+         * \nobind
+         */
+        void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /**
+         * \brief Get the amount of draw calls since the last clear
+         */
+        [[nodiscard]] std::size_t getDrawCalls() const;
+        /**
+         * \nobind
+         * \brief Get the RGBA pixels of the framebuffer
+         */
+        [[nodiscard]] const std::vector<std::uint8_t>& getPixels() const;
+        /**
+         * \brief Copies the framebuffer into an image
+         */
+        [[nodiscard]] sf::Image copyToImage() const;
+        /**
+         * \brief Saves the framebuffer to an image file
+         * \param path Path of the image file to write
+         * \return true if the file has been written, false otherwise
+         */
+        bool saveToFile(const std::string& path) const;
+        /**
+         * \brief Compares the framebuffer with a reference image
+         * \param reference Image the framebuffer is compared to
+         * \param tolerance Maximum difference allowed on each channel
+         * \return The amount of pixels that are different, or the total amount
+         *         of pixels if the sizes are not the same
+         */
+        [[nodiscard]] std::size_t compare(
+            const sf::Image& reference, std::uint8_t tolerance = 0) const;
+
+        /**
+         * \brief Forgets the cached pixels of a texture that has been modified
+         * \param texture Texture that will be read back on next draw
+         */
+        static void InvalidateTexture(const sf::Texture& texture);
+        /**
+         * \brief Provides the pixels of a texture so it does not have to be read back
+         * \param texture Texture the pixels belong to
+         * \param image Pixels of the texture
+         */
+        static void SetTextureImage(const sf::Texture& texture, const sf::Image& image);
+        /**
+         * \nobind
+         * \brief Creates a texture that is invalidated when destroyed, so
+         *        a texture allocated at the same address later is read back
+         */
+        static std::shared_ptr<sf::Texture> MakeTexture();
+        /**
+         * \nobind
+         * \brief Creates a render texture that is invalidated when destroyed
+         */
+        static std::shared_ptr<sf::RenderTexture> MakeRenderTexture();
+        /**
+         * \brief Selects the software renderer for the intermediate render
+         *        targets created afterwards (Canvas)
+         * \param enabled true to render on the CPU, false to use OpenGL
+         */
+        static void SetEnabled(bool enabled);
+        [[nodiscard]] static bool IsEnabled();
+    };
+} // namespace obe::Graphics
@@ -15,6 +15,11 @@
 namespace obe::Graphics
 {
     void MakeNullTexture();
+    /**
+     * \nobind
+     * \brief Get the texture used by Sprites without texture
+     */
+    const Texture& GetNullTexture();
     /**
      * \brief Type of the handle point of a Sprite (either scale or rotate)
      */
@@ -103,13 +108,17 @@ namespace obe::Graphics
         std::string m_path = "";
         PositionTransformer m_positionTransformer;
         Shader* m_shader = nullptr;
+        std::shared_ptr<Shader> m_sharedShader;
+        ShaderUniforms m_shaderUniforms;
         sfe::ComplexSprite m_sprite;
         Graphics::Texture m_texture;
+        bool m_textureLoading = false;
         bool m_visible = true;
         int m_zdepth = 0;
         bool m_antiAliasing = true;
 
         void resetUnit(Transform::Units unit) override;
+        void loadShaderUniform(const std::string& name, vili::node& value);
 
     public:
         /**
@@ -237,6 +246,12 @@ namespace obe::Graphics
          * \param path A std::string containing the path of the texture to load
          */
         void loadTexture(const std::string& path);
+        /**
+         * \brief The Sprite will load the Texture at the given path in the background,
+         *        displaying the placeholder texture until it is ready
+         * \param path A std::string containing the path of the texture to load
+         */
+        void loadTextureAsync(const std::string& path);
         /**
          * \brief Rotate the sprite
          * \param addRotate The angle to add to the Sprite (0 -> 360 where
@@ -284,6 +299,36 @@ namespace obe::Graphics
          */
         void setScalingOrigin(int x, int y);
         void setShader(Shader* shader);
+        /**
+         * \brief Uses the shader program with the given path and defines, the
+         *        program is shared with the other Sprites using it when the Sprite
+         *        is attached to a ResourceManager
+         * \param path Path to the fragment shader
+         * \param defines Macros defined when compiling the shader
+         */
+        void loadShader(
+            const std::string& path, const std::vector<std::string>& defines = {});
+        /**
+         * \brief Sets a uniform value used when drawing the Sprite, it is only
+         *        sent to the Shader when it differs from its current value.
+         *        The uniforms the Sprite does not set use the Shader defaults
+         * \param name Name of the uniform in the shader
+         * \param value Value of a float uniform
+         */
+        void setShaderUniform(const std::string& name, float value);
+        /**
+         * \brief Sets the value of a vec2 uniform used when drawing the Sprite
+         */
+        void setShaderUniform(const std::string& name, float x, float y);
+        /**
+         * \brief Sets the value of a vec3 uniform used when drawing the Sprite
+         */
+        void setShaderUniform(const std::string& name, float x, float y, float z);
+        /**
+         * \brief Sets the value of a vec4 uniform used when drawing the Sprite
+         */
+        void setShaderUniform(const std::string& name, const Color& color);
+        void removeShaderUniform(const std::string& name);
         /**
          * \brief Sets the Texture of the Sprite
          * \param texture Texture to set
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <tuple>
 #include <vector>
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 #include <Graphics/Color.hpp>
 #include <Graphics/Font.hpp>
@@ -33,9 +37,23 @@ namespace obe::Graphics
         Text(const std::string& string);
     };
 
+    /**
+     * \nobind
+     * \brief Glyph quads of a single line of text (positioned relative to the
+     *        origin of the text, without colors) and its bounds
+     */
+    struct TextLayout
+    {
+        std::vector<sf::Vertex> fill;
+        std::vector<sf::Vertex> outline;
+        sf::FloatRect bounds;
+        float lineSpacing = 0;
+    };
+
     class RichText : public sf::Drawable, public sf::Transformable
     {
     private:
+        using TextLayoutPtr = std::shared_ptr<const TextLayout>;
         /**
          * \nobind
          */
@@ -45,17 +63,19 @@ namespace obe::Graphics
             void setCharacterSize(unsigned int size) const;
             void setFont(const sf::Font& font) const;
             const std::vector<sf::Text>& getTexts() const;
-            void appendText(sf::Text text);
+            void appendText(sf::Text text, TextLayoutPtr layout);
             sf::FloatRect getLocalBounds() const;
             sf::FloatRect getGlobalBounds() const;
+            void updateGeometry(const RichText& richText) const;
+            void appendVertices(sf::VertexArray& vertices) const;
 
         protected:
             void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
         private:
-            void updateGeometry() const;
-            void updateTextAndGeometry(sf::Text& text) const;
+            void updateTextAndGeometry(sf::Text& text, const TextLayout& layout) const;
             mutable std::vector<sf::Text> m_texts;
+            mutable std::vector<TextLayoutPtr> m_layouts;
             mutable sf::FloatRect m_bounds;
         };
 
@@ -78,16 +98,33 @@ namespace obe::Graphics
         sf::FloatRect getLocalBounds() const;
         sf::FloatRect getGlobalBounds() const;
 
+        /**
+         * \nobind
+         * \brief Get the glyph quads of every text, they are drawn using the
+         *        texture of the font for the current character size
+         */
+        const sf::VertexArray& getVertices() const;
+
     protected:
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
     private:
+        using TextLayoutKey = std::tuple<sf::String, unsigned int, sf::Uint32, float>;
         sf::Text createText(const sf::String& string, const Color& color,
             const Color& outline, unsigned int thickness, sf::Text::Style style) const;
+        /**
+         * \brief Get the layout of a text, computed only once for each string,
+         *        character size, style and outline thickness
+         */
+        TextLayoutPtr getLayout(const sf::Text& text) const;
         void updateGeometry() const;
+        void updateVertices() const;
         mutable std::vector<Line> m_lines;
         Font m_font;
         unsigned int m_characterSize;
         mutable sf::FloatRect m_bounds;
+        mutable std::map<TextLayoutKey, TextLayoutPtr> m_layouts;
+        mutable sf::VertexArray m_vertices { sf::Triangles };
+        mutable bool m_verticesNeedUpdate = true;
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -9,15 +10,29 @@
 
 namespace obe::Graphics
 {
+    /**
+     * \brief Wrapper around sf::Texture that can either own a texture, share it
+     *        or reference it.
+     *        A Texture can also be a view on a sub-rectangle of another texture
+     *        (used by texture atlas pages)
+     */
     class Texture
     {
     private:
         std::variant<sf::Texture, std::shared_ptr<sf::Texture>, const sf::Texture*>
             m_texture;
+        std::optional<sf::IntRect> m_subRect;
+        std::shared_ptr<const bool> m_loading;
 
     public:
         Texture();
         Texture(std::shared_ptr<sf::Texture> texture);
+        /**
+         * \brief Creates a view on a sub-rectangle of a shared texture
+         * \param texture Texture containing the region (an atlas page for example)
+         * \param subRect Region of the texture covered by the view (in pixels)
+         */
+        Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect);
         Texture(const sf::Texture& texture);
         Texture(const Texture& copy);
         ~Texture();
@@ -27,7 +42,34 @@ namespace obe::Graphics
         bool loadFromFile(const std::string& filename, const Transform::Rect& rect);
         bool loadFromImage(const sf::Image& image);
 
+        /**
+         * \brief Get the size of the Texture (size of the sub-rectangle for views)
+         * \return The size of the Texture in ScenePixels
+         */
         [[nodiscard]] Transform::UnitVector getSize() const;
+        /**
+         * \brief Check if the Texture is a view on a region of another texture
+         * \return true if the Texture only covers a sub-rectangle, false otherwise
+         */
+        [[nodiscard]] bool isView() const;
+        /**
+         * \nobind
+         * \brief Get the region of the underlying sf::Texture to display
+         * \return The sub-rectangle of a view or the full texture rectangle
+         */
+        [[nodiscard]] sf::IntRect getTextureRect() const;
+        /**
+         * \brief Check if the Texture is still being loaded asynchronously
+         *        (its content is then a placeholder)
+         * \return true if the real content has not been uploaded yet, false otherwise
+         */
+        [[nodiscard]] bool isLoading() const;
+        /**
+         * \nobind
+         * \brief Binds the Texture to a loading state shared with its loader
+         * \param loading Flag set to false by the loader once the texture is uploaded
+         */
+        void setLoadingState(std::shared_ptr<const bool> loading);
 
         void setAntiAliasing(bool antiAliasing);
         [[nodiscard]] bool isAntiAliased() const;
@@ -35,9 +77,19 @@ namespace obe::Graphics
         void setRepeated(bool repeated);
         [[nodiscard]] bool isRepeated() const;
 
+        /**
+         * \brief Replaces the content by a new empty texture owned by the Texture
+         */
         void reset();
 
         unsigned int useCount();
+        /**
+         * \nobind
+         * \brief Get a shared ownership of the underlying texture, it keeps the
+         *        texture alive while draw calls using it are pending
+         * \return nullptr if the Texture only references a texture it doesn't own
+         */
+        [[nodiscard]] std::shared_ptr<const sf::Texture> getSharedTexture() const;
 
         operator sf::Texture&();
         operator const sf::Texture&() const;
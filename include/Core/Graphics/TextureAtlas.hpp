@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <Graphics/Texture.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \brief Rectangle packer using the skyline bottom-left heuristic
+     */
+    class SkylinePacker
+    {
+    private:
+        struct SkylineNode
+        {
+            unsigned int x;
+            unsigned int y;
+            unsigned int width;
+        };
+        unsigned int m_width;
+        unsigned int m_height;
+        unsigned int m_usedArea = 0;
+        std::vector<SkylineNode> m_skyline;
+
+        [[nodiscard]] std::optional<unsigned int> fit(
+            std::size_t index, unsigned int width, unsigned int height) const;
+        void addLevel(std::size_t index, unsigned int x, unsigned int y,
+            unsigned int width, unsigned int height);
+
+    public:
+        /**
+         * \brief Creates a new empty SkylinePacker
+         * \param width Width of the area to pack rectangles into
+         * \param height Height of the area to pack rectangles into
+         */
+        SkylinePacker(unsigned int width, unsigned int height);
+        /**
+         * \brief Finds a place for a rectangle of the given size
+         * \param width Width of the rectangle to place
+         * \param height Height of the rectangle to place
+         * \return Top-left position of the placed rectangle or an empty optional
+         *         if there is no room left for it
+         */
+        std::optional<sf::Vector2u> insert(unsigned int width, unsigned int height);
+        /**
+         * \brief Removes all placed rectangles
+         */
+        void clear();
+        /**
+         * \brief Get the ratio of the area covered by placed rectangles
+         * \return A value between 0 (empty) and 1 (full)
+         */
+        [[nodiscard]] double getOccupancy() const;
+        [[nodiscard]] unsigned int getWidth() const;
+        [[nodiscard]] unsigned int getHeight() const;
+    };
+
+    /**
+     * \brief Packs small images into shared texture pages so Sprites and
+     *        Animations using them can be batched
+     * \note Pages are owned by the Texture views on their regions, a page is
+     *       freed with the last of them
+     */
+    class TextureAtlas
+    {
+    private:
+        struct AtlasPage
+        {
+            std::weak_ptr<sf::Texture> texture;
+            SkylinePacker packer;
+        };
+        unsigned int m_pageSize;
+        unsigned int m_padding;
+        bool m_antiAliasing;
+        std::vector<AtlasPage> m_pages;
+
+        std::shared_ptr<sf::Texture> createPage();
+
+    public:
+        /**
+         * \brief Creates a new TextureAtlas
+         * \param pageSize Width and height of each atlas page (in pixels)
+         * \param padding Amount of pixels extruded around each image to prevent
+         *        neighbour bleeding when sampling
+         * \param antiAliasing Smoothing applied to all pages of the atlas
+         */
+        TextureAtlas(unsigned int pageSize, unsigned int padding, bool antiAliasing);
+        /**
+         * \brief Check if an image of the given size can be stored in a page
+         * \param width Width of the image (in pixels)
+         * \param height Height of the image (in pixels)
+         * \return true if the image fits in an empty page, false otherwise
+         */
+        [[nodiscard]] bool accepts(unsigned int width, unsigned int height) const;
+        /**
+         * \brief Packs an image into one of the atlas pages (a new page is
+         *        created when all existing pages are full)
+         * \param image Image to pack
+         * \return A Texture view on the packed region or an empty optional if
+         *         the image can't fit in a page
+         */
+        std::optional<Texture> insert(const sf::Image& image);
+        /**
+         * \brief Removes all pages of the atlas
+         *        (Texture views on these pages keep them alive)
+         */
+        void clear();
+        /**
+         * \brief Get the amount of pages still referenced by a Texture view
+         */
+        [[nodiscard]] std::size_t getPageCount() const;
+        [[nodiscard]] unsigned int getPageSize() const;
+        [[nodiscard]] unsigned int getPadding() const;
+    };
+} // namespace obe::Graphics
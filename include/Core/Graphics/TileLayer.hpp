@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <Component/Component.hpp>
+#include <Graphics/Renderable.hpp>
+#include <Graphics/Texture.hpp>
+#include <Transform/Rect.hpp>
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Engine
+{
+    class ResourceManager;
+}
+
+namespace obe::Graphics
+{
+    /**
+     * \brief Identifier of a tile in a TileLayer, 0 is an empty cell and n is
+     *        the n-th tile of the tileset (left to right, top to bottom)
+     */
+    using TileId = std::uint32_t;
+
+    /**
+     * \brief A grid of tiles taken from a single tileset texture
+     * \note The grid is split in square chunks that are drawn with one draw
+     *       call each. The vertices of a chunk are only rebuilt when one of
+     *       its tiles changes and chunks outside of the view are skipped
+     */
+    class TileLayer : public Renderable, public Component::Component<TileLayer>
+    {
+    private:
+        struct Chunk
+        {
+            std::vector<sf::Vertex> vertices;
+            sf::VertexBuffer buffer;
+            bool uploaded = false;
+            bool dirty = true;
+            sf::FloatRect bounds;
+        };
+        std::string m_path;
+        Texture m_tileset;
+        Engine::ResourceManager* m_resources = nullptr;
+        unsigned int m_tileWidth = 16;
+        unsigned int m_tileHeight = 16;
+
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        std::vector<TileId> m_tiles;
+        Transform::UnitVector m_position;
+        Transform::UnitVector m_tileSize = Transform::UnitVector(0.1, 0.1);
+
+        unsigned int m_chunkSize = 16;
+        unsigned int m_chunksX = 0;
+        std::vector<Chunk> m_chunks;
+        sf::Vector2f m_builtScale;
+        std::size_t m_drawnChunks = 0;
+
+        std::unordered_set<TileId> m_solidTiles;
+        bool m_solidAreasChanged = false;
+
+        void createChunks();
+        void invalidateChunks();
+        void buildChunk(std::size_t chunkIndex, sf::Vector2f scale);
+        [[nodiscard]] std::size_t getChunkIndex(unsigned int x, unsigned int y) const;
+
+    public:
+        /**
+         * \nobind
+         */
+        static constexpr std::string_view ComponentType = "TileLayer";
+        explicit TileLayer(const std::string& id);
+
+        void attachResourceManager(Engine::ResourceManager& resources);
+
+        /**
+         * \brief Resizes the grid, all cells become empty
+         * \param width Amount of tiles on each row
+         * \param height Amount of tiles on each column
+         */
+        void create(unsigned int width, unsigned int height);
+        [[nodiscard]] unsigned int getWidth() const;
+        [[nodiscard]] unsigned int getHeight() const;
+        /**
+         * \brief Changes the tile of a cell, only the chunk containing the cell
+         *        is rebuilt
+         * \param x Column of the cell
+         * \param y Row of the cell
+         * \param tile Tile to put in the cell (0 to empty it)
+         */
+        void setTile(unsigned int x, unsigned int y, TileId tile);
+        /**
+         * \brief Get the tile of a cell (0 if the cell is empty or outside of
+         *        the grid)
+         */
+        [[nodiscard]] TileId getTile(unsigned int x, unsigned int y) const;
+        /**
+         * \brief Sets the texture tiles are taken from
+         * \param path Path to the tileset texture
+         * \param tileWidth Width of a tile in the tileset (in pixels)
+         * \param tileHeight Height of a tile in the tileset (in pixels)
+         */
+        void setTileset(
+            const std::string& path, unsigned int tileWidth, unsigned int tileHeight);
+        [[nodiscard]] std::string getTilesetPath() const;
+        /**
+         * \brief Sets the size of a cell in the Scene
+         */
+        void setTileSize(const Transform::UnitVector& size);
+        [[nodiscard]] Transform::UnitVector getTileSize() const;
+        /**
+         * \brief Sets the position of the top-left corner of the grid
+         */
+        void setPosition(const Transform::UnitVector& position);
+        [[nodiscard]] Transform::UnitVector getPosition() const;
+        /**
+         * \brief Sets the amount of tiles on each side of a chunk
+         */
+        void setChunkSize(unsigned int chunkSize);
+        [[nodiscard]] unsigned int getChunkSize() const;
+        [[nodiscard]] std::size_t getChunkAmount() const;
+        /**
+         * \brief Get the amount of chunks that were inside of the view during
+         *        the last draw
+         */
+        [[nodiscard]] std::size_t getDrawnChunkAmount() const;
+
+        /**
+         * \brief Sets the tiles colliders are generated for, an empty list
+         *        disables collider generation
+         */
+        void setSolidTiles(const std::vector<TileId>& tiles);
+        [[nodiscard]] std::vector<TileId> getSolidTiles() const;
+        [[nodiscard]] bool isSolid(unsigned int x, unsigned int y) const;
+        /**
+         * \brief Get the rectangles covering all solid cells, adjacent solid
+         *        cells are merged into as few rectangles as possible
+         * \return Rectangles in SceneUnits
+         */
+        [[nodiscard]] std::vector<Transform::Rect> getSolidAreas() const;
+        /**
+         * \nobind
+         * \brief Check if the solid cells changed since the last call
+         */
+        bool consumeSolidAreasChange();
+
+        void draw(RenderTarget surface, const Transform::UnitVector& camera) override;
+
+        [[nodiscard]] vili::node dump() const override;
+        void load(vili::node& data) override;
+    };
+} // namespace obe::Graphics
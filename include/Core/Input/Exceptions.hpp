@@ -93,6 +93,17 @@ namespace obe::Input::Exceptions
         }
     };
 
+    class InputRecordingError : public Exception
+    {
+    public:
+        InputRecordingError(
+            std::string_view path, std::string_view reason, DebugInfo info)
+            : Exception("InputRecordingError", info)
+        {
+            this->error("Unable to use input recording file '{}' : {}", path, reason);
+        }
+    };
+
     class InvalidInputTypeEnumValue : public Exception
     {
     public:
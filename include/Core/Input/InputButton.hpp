@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -49,6 +50,7 @@ namespace obe::Input
         std::string m_name;
         std::string m_returnChar;
         InputType m_type;
+        std::optional<bool> m_simulatedState;
 
     public:
         /**
@@ -119,6 +121,18 @@ namespace obe::Input
          * \return true if the key is pressed, false otherwise
          */
         [[nodiscard]] bool isPressed() const;
+        /**
+         * \nobind
+         * \brief Forces the state returned by isPressed instead of reading the
+         *        device (used to replay recorded inputs)
+         * \param pressed State isPressed will return
+         */
+        void setSimulatedState(bool pressed);
+        /**
+         * \nobind
+         * \brief Makes isPressed read the state of the device again
+         */
+        void clearSimulatedState();
         // Write
         /**
          * \brief Get if the key prints a writable character
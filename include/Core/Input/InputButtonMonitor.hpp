@@ -20,6 +20,7 @@ namespace obe::Input
     private:
         InputButton& m_button;
         InputButtonState m_buttonState = InputButtonState::Idle;
+        Triggers::TriggerHandle m_trigger;
 
     public:
         /**
@@ -5,6 +5,7 @@
 #include <vili/node.hpp>
 
 #include <Input/InputAction.hpp>
+#include <Input/InputRecorder.hpp>
 #include <Triggers/TriggerGroup.hpp>
 #include <Triggers/TriggerManager.hpp>
 #include <Types/Togglable.hpp>
@@ -26,6 +27,7 @@ namespace obe::Input
         Triggers::TriggerGroupPtr t_inputs;
         std::vector<std::shared_ptr<InputAction>> m_allActions {};
         std::vector<InputAction*> m_currentActions {};
+        InputRecorder m_recorder;
         bool isActionCurrentlyInUse(const std::string& actionId);
         void createInputMap();
         void createGamepadMap();
@@ -118,6 +120,10 @@ namespace obe::Input
         InputButtonMonitorPtr monitor(const std::string& name);
         InputButtonMonitorPtr monitor(InputButton& input);
         void requireRefresh();
+        /**
+         * \brief Get the InputRecorder used to record and replay inputs
+         */
+        InputRecorder& getRecorder();
         /**
          * TODO: Fix this nobind
          * \nobind
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <SFML/Window/Event.hpp>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Input
+{
+    class InputButton;
+    class InputManager;
+
+    /**
+     * \brief Records the inputs of each frame in a file and replays them to
+     *        get the exact same session again (for benchmarks for example)
+     * \note For each frame, a recording stores the delta time, the
+     *       InputButtons whose state changed and the input events of the
+     *       window. InputButtons are stored by name so a recording stays valid
+     *       when the amount of gamepads changes. The seed of Utils::Math is
+     *       stored as well and restored before replaying
+     * \bind{InputRecorder}
+     */
+    class InputRecorder
+    {
+    private:
+        InputManager& m_input;
+        std::string m_path;
+        std::ofstream m_output;
+        std::ifstream m_replay;
+        unsigned int m_seed = 0;
+        std::size_t m_frame = 0;
+        bool m_pendingFrame = false;
+
+        // Content of the current frame
+        Time::TimeUnit m_deltaTime = 0;
+        std::vector<std::uint16_t> m_changes;
+        std::vector<sf::Event> m_events;
+
+        std::vector<InputButton*> m_buttons;
+        std::vector<bool> m_states;
+
+        void writeFrame();
+        bool readFrame();
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit InputRecorder(InputManager& input);
+        ~InputRecorder();
+        InputRecorder(const InputRecorder&) = delete;
+        InputRecorder& operator=(const InputRecorder&) = delete;
+
+        /**
+         * \brief Starts writing the inputs of each frame to a file
+         * \param path Path of the recording file
+         * \param seed Seed given to Utils::Math and stored in the recording
+         */
+        void startRecording(const std::string& path, unsigned int seed);
+        /**
+         * \brief Starts feeding the inputs of a recording instead of the ones
+         *        of the devices
+         * \param path Path of the recording file
+         */
+        void startReplay(const std::string& path);
+        /**
+         * \brief Stops the current recording or replay
+         */
+        void stop();
+        [[nodiscard]] bool isRecording() const;
+        [[nodiscard]] bool isReplaying() const;
+        [[nodiscard]] std::string getPath() const;
+        /**
+         * \brief Get the seed of the current recording or replay
+         */
+        [[nodiscard]] unsigned int getSeed() const;
+        /**
+         * \brief Get the amount of frames recorded or replayed so far
+         */
+        [[nodiscard]] std::size_t getFrame() const;
+
+        /**
+         * \nobind
+         * \brief Starts a new recorded frame
+         * \param deltaTime Duration of the frame (in seconds)
+         */
+        void recordFrame(Time::TimeUnit deltaTime);
+        /**
+         * \nobind
+         * \brief Loads the next frame of the replay
+         * \param deltaTime Receives the duration of the frame (in seconds)
+         * \return false if the recording has no frame left, the replay is then
+         *         stopped
+         */
+        bool replayFrame(Time::TimeUnit& deltaTime);
+        /**
+         * \nobind
+         * \brief Adds a window event to the recorded frame, events that are not
+         *        related to inputs are ignored
+         */
+        void recordEvent(const sf::Event& event);
+        /**
+         * \nobind
+         * \brief Get the window events of the replayed frame
+         */
+        [[nodiscard]] const std::vector<sf::Event>& getReplayedEvents() const;
+        /**
+         * \nobind
+         * \brief Records the InputButtons whose state changed or applies the
+         *        replayed ones (done by the InputManager every frame)
+         */
+        void updateButtons();
+    };
+} // namespace obe::Input
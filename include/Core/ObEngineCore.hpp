@@ -2,5 +2,11 @@
 
 namespace obe
 {
-    void InitEngine(unsigned int surfaceWidth, unsigned int surfaceHeight);
+    /**
+     * \brief Initializes the engine globals without opening any display
+     * \param surfaceWidth Width of the screen surface, when 0 the Engine uses
+     *        the desktop resolution (or the Headless configuration)
+     * \param surfaceHeight Height of the screen surface
+     */
+    void InitEngine(unsigned int surfaceWidth = 0, unsigned int surfaceHeight = 0);
 }
\ No newline at end of file
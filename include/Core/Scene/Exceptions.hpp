@@ -97,6 +97,42 @@ namespace obe::Scene::Exceptions
         }
     };
 
+    class UnknownParticleEmitter : public Exception
+    {
+    public:
+        UnknownParticleEmitter(std::string_view sceneFile, std::string_view emitterId,
+            const std::vector<std::string>& allEmittersIds, DebugInfo info)
+            : Exception("UnknownParticleEmitter", info)
+        {
+            this->error("ParticleEmitter with id '{}' does not exists inside Scene '{}'",
+                emitterId, sceneFile);
+            std::vector<std::string> suggestions
+                = Utils::String::sortByDistance(emitterId.data(), allEmittersIds, 5);
+            std::transform(suggestions.begin(), suggestions.end(), suggestions.begin(),
+                Utils::String::quote);
+            this->hint("Try one of the ParticleEmitters with id ({}...)",
+                fmt::join(suggestions, ", "));
+        }
+    };
+
+    class UnknownTileLayer : public Exception
+    {
+    public:
+        UnknownTileLayer(std::string_view sceneFile, std::string_view layerId,
+            const std::vector<std::string>& allLayersIds, DebugInfo info)
+            : Exception("UnknownTileLayer", info)
+        {
+            this->error("TileLayer with id '{}' does not exists inside Scene '{}'",
+                layerId, sceneFile);
+            std::vector<std::string> suggestions
+                = Utils::String::sortByDistance(layerId.data(), allLayersIds, 5);
+            std::transform(suggestions.begin(), suggestions.end(), suggestions.begin(),
+                Utils::String::quote);
+            this->hint("Try one of the TileLayers with id ({}...)",
+                fmt::join(suggestions, ", "));
+        }
+    };
+
     class SceneScriptLoadingError : public Exception
     {
     public:
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <Collision/PolygonalCollider.hpp>
+#include <Graphics/ParticleEmitter.hpp>
+#include <Graphics/TileLayer.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Scene/Camera.hpp>
 #include <Scene/SceneNode.hpp>
@@ -39,6 +41,9 @@ namespace obe::Scene
         Engine::ResourceManager* m_resources = nullptr;
         std::vector<std::unique_ptr<Graphics::Sprite>> m_spriteArray;
         std::vector<std::unique_ptr<Collision::PolygonalCollider>> m_colliderArray;
+        std::vector<std::unique_ptr<Graphics::ParticleEmitter>> m_particleEmitterArray;
+        std::vector<std::unique_ptr<Graphics::TileLayer>> m_tileLayerArray;
+        std::vector<Graphics::Renderable*> m_renderables;
         std::vector<std::unique_ptr<Script::GameObject>> m_gameObjectArray;
         std::vector<std::string> m_scriptArray;
         SceneNode m_sceneRoot;
@@ -50,6 +55,12 @@ namespace obe::Scene
         Triggers::TriggerGroupPtr t_scene;
         sol::state_view m_lua;
 
+        /**
+         * \brief Regenerates the Colliders of the TileLayers whose solid
+         *        tiles changed
+         */
+        void updateTileLayerColliders();
+
     public:
         /**
          * \brief Creates a new Scene
@@ -79,6 +90,10 @@ namespace obe::Scene
          */
         void setFutureLoadFromFile(
             const std::string& path, const OnSceneLoadCallback& callback);
+        /**
+         * \brief Check if a Scene will be loaded at the next update
+         */
+        [[nodiscard]] bool hasFutureLoad() const;
         /**
          * \brief Removes all elements in the Scene
          */
@@ -273,6 +288,76 @@ namespace obe::Scene
         void removeCollider(const std::string& id);
         SceneNode& getSceneRootNode();
 
+        // ParticleEmitters
+        /**
+         * \brief Creates a new ParticleEmitter
+         * \param id Id of the new ParticleEmitter
+         * \return A reference to the newly created ParticleEmitter
+         */
+        Graphics::ParticleEmitter& createParticleEmitter(const std::string& id = "");
+        /**
+         * \brief Get how many ParticleEmitters are present in the Scene
+         * \return The amount of ParticleEmitters in the Scene
+         */
+        [[nodiscard]] std::size_t getParticleEmitterAmount() const;
+        /**
+         * \brief Get all the ParticleEmitters present in the Scene
+         * \return A std::vector of ParticleEmitters pointer
+         */
+        std::vector<Graphics::ParticleEmitter*> getAllParticleEmitters();
+        /**
+         * \brief Get a ParticleEmitter by Id (Raises an exception if not found)
+         * \param id Id of the ParticleEmitter to get
+         * \return A reference to the ParticleEmitter
+         */
+        Graphics::ParticleEmitter& getParticleEmitter(const std::string& id);
+        /**
+         * \brief Check if a ParticleEmitter exists in the Scene
+         * \param id Id of the ParticleEmitter to check the existence
+         * \return true if the ParticleEmitter exists in the Scene, false otherwise
+         */
+        bool doesParticleEmitterExists(const std::string& id);
+        /**
+         * \brief Removes the ParticleEmitter with the given Id
+         * \param id Id of the ParticleEmitter to remove
+         */
+        void removeParticleEmitter(const std::string& id);
+
+        // TileLayers
+        /**
+         * \brief Creates a new TileLayer
+         * \param id Id of the new TileLayer
+         * \return A reference to the newly created TileLayer
+         */
+        Graphics::TileLayer& createTileLayer(const std::string& id = "");
+        /**
+         * \brief Get how many TileLayers are present in the Scene
+         * \return The amount of TileLayers in the Scene
+         */
+        [[nodiscard]] std::size_t getTileLayerAmount() const;
+        /**
+         * \brief Get all the TileLayers present in the Scene
+         * \return A std::vector of TileLayers pointer
+         */
+        std::vector<Graphics::TileLayer*> getAllTileLayers();
+        /**
+         * \brief Get a TileLayer by Id (Raises an exception if not found)
+         * \param id Id of the TileLayer to get
+         * \return A reference to the TileLayer
+         */
+        Graphics::TileLayer& getTileLayer(const std::string& id);
+        /**
+         * \brief Check if a TileLayer exists in the Scene
+         * \param id Id of the TileLayer to check the existence
+         * \return true if the TileLayer exists in the Scene, false otherwise
+         */
+        bool doesTileLayerExists(const std::string& id);
+        /**
+         * \brief Removes the TileLayer with the given Id and its Colliders
+         * \param id Id of the TileLayer to remove
+         */
+        void removeTileLayer(const std::string& id);
+
         // Other
         /**
          * \brief Folder where was the map loaded with loadFromFile method
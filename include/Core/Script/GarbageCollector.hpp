@@ -0,0 +1,162 @@
+#pragma once
+
+#include <chrono>
+
+#include <sol/sol.hpp>
+#include <vili/node.hpp>
+
+namespace obe::Script
+{
+    /**
+     * \brief Strategy used to collect the garbage of the Lua state
+     */
+    enum class GarbageCollectorMode
+    {
+        /**
+         * \brief A full collection is done every frame
+         */
+        Full,
+        /**
+         * \brief The automatic collector is stopped and the collection is done
+         *        in small steps, within a time budget, at the end of each frame.
+         *        Without heap limit, the automatic collector keeps running and
+         *        the budgeted steps come on top of it
+         */
+        Incremental,
+        /**
+         * \brief The Lua generational collector runs on its own, frequent minor
+         *        collections only traverse recently created objects
+         */
+        Generational
+    };
+
+    /**
+     * \brief Garbage collection work done during one frame
+     */
+    struct GarbageCollectorStats
+    {
+        /**
+         * \brief Time spent collecting garbage (in milliseconds)
+         */
+        double collectionTime = 0;
+        /**
+         * \brief Memory used by the Lua state after the collection (in kilobytes)
+         */
+        double heapSize = 0;
+        /**
+         * \brief Amount of incremental steps done
+         */
+        std::size_t steps = 0;
+        /**
+         * \brief Amount of collection cycles completed
+         */
+        std::size_t cycles = 0;
+        /**
+         * \brief Whether a full collection has been done
+         */
+        bool fullCollection = false;
+    };
+
+    /**
+     * \brief Schedules the garbage collection of the Lua state so its cost is
+     *        spread across frames instead of stalling a frame
+     */
+    class GarbageCollector
+    {
+    private:
+        sol::state_view m_lua;
+        GarbageCollectorMode m_mode = GarbageCollectorMode::Incremental;
+        double m_timeBudget = 1;
+        int m_stepSize = 0;
+        double m_heapLimit = 65536;
+        double m_heapGrowth = 2;
+        // Heap size forcing a full collection, follows the live heap size
+        double m_heapThreshold = 0;
+        bool m_collectOnSceneChange = true;
+        bool m_sceneChanged = false;
+        std::size_t m_forcedCollections = 0;
+        std::chrono::steady_clock::time_point m_lastWarning;
+        GarbageCollectorStats m_lastFrame;
+
+        void applyMode() const;
+        void fullCollection(GarbageCollectorStats& stats);
+        void updateHeapThreshold();
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit GarbageCollector(sol::state_view lua);
+
+        /**
+         * \nobind
+         * \brief Configures the collector from the 'Script.garbageCollector'
+         *        block of the engine configuration
+         */
+        void configure(const vili::node& config);
+
+        void setMode(GarbageCollectorMode mode);
+        [[nodiscard]] GarbageCollectorMode getMode() const;
+        /**
+         * \brief Sets the maximum time spent in incremental steps each frame
+         * \param budget Budget in milliseconds, 0 does a single step per frame
+         */
+        void setTimeBudget(double budget);
+        [[nodiscard]] double getTimeBudget() const;
+        /**
+         * \brief Sets the amount of memory traversed by each incremental step
+         * \param size Size in kilobytes, 0 lets Lua pick the size of a basic step
+         */
+        void setStepSize(int size);
+        [[nodiscard]] int getStepSize() const;
+        /**
+         * \brief Sets the minimum heap size above which a full collection is
+         *        forced when the incremental steps can't keep up
+         * \param limit Limit in kilobytes, 0 disables the limit and lets the
+         *        automatic collector run alongside the incremental steps
+         * \note After each collection cycle the limit rises to the remaining
+         *       heap size multiplied by the heap growth
+         */
+        void setHeapLimit(double limit);
+        [[nodiscard]] double getHeapLimit() const;
+        /**
+         * \brief Sets how much the heap can grow after a collection cycle
+         *        before a full collection is forced
+         * \param growth Factor applied to the heap size left by the last
+         *        cycle, like the pause of the Lua collector (2 waits for the
+         *        heap to double)
+         */
+        void setHeapGrowth(double growth);
+        [[nodiscard]] double getHeapGrowth() const;
+        /**
+         * \brief Enables or disables the full collection done when a new
+         *        Scene is loaded
+         */
+        void setCollectOnSceneChange(bool collect);
+        [[nodiscard]] bool getCollectOnSceneChange() const;
+
+        /**
+         * \nobind
+         * \brief Notifies the collector that a new Scene has been loaded
+         */
+        void notifySceneChange();
+        /**
+         * \nobind
+         * \brief Spends the garbage collection budget of the current frame
+         */
+        void update();
+        /**
+         * \brief Immediately does a full collection
+         */
+        void collect();
+
+        /**
+         * \brief Get the memory used by the Lua state (in kilobytes)
+         */
+        [[nodiscard]] double getHeapSize() const;
+        /**
+         * \brief Get the garbage collection work done during the last frame
+         */
+        [[nodiscard]] const GarbageCollectorStats& getLastFrameStats() const;
+    };
+} // namespace obe::Script
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -8,6 +9,8 @@
 
 #include <Graphics/Color.hpp>
 #include <Graphics/RenderTarget.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
 #include <Transform/UnitVector.hpp>
 
 namespace obe::System
@@ -27,8 +30,19 @@ namespace obe::System
         std::string m_title;
         sf::RenderWindow m_window;
         Graphics::Color m_background = Graphics::Color(0, 0, 0);
+        bool m_software = false;
+        bool m_softwareOpen = false;
+        Graphics::SoftwareRenderTarget m_softwareTarget;
+        bool m_useRenderThread = false;
+        std::unique_ptr<Graphics::RenderThread> m_renderThread;
 
     public:
+        /**
+         * \brief Creates a Window using its configuration, the window is
+         *        replaced by a CPU framebuffer when 'renderer' is "software"
+         *        and draw calls are executed on a dedicated thread when
+         *        'renderThread' is true
+         */
         explicit Window(vili::node configuration);
         void create();
         void clear();
@@ -55,6 +69,20 @@ namespace obe::System
 
         Graphics::RenderTarget getTarget();
         sf::RenderWindow& getWindow();
+        /**
+         * \brief Check if the Window renders into a CPU framebuffer
+         *        instead of an OpenGL window
+         */
+        [[nodiscard]] bool isSoftware() const;
+        /**
+         * \brief Get the framebuffer used when the software renderer is selected
+         */
+        Graphics::SoftwareRenderTarget& getSoftwareTarget();
+        /**
+         * \brief Check if draw calls are recorded and executed by a dedicated
+         *        render thread
+         */
+        [[nodiscard]] bool isRenderThreadEnabled() const;
 
         [[nodiscard]] Graphics::Color getClearColor() const;
         void setClearColor(Graphics::Color color);
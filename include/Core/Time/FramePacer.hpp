@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Time
+{
+    /**
+     * \brief Waits for evenly spaced frame deadlines
+     * \note The thread sleeps until the deadline is close then spins for the
+     *       remaining time, sleeping alone usually wakes up too late
+     */
+    class FramePacer
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+        Clock::duration m_interval;
+        Clock::duration m_tolerance;
+        Clock::time_point m_deadline;
+        bool m_started = false;
+
+        void advance(Clock::time_point now);
+
+    public:
+        /**
+         * \param interval Time between two deadlines (in seconds)
+         * \param tolerance Time before a deadline where the thread stops
+         *        sleeping and spins instead (in seconds)
+         */
+        explicit FramePacer(
+            TimeUnit interval = 1.0 / 60.0, TimeUnit tolerance = 2 * milliseconds);
+
+        void setInterval(TimeUnit interval);
+        [[nodiscard]] TimeUnit getInterval() const;
+        void setTolerance(TimeUnit tolerance);
+        [[nodiscard]] TimeUnit getTolerance() const;
+
+        /**
+         * \brief Blocks until the next deadline
+         * \return Time elapsed between the deadline and the end of the wait
+         *         (in seconds)
+         */
+        TimeUnit wait();
+        /**
+         * \brief Checks if the next deadline has been reached without blocking,
+         *        the following deadline is scheduled if it has
+         */
+        bool poll();
+        /**
+         * \brief Restarts the deadlines from now
+         */
+        void reset();
+    };
+} // namespace obe::Time
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Time
+{
+    /**
+     * \brief Distribution of frame times using fixed width buckets
+     */
+    class FrameTimeHistogram
+    {
+    private:
+        TimeUnit m_bucketWidth;
+        std::vector<std::size_t> m_buckets;
+        std::size_t m_count = 0;
+        TimeUnit m_total = 0;
+        TimeUnit m_min = 0;
+        TimeUnit m_max = 0;
+
+    public:
+        /**
+         * \brief Creates an empty histogram
+         * \param bucketWidth Width of each bucket (in seconds)
+         * \param bucketAmount Amount of buckets, the last bucket also
+         *        contains all times above the range of the histogram
+         */
+        explicit FrameTimeHistogram(TimeUnit bucketWidth = 0.5 * milliseconds,
+            std::size_t bucketAmount = 200);
+
+        /**
+         * \brief Adds a frame time to the histogram
+         * \param time Frame time (in seconds)
+         */
+        void add(TimeUnit time);
+        /**
+         * \brief Removes all recorded frame times
+         */
+        void reset();
+
+        [[nodiscard]] std::size_t getCount() const;
+        [[nodiscard]] TimeUnit getMin() const;
+        [[nodiscard]] TimeUnit getMax() const;
+        [[nodiscard]] TimeUnit getMean() const;
+        /**
+         * \brief Get the frame time under which the given fraction of frames
+         *        are, the result is rounded up to the end of its bucket
+         * \param fraction Value between 0 and 1 (0.99 for the 99th percentile)
+         */
+        [[nodiscard]] TimeUnit getPercentile(double fraction) const;
+        [[nodiscard]] TimeUnit getBucketWidth() const;
+        [[nodiscard]] const std::vector<std::size_t>& getBuckets() const;
+    };
+} // namespace obe::Time
@@ -1,8 +1,9 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/System/Clock.hpp>
 #include <System/Window.hpp>
+#include <Time/FramePacer.hpp>
+#include <Time/FrameTimeHistogram.hpp>
 #include <Time/TimeUtils.hpp>
 
 #include <vili/node.hpp>
@@ -15,34 +16,70 @@ namespace obe::Time
     class FramerateManager
     {
     private:
-        System::Window& m_window;
-        sf::Clock m_deltaClock;
+        System::Window* m_window = nullptr;
+        TimeUnit m_lastFrame = 0;
         double m_deltaTime = 0.0;
         double m_speedCoefficient = 1.0;
-        double m_frameLimiterClock;
         bool m_limitFramerate = false;
-        unsigned int m_framerateTarget;
+        unsigned int m_framerateTarget = 60;
         bool m_vsyncEnabled = true;
-        double m_reqFramerateInterval;
-        int m_currentFrame = 0;
-        int m_frameProgression = 0;
         bool m_needToRender = false;
         bool m_syncUpdateRender = true;
+        FramePacer m_pacer;
+
+        // Fixed timestep
+        TimeUnit m_fixedTimestep = 0;
+        unsigned int m_maxFixedUpdates = 5;
+        unsigned int m_fixedUpdates = 0;
+        TimeUnit m_accumulator = 0;
+
+        // Statistics
+        TimeUnit m_lastRender = 0;
+        bool m_rendered = false;
+        FrameTimeHistogram m_frameTimes;
+        FrameTimeHistogram m_pacingErrors;
+
+        void pace();
+        void startFrame(TimeUnit deltaTime);
 
     public:
         /**
          * \brief Creates a new FramerateManager
          */
         FramerateManager(System::Window& window);
+        /**
+         * \nobind
+         * \brief Creates a FramerateManager without window (headless runs),
+         *        vertical synchronization is then ignored
+         */
+        FramerateManager();
         /**
          * \brief Configures the FramerateManager
          * \param config Configuration of the FramerateManager
          */
         void configure(vili::node& config);
         /**
-         * \brief Updates the FramerateManager (done every time in the main loop)
+         * \brief Updates the FramerateManager (done every time in the main loop),
+         *        this samples the time returned by Time::now() for the frame
+         * \note When the framerate is limited and update is synced to render,
+         *       this waits for the deadline of the next frame
          */
         void update();
+        /**
+         * \nobind
+         * \brief Starts a frame lasting a given amount of time without waiting,
+         *        nothing is rendered (used by the headless mode)
+         * \param deltaTime Simulated duration of the frame (in seconds)
+         */
+        void step(TimeUnit deltaTime);
+        /**
+         * \nobind
+         * \brief Updates the FramerateManager like update() but moves the time
+         *        forward by a given amount instead of measuring it (used to
+         *        replay recorded inputs)
+         * \param deltaTime Duration of the frame (in seconds)
+         */
+        void replay(TimeUnit deltaTime);
         /**
          * \brief Get if the engine should render everything
          * \return true if the engine should render everything, false otherwise
@@ -100,5 +137,50 @@ namespace obe::Time
          *        (true = enabled)
          */
         void setVSyncEnabled(bool vsync);
+        /**
+         * \brief Sets the time before a frame deadline where the engine stops
+         *        sleeping and spins until the deadline
+         * \param tolerance Tolerance in seconds, a larger value wastes more CPU
+         *        time but hits deadlines more accurately
+         */
+        void setPacingTolerance(TimeUnit tolerance);
+        [[nodiscard]] TimeUnit getPacingTolerance() const;
+
+        /**
+         * \brief Enables the fixed timestep update mode
+         * \param timestep Duration of a fixed update (in seconds), 0 disables
+         *        the fixed timestep mode
+         * \param maxUpdates Maximum amount of fixed updates done in a single
+         *        frame, the time left is dropped to avoid falling further behind
+         */
+        void setFixedTimestep(TimeUnit timestep, unsigned int maxUpdates = 5);
+        [[nodiscard]] TimeUnit getFixedTimestep() const;
+        /**
+         * \brief Consumes one fixed timestep of the accumulated frame time, to
+         *        be called in a loop until it returns false
+         * \return true if a fixed update has to be done
+         */
+        bool doFixedUpdate();
+        /**
+         * \brief Get how far the simulation is between the last fixed update
+         *        and the next one, used to interpolate what is rendered
+         * \return A value between 0 and 1 (always 1 when the fixed timestep
+         *         mode is disabled)
+         */
+        [[nodiscard]] double getInterpolationAlpha() const;
+
+        /**
+         * \brief Get the distribution of the time between rendered frames
+         */
+        [[nodiscard]] const FrameTimeHistogram& getFrameTimes() const;
+        /**
+         * \brief Get the distribution of the delays between frame deadlines
+         *        and the time the engine actually woke up
+         */
+        [[nodiscard]] const FrameTimeHistogram& getPacingErrors() const;
+        /**
+         * \brief Removes all recorded frame times
+         */
+        void resetStatistics();
     };
 } // namespace obe::Time
\ No newline at end of file
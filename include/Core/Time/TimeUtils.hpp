@@ -19,6 +19,33 @@ namespace obe::Time
      * \brief Get the amount of seconds elapsed since epoch
      * \return A TimeUnit containing the amount of seconds elapsed since
      *         Epoch
+     * \note This is the wall clock, it can jump when the system time is
+     *       adjusted. Use now() to measure durations
      */
     TimeUnit epoch();
+    /**
+     * \brief Get the time of the current frame, sampled once at the beginning
+     *        of each frame so all objects updated during a frame see the same
+     *        time
+     * \return A monotonic amount of seconds elapsed since the engine started
+     */
+    TimeUnit now();
+    /**
+     * \brief Get the current time, read from the clock on each call
+     * \return A monotonic amount of seconds elapsed since the engine started,
+     *         on the same scale as now()
+     */
+    TimeUnit preciseNow();
+    /**
+     * \nobind
+     * \brief Samples the time returned by now() (done once per frame)
+     */
+    void updateClock();
+    /**
+     * \nobind
+     * \brief Moves the time returned by now() forward by a given amount
+     *        instead of sampling the clock, used to simulate frames faster or
+     *        slower than real time
+     */
+    void advanceClock(TimeUnit elapsed);
 } // namespace obe::Time
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 
 #include <Time/TimeUtils.hpp>
 
@@ -8,6 +10,7 @@ namespace obe::Triggers
 {
     using Callback = std::function<void()>;
     class TriggerManager;
+    class CallbackScheduler;
 
     enum class CallbackSchedulerState
     {
@@ -16,29 +19,84 @@ namespace obe::Triggers
         Done
     };
 
-    class CallbackScheduler
+    /**
+     * \brief Handle to a running CallbackScheduler, it stays valid once the
+     *        CallbackScheduler is done or destroyed
+     */
+    class CallbackHandle
+    {
+    private:
+        std::weak_ptr<CallbackScheduler> m_scheduler;
+
+    public:
+        CallbackHandle() = default;
+        /**
+         * \nobind
+         */
+        explicit CallbackHandle(std::weak_ptr<CallbackScheduler> scheduler);
+        /**
+         * \brief Cancels the scheduled callback, does nothing if it is done
+         */
+        void cancel();
+        /**
+         * \brief Whether the callback will still be called
+         */
+        [[nodiscard]] bool isPending() const;
+    };
+
+    /**
+     * \brief Calls a callback after a delay and / or at a given interval,
+     *        in seconds or in frames
+     * \note A CallbackScheduler waits either in seconds or in frames, calling
+     *       afterFrames or everyFrames switches it to frames
+     */
+    class CallbackScheduler : public std::enable_shared_from_this<CallbackScheduler>
     {
     private:
         Callback m_callback;
         TriggerManager& m_triggers;
         Time::TimeUnit m_after = 0;
         Time::TimeUnit m_every = 0;
-        Time::TimeUnit m_start = 0;
+        std::uint64_t m_afterFrames = 0;
+        std::uint64_t m_everyFrames = 0;
         unsigned int m_times = 0;
         unsigned int m_currentTimes = 0;
         bool m_wait = false;
         bool m_repeat = false;
+        bool m_useFrames = false;
+        // Whether an entry of the TriggerManager refers to the current run
+        bool m_scheduled = false;
+        std::uint64_t m_generation = 0;
         CallbackSchedulerState m_state = CallbackSchedulerState::Standby;
         void execute();
 
+        friend class CallbackHandle;
         friend class TriggerManager;
 
     public:
         explicit CallbackScheduler(TriggerManager& manager);
         CallbackScheduler& after(double amount);
         CallbackScheduler& every(double amount);
+        /**
+         * \brief Waits an amount of frames (TriggerManager updates) before
+         *        the first call
+         */
+        CallbackScheduler& afterFrames(std::uint64_t amount);
+        /**
+         * \brief Calls the callback every given amount of frames
+         */
+        CallbackScheduler& everyFrames(std::uint64_t amount);
+        /**
+         * \brief Limits the amount of calls of a repeated callback (0 for
+         *        no limit)
+         */
         CallbackScheduler& repeat(unsigned int amount);
-        void run(const Callback& callback);
+        /**
+         * \brief Starts waiting for the first call of the callback
+         * \return A handle that can cancel the callback, it is empty if the
+         *         CallbackScheduler wasn't created by a TriggerManager
+         */
+        CallbackHandle run(const Callback& callback);
         void stop();
     };
 }
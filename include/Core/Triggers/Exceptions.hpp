@@ -135,4 +135,15 @@ namespace obe::Triggers::Exceptions
                        "group.setJoinable(true) from its manager");
         }
     };
+
+    class InvalidTriggerParameter : public Exception
+    {
+    public:
+        InvalidTriggerParameter(
+            std::string_view parameter, std::string_view reason, DebugInfo info)
+            : Exception("InvalidTriggerParameter", info)
+        {
+            this->error("Unable to read Trigger parameter '{}' : {}", parameter, reason);
+        }
+    };
 }
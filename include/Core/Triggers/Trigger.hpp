@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Debug/Logger.hpp>
+#include <Triggers/TriggerParameters.hpp>
+#include <Triggers/TriggerQueue.hpp>
+#include <Triggers/TriggerStatistics.hpp>
 #include <sol/sol.hpp>
 #include <utility>
 
@@ -8,6 +11,33 @@ namespace obe::Triggers
 {
     class TriggerGroup;
 
+    /**
+     * \brief How the executions of a Trigger are dispatched when it is fired
+     * \bind{TriggerDispatchMode}
+     */
+    enum class TriggerDispatchMode
+    {
+        /**
+         * \brief Callbacks are executed as soon as the Trigger is fired
+         */
+        Immediate,
+        /**
+         * \brief Each fire is queued with its own parameters until the
+         *        TriggerQueue is drained
+         */
+        Queued,
+        /**
+         * \brief Fires are merged into a single queued execution, the last
+         *        pushed value of each parameter wins
+         */
+        CoalesceLast,
+        /**
+         * \brief Fires are merged into a single queued execution, each
+         *        parameter becomes the list of the values of all fires
+         */
+        CoalesceList
+    };
+
     class TriggerEnv
     {
     public:
@@ -16,6 +46,8 @@ namespace obe::Triggers
         std::string callback;
         bool* active = nullptr;
         sol::protected_function call;
+        // Resolved the first time the callback is accounted
+        TriggerCallbackStats* stats = nullptr;
         TriggerEnv(std::string id, sol::environment environment, std::string callback,
             bool* active)
             : id(std::move(id))
@@ -26,15 +58,58 @@ namespace obe::Triggers
         }
     };
 
+    /**
+     * \brief Callback of a native (C++) Trigger subscriber
+     */
+    using NativeCallback = std::function<void(const TriggerParameters&)>;
+    /**
+     * \brief Identifier returned by Trigger::subscribe, used to unsubscribe
+     */
+    using SubscriptionId = std::size_t;
+
     /**
      * \brief A Class that does represents a triggerable event
+     * \note Lua parameters are only marshalled when a Lua environment is
+     *       registered and native parameters only stored when a native
+     *       subscriber exists. Queued Triggers always store both since
+     *       listeners can be added before the execution
      */
-    class Trigger
+    class Trigger : public std::enable_shared_from_this<Trigger>
     {
     private:
         TriggerGroup& m_parent;
         std::string m_name;
         std::string m_fullName;
+        std::string m_luaTableName;
+        const char* m_profilerZone = nullptr;
+        // Tables of __TRIGGERS resolved once, ArgTable is cleared in place
+        sol::table m_luaTable;
+        sol::table m_argTable;
+        bool m_hasParameters = false;
+        struct NativeSubscriber
+        {
+            SubscriptionId id;
+            NativeCallback callback;
+            bool removed = false;
+        };
+        // Changes made during an execution are applied once it ends
+        std::vector<NativeSubscriber> m_subscribers;
+        std::vector<NativeSubscriber> m_subscribersToAdd;
+        bool m_subscribersToRemove = false;
+        SubscriptionId m_nextSubscription = 0;
+        TriggerParameters m_parameters;
+        TriggerCallbackStats* m_nativeStats = nullptr;
+        void applySubscriberChanges();
+        // Queued dispatch
+        TriggerDispatchMode m_dispatchMode = TriggerDispatchMode::Immediate;
+        bool m_queued = false;
+        sol::table m_accumulatedArgs;
+        TriggerParameters m_accumulatedParameters;
+        std::vector<sol::table> m_spareTables;
+        sol::table takeSpareTable();
+        [[nodiscard]] bool isDispatchDeferred() const;
+        void executeQueued(QueuedTrigger& queued);
+        void dropQueued();
         std::vector<TriggerEnv> m_registeredEnvs;
         std::vector<sol::environment> m_envsToRemove;
         bool m_currentlyTriggered = false;
@@ -43,7 +118,9 @@ namespace obe::Triggers
         std::function<void(const TriggerEnv&)> m_onUnregisterCallback;
         sol::state_view m_lua;
         friend class TriggerGroup;
+        friend class TriggerHandle;
         friend class TriggerManager;
+        friend class TriggerQueue;
 
     protected:
         /**
@@ -63,6 +140,11 @@ namespace obe::Triggers
          * \brief Triggers callbacks
          */
         void execute();
+        /**
+         * \brief Executes the callbacks or queues the execution depending on
+         *        the TriggerDispatchMode
+         */
+        void fire();
         void onRegister(std::function<void(const TriggerEnv&)> callback);
         void onUnregister(std::function<void(const TriggerEnv&)> callback);
 
@@ -112,6 +194,36 @@ namespace obe::Triggers
          * \param environment Lua Environment to unregister
          */
         void unregisterEnvironment(sol::environment environment);
+        /**
+         * \nobind
+         * \brief Adds a C++ callback called each time the Trigger is executed,
+         *        it receives the parameters without going through Lua
+         * \param callback Callback to call
+         * \return Identifier used to unsubscribe
+         */
+        SubscriptionId subscribe(NativeCallback callback);
+        /**
+         * \nobind
+         * \brief Removes a C++ callback added with subscribe
+         * \param subscription Identifier returned by subscribe
+         */
+        void unsubscribe(SubscriptionId subscription);
+        /**
+         * \brief Sets how the executions of the Trigger are dispatched
+         * \note Queued modes need the Trigger to belong to a TriggerGroup
+         *       created by a TriggerManager, it is executed immediately
+         *       otherwise
+         */
+        void setDispatchMode(TriggerDispatchMode mode);
+        [[nodiscard]] TriggerDispatchMode getDispatchMode() const;
+        /**
+         * \brief Get if at least one Lua environment is registered
+         */
+        [[nodiscard]] bool hasLuaListeners() const;
+        /**
+         * \brief Get if at least one C++ callback is subscribed
+         */
+        [[nodiscard]] bool hasNativeListeners() const;
         /**
          * \brief Gets the Lua Table path used to store Trigger Parameters
          * \return The path to the Lua Table used to store Trigger Parameters
@@ -124,9 +236,13 @@ namespace obe::Triggers
     {
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} to Trigger {1}", name, m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
-        /*Script::ScriptEngine["LuaCore"]["TriggerArgTable"][this->getTriggerLuaTableName()]
-                            [name]
-            = parameter;*/
+        const bool deferred = this->isDispatchDeferred();
+        if (deferred || !m_subscribers.empty())
+            m_parameters.set(name, parameter);
+        if (deferred || !m_registeredEnvs.empty())
+        {
+            m_argTable[name] = parameter;
+            m_hasParameters = true;
+        }
     }
 } // namespace obe::Triggers
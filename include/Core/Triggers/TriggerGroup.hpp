@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Triggers/Trigger.hpp>
+#include <Triggers/TriggerHandle.hpp>
 #include <map>
 #include <memory>
 #include <sol/sol.hpp>
@@ -17,6 +18,8 @@ namespace obe::Triggers
         std::string m_fromNsp;
         std::map<std::string, std::shared_ptr<Trigger>> m_triggerMap;
         bool m_joinable = false;
+        TriggerQueue* m_queue = nullptr;
+        TriggerStatistics* m_statistics = nullptr;
         sol::state_view m_lua;
         friend class Trigger;
         friend class TriggerManager;
@@ -49,6 +52,13 @@ namespace obe::Triggers
          * \return A pointer to the Trigger if found (throws an error otherwise)
          */
         std::weak_ptr<Trigger> get(const std::string& triggerName);
+        /**
+         * \nobind
+         * \brief Get a handle to fire a Trigger without looking it up again
+         * \param triggerName Name of the Trigger to resolve
+         * \return A TriggerHandle to the Trigger (throws an error if not found)
+         */
+        TriggerHandle getHandle(const std::string& triggerName);
         /**
          * \brief Creates a new Trigger in the TriggerGroup
          * \param triggerName Name of the Trigger to create
@@ -62,11 +72,20 @@ namespace obe::Triggers
          */
         TriggerGroup& remove(const std::string& triggerName);
         /**
-         * \brief Enables a Trigger
-         * \param triggerName Name of the Trigger to enable
+         * \brief Executes the callbacks of a Trigger (or queues the execution
+         *        if the Trigger uses a queued TriggerDispatchMode)
+         * \param triggerName Name of the Trigger to execute
          * \return Pointer to the TriggerGroup to chain calls
          */
         TriggerGroup& trigger(const std::string& triggerName);
+        /**
+         * \brief Sets how the executions of a Trigger are dispatched
+         * \param triggerName Name of the Trigger
+         * \param mode Dispatch mode of the Trigger
+         * \return Pointer to the TriggerGroup to chain calls
+         */
+        TriggerGroup& setDispatchMode(
+            const std::string& triggerName, TriggerDispatchMode mode);
         /**
          * \brief Pushes a Parameter to a Trigger
          * \tparam P Type of the Parameter
@@ -85,6 +104,21 @@ namespace obe::Triggers
          */
         void pushParameterFromLua(const std::string& triggerName,
             const std::string& parameterName, sol::object parameter);
+        /**
+         * \nobind
+         * \brief Adds a C++ callback to a Trigger (see Trigger::subscribe)
+         * \param triggerName Name of the Trigger to subscribe to
+         * \param callback Callback called with the parameters of the Trigger
+         * \return Identifier used to unsubscribe
+         */
+        SubscriptionId subscribe(const std::string& triggerName, NativeCallback callback);
+        /**
+         * \nobind
+         * \brief Removes a C++ callback from a Trigger
+         * \param triggerName Name of the Trigger the callback was added to
+         * \param subscription Identifier returned by subscribe
+         */
+        void unsubscribe(const std::string& triggerName, SubscriptionId subscription);
         /**
          * \brief Get the name of all Trigger contained in the TriggerGroup
          * \return A std::vector of std::string containing the name of all
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+
+#include <Triggers/Trigger.hpp>
+
+namespace obe::Triggers
+{
+    /**
+     * \brief A Trigger resolved once, used to fire frequent Triggers without
+     *        looking them up by name each time
+     * \note The handle keeps the Trigger alive, it stays usable even when the
+     *       Trigger is removed from its TriggerGroup
+     */
+    class TriggerHandle
+    {
+    private:
+        std::shared_ptr<Trigger> m_trigger;
+
+    public:
+        TriggerHandle() = default;
+        explicit TriggerHandle(std::shared_ptr<Trigger> trigger);
+        /**
+         * \brief Pushes a Parameter to the Trigger
+         * \tparam P Type of the Parameter
+         * \param name Name of the parameter
+         * \param parameter Value of the parameter
+         * \return A reference to the TriggerHandle (to chain calls)
+         */
+        template <typename P>
+        TriggerHandle& pushParameter(const std::string& name, P parameter);
+        /**
+         * \brief Executes the callbacks of the Trigger (or queues the
+         *        execution, see TriggerDispatchMode)
+         */
+        void trigger() const;
+        /**
+         * \brief Get the resolved Trigger (nullptr if the handle is empty)
+         */
+        [[nodiscard]] Trigger* get() const;
+        explicit operator bool() const;
+    };
+
+    template <typename P>
+    TriggerHandle& TriggerHandle::pushParameter(const std::string& name, P parameter)
+    {
+        m_trigger->pushParameter(name, parameter);
+        return *this;
+    }
+} // namespace obe::Triggers
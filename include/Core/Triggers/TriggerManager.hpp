@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include <Time/Chronometer.hpp>
 #include <Triggers/CallbackScheduler.hpp>
 #include <Triggers/Trigger.hpp>
 #include <Triggers/TriggerGroup.hpp>
+#include <Triggers/TriggerQueue.hpp>
+#include <Triggers/TriggerStatistics.hpp>
 
 namespace obe::Triggers
 {
@@ -17,10 +22,44 @@ namespace obe::Triggers
     private:
         std::map<std::string, std::map<std::string, std::weak_ptr<TriggerGroup>>>
             m_allTriggers;
-        std::vector<std::unique_ptr<CallbackScheduler>> m_schedulers;
+        /**
+         * \brief A run of a CallbackScheduler waiting for its due time
+         */
+        struct ScheduledCallback
+        {
+            /**
+             * \brief Due time in seconds, or due frame for the frame timers
+             */
+            Time::TimeUnit due;
+            std::uint64_t order;
+            std::uint64_t generation;
+            std::shared_ptr<CallbackScheduler> scheduler;
+        };
+        // CallbackSchedulers created but not started yet
+        std::vector<std::shared_ptr<CallbackScheduler>> m_standby;
+        // Min-heaps on the due time / frame, cancelled entries are skipped
+        // when popped and purged once they make up half of the heaps
+        std::vector<ScheduledCallback> m_timers;
+        std::vector<ScheduledCallback> m_frameTimers;
+        std::vector<ScheduledCallback> m_expired;
+        std::size_t m_staleTimers = 0;
+        std::uint64_t m_order = 0;
+        std::uint64_t m_frame = 0;
+        TriggerQueue m_queue;
+        TriggerStatistics m_statistics;
         Time::Chronometer m_databaseChrono;
         sol::state_view m_lua;
 
+        void start(std::shared_ptr<CallbackScheduler> scheduler);
+        void enqueue(std::shared_ptr<CallbackScheduler> scheduler, bool first);
+        void unschedule(CallbackScheduler& scheduler);
+        void popExpired(std::vector<ScheduledCallback>& timers, Time::TimeUnit until);
+        void purgeStaleTimers();
+        static bool isCurrentRun(
+            const CallbackScheduler& scheduler, std::uint64_t generation);
+
+        friend class CallbackScheduler;
+
     public:
         explicit TriggerManager(sol::state_view lua);
         /**
@@ -94,14 +133,40 @@ namespace obe::Triggers
          */
         bool doesTriggerGroupExists(const std::string& space, const std::string& group);
         /**
-         * \brief Updates the TriggerManager
+         * \brief Updates the TriggerManager, calls the scheduled callbacks
+         *        that are due (the cost only depends on their amount)
          */
         void update();
         /**
          * \brief Clears the TriggerManager
+         * \note Scheduled callbacks are cancelled, CallbackSchedulers that
+         *       are not started yet are kept
          */
         void clear();
 
+        /**
+         * \brief Creates a CallbackScheduler, its callback is scheduled once
+         *        CallbackScheduler::run is called
+         */
         CallbackScheduler& schedule();
+        /**
+         * \brief Get the amount of scheduled callbacks waiting to be called
+         */
+        [[nodiscard]] std::size_t getScheduledAmount() const;
+        /**
+         * \brief Get the amount of updates done by the TriggerManager, used
+         *        by the CallbackSchedulers waiting in frames
+         */
+        [[nodiscard]] std::uint64_t getFrame() const;
+        /**
+         * \brief Get the queue of the Triggers using a queued
+         *        TriggerDispatchMode (drained by the engine during its update)
+         */
+        TriggerQueue& getQueue();
+        /**
+         * \brief Get the execution time accounting of the Trigger callbacks
+         *        (disabled by default)
+         */
+        TriggerStatistics& getStatistics();
     };
 } // namespace obe::Triggers
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <any>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Triggers/Exceptions.hpp>
+
+namespace obe::Triggers
+{
+    /**
+     * \brief Parameters of a Trigger execution given to native subscribers,
+     *        values keep the C++ type they were pushed with
+     */
+    class TriggerParameters
+    {
+    private:
+        std::vector<std::pair<std::string, std::any>> m_parameters;
+
+    public:
+        /**
+         * \brief Sets the value of a parameter (replaces it if it already exists)
+         * \note C strings are stored as std::string
+         * \param name Name of the parameter
+         * \param value Value of the parameter
+         */
+        template <typename P> void set(std::string_view name, P value);
+        /**
+         * \brief Get a parameter if it exists and has the given type
+         * \return A pointer to the value of the parameter, nullptr otherwise
+         */
+        template <typename P> [[nodiscard]] const P* find(std::string_view name) const;
+        /**
+         * \brief Get a parameter, throws if it does not exist or if it was not
+         *        pushed with the given type
+         */
+        template <typename P> [[nodiscard]] const P& get(std::string_view name) const;
+        /**
+         * \brief Appends the parameters of another execution, each parameter
+         *        becomes a std::vector<std::any> of all its values
+         */
+        void accumulate(const TriggerParameters& other);
+        [[nodiscard]] bool contains(std::string_view name) const;
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] bool empty() const;
+        void clear();
+    };
+
+    template <typename P> void TriggerParameters::set(std::string_view name, P value)
+    {
+        using Stored
+            = std::conditional_t<std::is_convertible_v<P, const char*>, std::string, P>;
+        for (auto& [parameterName, parameter] : m_parameters)
+        {
+            if (parameterName == name)
+            {
+                parameter = Stored(std::move(value));
+                return;
+            }
+        }
+        m_parameters.emplace_back(std::string(name), Stored(std::move(value)));
+    }
+
+    template <typename P>
+    const P* TriggerParameters::find(std::string_view name) const
+    {
+        for (const auto& [parameterName, parameter] : m_parameters)
+        {
+            if (parameterName == name)
+                return std::any_cast<P>(&parameter);
+        }
+        return nullptr;
+    }
+
+    template <typename P>
+    const P& TriggerParameters::get(std::string_view name) const
+    {
+        if (const P* value = this->find<P>(name))
+            return *value;
+        throw Exceptions::InvalidTriggerParameter(name,
+            (this->contains(name)) ? "pushed with another type" : "not pushed",
+            EXC_INFO);
+    }
+} // namespace obe::Triggers
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <sol/sol.hpp>
+
+#include <Time/TimeUtils.hpp>
+#include <Triggers/TriggerParameters.hpp>
+
+namespace obe::Triggers
+{
+    class Trigger;
+
+    /**
+     * \nobind
+     * \brief A Trigger execution waiting in a TriggerQueue with the parameters
+     *        it was fired with
+     */
+    struct QueuedTrigger
+    {
+        std::shared_ptr<Trigger> trigger;
+        /**
+         * \brief Whether arguments and parameters were captured at fire time,
+         *        otherwise the ones currently pushed to the Trigger are used
+         */
+        bool snapshot = false;
+        sol::table arguments;
+        TriggerParameters parameters;
+    };
+
+    /**
+     * \brief Metrics of a TriggerQueue since its last reset
+     */
+    struct TriggerQueueStats
+    {
+        /**
+         * \brief Amount of Trigger fires that went through the queue
+         */
+        std::size_t fired = 0;
+        /**
+         * \brief Amount of fires merged into an already queued execution
+         */
+        std::size_t coalesced = 0;
+        /**
+         * \brief Amount of Trigger executions done while draining
+         */
+        std::size_t executed = 0;
+        std::size_t drains = 0;
+        /**
+         * \brief Amount of executions waiting when the queue was last drained
+         */
+        std::size_t lastDepth = 0;
+        std::size_t maxDepth = 0;
+        Time::TimeUnit lastDrainTime = 0;
+        Time::TimeUnit maxDrainTime = 0;
+        Time::TimeUnit totalDrainTime = 0;
+    };
+
+    /**
+     * \brief Executions of the Triggers using a queued TriggerDispatchMode,
+     *        they run when the queue is drained instead of when fired
+     */
+    class TriggerQueue
+    {
+    private:
+        std::vector<QueuedTrigger> m_queue;
+        std::vector<QueuedTrigger> m_draining;
+        bool m_isDraining = false;
+        TriggerQueueStats m_stats;
+
+    public:
+        /**
+         * \nobind
+         */
+        void push(QueuedTrigger queued);
+        /**
+         * \nobind
+         */
+        void countCoalesced();
+        /**
+         * \brief Executes all Triggers queued before the call, the ones queued
+         *        by their callbacks wait for the next drain
+         * \return The amount of executed Triggers
+         */
+        std::size_t drain();
+        [[nodiscard]] std::size_t getSize() const;
+        [[nodiscard]] const TriggerQueueStats& getStats() const;
+        void resetStats();
+        /**
+         * \brief Drops all queued executions
+         */
+        void clear();
+    };
+} // namespace obe::Triggers
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Triggers
+{
+    /**
+     * \brief Accounting of the callbacks of one Lua environment (or of all
+     *        the native subscribers) for one Trigger
+     * \note Times include the Triggers executed by the callback itself
+     */
+    struct TriggerCallbackStats
+    {
+        /**
+         * \brief Full name of the Trigger (Namespace.Group.Name)
+         */
+        std::string trigger;
+        /**
+         * \brief Id of the Lua environment, NativeEnvironmentId for the
+         *        native subscribers
+         */
+        std::string environment;
+        std::size_t calls = 0;
+        Time::TimeUnit totalTime = 0;
+        Time::TimeUnit maxTime = 0;
+        Time::TimeUnit lastTime = 0;
+    };
+
+    /**
+     * \brief Execution time of the Trigger callbacks, for each pair of
+     *        Trigger and environment id
+     * \note Accounting is disabled by default, Trigger::execute only checks a
+     *       flag when it is
+     */
+    class TriggerStatistics
+    {
+    private:
+        bool m_enabled = false;
+        // Entries are never erased so Triggers can keep pointers to them
+        std::map<std::pair<std::string, std::string>, TriggerCallbackStats> m_stats;
+
+    public:
+        /**
+         * \brief Environment id used for the native subscribers of a Trigger
+         */
+        static constexpr const char* NativeEnvironmentId = "<native>";
+
+        void setEnabled(bool enabled);
+        [[nodiscard]] bool isEnabled() const;
+        /**
+         * \nobind
+         * \brief Get the accounting entry of a Trigger / environment pair,
+         *        creates it if needed
+         */
+        TriggerCallbackStats& get(
+            const std::string& trigger, const std::string& environment);
+        /**
+         * \nobind
+         * \brief Adds an execution of a callback to its entry
+         */
+        static void record(TriggerCallbackStats& stats, Time::TimeUnit elapsed);
+        /**
+         * \brief Get the entries with the highest total execution time
+         * \param count Maximum amount of entries (0 for all of them)
+         * \return The entries sorted by decreasing total execution time
+         */
+        [[nodiscard]] std::vector<TriggerCallbackStats> getTop(
+            std::size_t count = 0) const;
+        /**
+         * \brief Logs the entries with the highest total execution time
+         * \param count Maximum amount of entries (0 for all of them)
+         */
+        void dump(std::size_t count = 10) const;
+        /**
+         * \brief Resets the accounting of all entries
+         */
+        void reset();
+    };
+} // namespace obe::Triggers
@@ -1,6 +1,14 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
 #include <string>
+#include <thread>
+#include <vector>
 
 /**
  * \brief Some Classes and Functions to manipulate Engine Execution
@@ -37,4 +45,99 @@ namespace obe::Utils::Exec
          */
         [[nodiscard]] std::string getArgumentValue(const std::string& arg) const;
     };
+
+    /**
+     * \brief Fixed set of worker threads executing submitted tasks in order
+     */
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread> m_workers;
+        std::queue<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping = false;
+
+        void work();
+
+    public:
+        /**
+         * \brief Creates a ThreadPool and starts its workers
+         * \param workers Amount of worker threads (at least one worker is started)
+         */
+        explicit ThreadPool(unsigned int workers);
+        /**
+         * \brief Discards the tasks that are not started yet and joins all workers
+         */
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        /**
+         * \brief Queues a task to be executed by the first available worker
+         * \param task Task to execute
+         */
+        void submit(std::function<void()> task);
+        /**
+         * \brief Get the amount of worker threads
+         * \return The amount of worker threads of the ThreadPool
+         */
+        [[nodiscard]] std::size_t getWorkerCount() const;
+    };
+
+    /**
+     * \nobind
+     * \brief Three buffers exchanged without locks between one producer thread
+     *        and one consumer thread, the consumer always gets the most recent
+     *        buffer published by the producer and neither of them ever waits
+     */
+    template <class T> class TripleBuffer
+    {
+    private:
+        static constexpr unsigned int FreshBit = 4;
+        std::array<T, 3> m_buffers;
+        unsigned int m_write = 0;
+        unsigned int m_read = 1;
+        std::atomic<unsigned int> m_middle { 2 };
+
+    public:
+        /**
+         * \brief Get the buffer owned by the producer
+         */
+        T& getWriteBuffer()
+        {
+            return m_buffers[m_write];
+        }
+        /**
+         * \brief Hands the write buffer to the consumer, the producer gets
+         *        another buffer to write in
+         * \return false if the previously published buffer was never acquired
+         *         by the consumer (it has been dropped)
+         */
+        bool publish()
+        {
+            const unsigned int previous
+                = m_middle.exchange(m_write | FreshBit, std::memory_order_acq_rel);
+            m_write = previous & ~FreshBit;
+            return !(previous & FreshBit);
+        }
+        /**
+         * \brief Takes the most recently published buffer
+         * \return false if nothing has been published since the last call, the
+         *         read buffer is then left unchanged
+         */
+        bool acquire()
+        {
+            if (!(m_middle.load(std::memory_order_acquire) & FreshBit))
+                return false;
+            m_read = m_middle.exchange(m_read, std::memory_order_acq_rel) & ~FreshBit;
+            return true;
+        }
+        /**
+         * \brief Get the buffer owned by the consumer
+         */
+        T& getReadBuffer()
+        {
+            return m_buffers[m_read];
+        }
+    };
 } // namespace obe::Utils::Exec
\ No newline at end of file
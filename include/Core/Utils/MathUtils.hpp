@@ -19,6 +19,17 @@ namespace obe::Utils::Math
      * \return A random double between 0.0 and 1.0
      */
     double randfloat();
+    /**
+     * \brief Reseeds the generator used by randint and randfloat, the same seed
+     *        always produces the same sequence of numbers
+     * \param seed New seed of the generator
+     */
+    void setSeed(unsigned int seed);
+    /**
+     * \brief Get the last seed given to the random generator
+     * \return The seed given to setSeed or the one picked at startup
+     */
+    unsigned int getSeed();
     /**
      * \brief Get the lowest value between the two given values
      * \tparam N Type of both values
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <vili/node.hpp>
+
 namespace obe::Modes
 {
     /**
      * \brief Start the game by loading the boot.lua file in one of the
      * MountedPaths
+     * \param configOverrides Configuration values replacing the ones of the
+     *        configuration files
      */
-    void startGame();
+    void startGame(const vili::node& configOverrides = vili::object {});
 } // namespace obe::Modes
\ No newline at end of file
@@ -352,9 +352,9 @@ namespace obe::Animation
         {
             const Time::TimeUnit delay = (m_sleep) ? m_sleep : m_delay;
             Debug::Log->trace("<Animation> Delay is {} seconds", delay);
-            if (Time::epoch() - m_clock > delay)
+            if (Time::now() - m_clock > delay)
             {
-                m_clock = Time::epoch();
+                m_clock = Time::now();
                 m_sleep = 0;
                 Debug::Log->trace("<Animation> Updating Animation '{0}'", m_name);
 
@@ -213,7 +213,9 @@ namespace obe::Bindings
             .add("ClassResourceManagedObject",
                 &obe::Engine::Bindings::LoadClassResourceManagedObject)
             .add(
-                "ClassResourceManager", &obe::Engine::Bindings::LoadClassResourceManager);
+                "ClassResourceManager", &obe::Engine::Bindings::LoadClassResourceManager)
+            .add("ClassTextureCacheStats",
+                &obe::Engine::Bindings::LoadClassTextureCacheStats);
 
         BindTree["obe"]["Engine"]["Exceptions"]
             .add("ClassBootScriptExecutionError",
@@ -253,16 +255,25 @@ namespace obe::Bindings
         BindTree["obe"]["Graphics"]
             .add("ClassColor", &obe::Graphics::Bindings::LoadClassColor)
             .add("ClassFont", &obe::Graphics::Bindings::LoadClassFont)
+            .add("ClassParticleEmitter",
+                &obe::Graphics::Bindings::LoadClassParticleEmitter)
+            .add("ClassParticleEmitterSettings",
+                &obe::Graphics::Bindings::LoadClassParticleEmitterSettings)
             .add("ClassPositionTransformer",
                 &obe::Graphics::Bindings::LoadClassPositionTransformer)
+            .add("ClassRenderStats", &obe::Graphics::Bindings::LoadClassRenderStats)
             .add("ClassRenderTarget", &obe::Graphics::Bindings::LoadClassRenderTarget)
+            .add("ClassRenderable", &obe::Graphics::Bindings::LoadClassRenderable)
             .add("ClassRichText", &obe::Graphics::Bindings::LoadClassRichText)
             .add("ClassShader", &obe::Graphics::Bindings::LoadClassShader)
+            .add("ClassSoftwareRenderTarget",
+                &obe::Graphics::Bindings::LoadClassSoftwareRenderTarget)
             .add("ClassSprite", &obe::Graphics::Bindings::LoadClassSprite)
             .add("ClassSpriteHandlePoint",
                 &obe::Graphics::Bindings::LoadClassSpriteHandlePoint)
             .add("ClassText", &obe::Graphics::Bindings::LoadClassText)
             .add("ClassTexture", &obe::Graphics::Bindings::LoadClassTexture)
+            .add("ClassTileLayer", &obe::Graphics::Bindings::LoadClassTileLayer)
             .add("EnumSpriteHandlePointType",
                 &obe::Graphics::Bindings::LoadEnumSpriteHandlePointType)
             .add("FunctionInitPositionTransformer",
@@ -318,6 +329,7 @@ namespace obe::Bindings
                 &obe::Input::Bindings::LoadClassInputButtonMonitor)
             .add("ClassInputCondition", &obe::Input::Bindings::LoadClassInputCondition)
             .add("ClassInputManager", &obe::Input::Bindings::LoadClassInputManager)
+            .add("ClassInputRecorder", &obe::Input::Bindings::LoadClassInputRecorder)
             .add("EnumAxisThresholdDirection",
                 &obe::Input::Bindings::LoadEnumAxisThresholdDirection)
             .add("EnumInputButtonState", &obe::Input::Bindings::LoadEnumInputButtonState)
@@ -378,7 +390,13 @@ namespace obe::Bindings
         BindTree["obe"]["Script"]
             .add("ClassGameObject", &obe::Script::Bindings::LoadClassGameObject)
             .add("ClassGameObjectDatabase",
-                &obe::Script::Bindings::LoadClassGameObjectDatabase);
+                &obe::Script::Bindings::LoadClassGameObjectDatabase)
+            .add("ClassGarbageCollector",
+                &obe::Script::Bindings::LoadClassGarbageCollector)
+            .add("ClassGarbageCollectorStats",
+                &obe::Script::Bindings::LoadClassGarbageCollectorStats)
+            .add("EnumGarbageCollectorMode",
+                &obe::Script::Bindings::LoadEnumGarbageCollectorMode);
 
         BindTree["obe"]["System"]
             .add("ClassCursor", &obe::System::Bindings::LoadClassCursor)
@@ -428,7 +446,11 @@ namespace obe::Bindings
             .add("ClassChronometer", &obe::Time::Bindings::LoadClassChronometer)
             .add("ClassFramerateCounter", &obe::Time::Bindings::LoadClassFramerateCounter)
             .add("ClassFramerateManager", &obe::Time::Bindings::LoadClassFramerateManager)
+            .add("ClassFrameTimeHistogram",
+                &obe::Time::Bindings::LoadClassFrameTimeHistogram)
             .add("FunctionEpoch", &obe::Time::Bindings::LoadFunctionEpoch)
+            .add("FunctionNow", &obe::Time::Bindings::LoadFunctionNow)
+            .add("FunctionPreciseNow", &obe::Time::Bindings::LoadFunctionPreciseNow)
             .add("GlobalSeconds", &obe::Time::Bindings::LoadGlobalSeconds)
             .add("GlobalMilliseconds", &obe::Time::Bindings::LoadGlobalMilliseconds)
             .add("GlobalMicroseconds", &obe::Time::Bindings::LoadGlobalMicroseconds)
@@ -471,14 +493,24 @@ namespace obe::Bindings
                 &obe::Transform::Bindings::LoadFunctionUnitsToString);
 
         BindTree["obe"]["Triggers"]
+            .add("ClassCallbackHandle", &obe::Triggers::Bindings::LoadClassCallbackHandle)
             .add("ClassCallbackScheduler",
                 &obe::Triggers::Bindings::LoadClassCallbackScheduler)
             .add("ClassTrigger", &obe::Triggers::Bindings::LoadClassTrigger)
+            .add("ClassTriggerCallbackStats",
+                &obe::Triggers::Bindings::LoadClassTriggerCallbackStats)
             .add("ClassTriggerEnv", &obe::Triggers::Bindings::LoadClassTriggerEnv)
             .add("ClassTriggerGroup", &obe::Triggers::Bindings::LoadClassTriggerGroup)
             .add("ClassTriggerManager", &obe::Triggers::Bindings::LoadClassTriggerManager)
+            .add("ClassTriggerQueue", &obe::Triggers::Bindings::LoadClassTriggerQueue)
+            .add("ClassTriggerQueueStats",
+                &obe::Triggers::Bindings::LoadClassTriggerQueueStats)
+            .add("ClassTriggerStatistics",
+                &obe::Triggers::Bindings::LoadClassTriggerStatistics)
             .add("EnumCallbackSchedulerState",
-                &obe::Triggers::Bindings::LoadEnumCallbackSchedulerState);
+                &obe::Triggers::Bindings::LoadEnumCallbackSchedulerState)
+            .add("EnumTriggerDispatchMode",
+                &obe::Triggers::Bindings::LoadEnumTriggerDispatchMode);
 
         BindTree["obe"]["Triggers"]["Exceptions"]
             .add("ClassCallbackCreationError",
@@ -640,6 +672,7 @@ namespace obe::Bindings
                 &obe::Config::Templates::Bindings::LoadGlobalSetAnimationCommand);
 
         BindTree["obe"]["Debug"]
+            .add("ClassProfiler", &obe::Debug::Bindings::LoadClassProfiler)
             .add("FunctionInitLogger", &obe::Debug::Bindings::LoadFunctionInitLogger)
             .add("FunctionTrace", &obe::Debug::Bindings::LoadFunctionTrace)
             .add("FunctionDebug", &obe::Debug::Bindings::LoadFunctionDebug)
@@ -721,6 +754,8 @@ namespace obe::Bindings
         BindTree["obe"]["Utils"]["Math"]
             .add("FunctionRandint", &obe::Utils::Math::Bindings::LoadFunctionRandint)
             .add("FunctionRandfloat", &obe::Utils::Math::Bindings::LoadFunctionRandfloat)
+            .add("FunctionSetSeed", &obe::Utils::Math::Bindings::LoadFunctionSetSeed)
+            .add("FunctionGetSeed", &obe::Utils::Math::Bindings::LoadFunctionGetSeed)
             .add("FunctionGetMin", &obe::Utils::Math::Bindings::LoadFunctionGetMin)
             .add("FunctionGetMax", &obe::Utils::Math::Bindings::LoadFunctionGetMax)
             .add("FunctionIsBetween", &obe::Utils::Math::Bindings::LoadFunctionIsBetween)
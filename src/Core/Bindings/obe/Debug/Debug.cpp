@@ -1,6 +1,7 @@
 #include <Bindings/obe/Debug/Debug.hpp>
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -46,4 +47,21 @@ namespace obe::Debug::Bindings
         sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
         DebugNamespace["Log"] = obe::Debug::Log;
     }
+    void LoadClassProfiler(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        sol::usertype<obe::Debug::Profiler> bindProfiler
+            = DebugNamespace.new_usertype<obe::Debug::Profiler>(
+                "Profiler", sol::call_constructor, sol::default_constructor);
+        bindProfiler["SetEnabled"] = &obe::Debug::Profiler::SetEnabled;
+        bindProfiler["IsEnabled"] = &obe::Debug::Profiler::IsEnabled;
+        bindProfiler["SetCapacity"] = &obe::Debug::Profiler::SetCapacity;
+        bindProfiler["BeginFrame"] = &obe::Debug::Profiler::BeginFrame;
+        bindProfiler["GetFrame"] = &obe::Debug::Profiler::GetFrame;
+        bindProfiler["SetThreadName"] = &obe::Debug::Profiler::SetThreadName;
+        bindProfiler["BeginZone"] = &obe::Debug::Profiler::BeginZone;
+        bindProfiler["EndZone"] = &obe::Debug::Profiler::EndZone;
+        bindProfiler["Clear"] = &obe::Debug::Profiler::Clear;
+        bindProfiler["ExportChromeTrace"] = &obe::Debug::Profiler::ExportChromeTrace;
+    }
 };
\ No newline at end of file
@@ -15,6 +15,8 @@ namespace obe::Engine::Bindings
                 sol::call_constructor, sol::constructors<obe::Engine::Engine()>());
         bindEngine["init"] = &obe::Engine::Engine::init;
         bindEngine["run"] = &obe::Engine::Engine::run;
+        bindEngine["stop"] = &obe::Engine::Engine::stop;
+        bindEngine["isHeadless"] = &obe::Engine::Engine::isHeadless;
         bindEngine["Audio"] = sol::property(&obe::Engine::Engine::getAudioManager);
         bindEngine["Configuration"]
             = sol::property(&obe::Engine::Engine::getConfigurationManager);
@@ -26,6 +28,9 @@ namespace obe::Engine::Bindings
         bindEngine["Scene"] = sol::property(&obe::Engine::Engine::getScene);
         bindEngine["Cursor"] = sol::property(&obe::Engine::Engine::getCursor);
         bindEngine["Window"] = sol::property(&obe::Engine::Engine::getWindow);
+        bindEngine["GarbageCollector"]
+            = sol::property(&obe::Engine::Engine::getGarbageCollector);
+        bindEngine["Stats"] = sol::property(&obe::Engine::Engine::getRenderStats);
     }
     void LoadClassResourceManagedObject(sol::state_view state)
     {
@@ -46,6 +51,16 @@ namespace obe::Engine::Bindings
                 "ResourceManager", sol::call_constructor,
                 sol::constructors<obe::Engine::ResourceManager()>());
         bindResourceManager["getFont"] = &obe::Engine::ResourceManager::getFont;
+        bindResourceManager["getShader"] = sol::overload(
+            [](obe::Engine::ResourceManager* self, const std::string& path)
+                -> std::shared_ptr<obe::Graphics::Shader> {
+                return self->getShader(path);
+            },
+            [](obe::Engine::ResourceManager* self, const std::string& path,
+                const std::vector<std::string>& defines)
+                -> std::shared_ptr<obe::Graphics::Shader> {
+                return self->getShader(path, defines);
+            });
         bindResourceManager["getTexture"] = sol::overload(
             static_cast<const obe::Graphics::Texture& (
                 obe::Engine::ResourceManager::*)(const std::string&, bool)>(
@@ -53,8 +68,78 @@ namespace obe::Engine::Bindings
             static_cast<const obe::Graphics::Texture& (
                 obe::Engine::ResourceManager::*)(const std::string&)>(
                 &obe::Engine::ResourceManager::getTexture));
+        bindResourceManager["getTextureAsync"] = sol::overload(
+            static_cast<const obe::Graphics::Texture& (
+                obe::Engine::ResourceManager::*)(const std::string&, bool)>(
+                &obe::Engine::ResourceManager::getTextureAsync),
+            static_cast<const obe::Graphics::Texture& (
+                obe::Engine::ResourceManager::*)(const std::string&)>(
+                &obe::Engine::ResourceManager::getTextureAsync));
+        bindResourceManager["setPlaceholderTexture"]
+            = &obe::Engine::ResourceManager::setPlaceholderTexture;
+        bindResourceManager["setUploadBudget"]
+            = &obe::Engine::ResourceManager::setUploadBudget;
+        bindResourceManager["getUploadBudget"]
+            = &obe::Engine::ResourceManager::getUploadBudget;
+        bindResourceManager["getPendingTextureCount"]
+            = &obe::Engine::ResourceManager::getPendingTextureCount;
+        bindResourceManager["setGpuMemoryBudget"]
+            = &obe::Engine::ResourceManager::setGpuMemoryBudget;
+        bindResourceManager["getGpuMemoryBudget"]
+            = &obe::Engine::ResourceManager::getGpuMemoryBudget;
+        bindResourceManager["setCpuMemoryBudget"]
+            = &obe::Engine::ResourceManager::setCpuMemoryBudget;
+        bindResourceManager["getCpuMemoryBudget"]
+            = &obe::Engine::ResourceManager::getCpuMemoryBudget;
+        bindResourceManager["getTextureCacheStats"]
+            = &obe::Engine::ResourceManager::getTextureCacheStats;
+        bindResourceManager["update"] = &obe::Engine::ResourceManager::update;
         bindResourceManager["clean"] = &obe::Engine::ResourceManager::clean;
+        bindResourceManager["configure"] = &obe::Engine::ResourceManager::configure;
+        bindResourceManager["enableAtlas"] = sol::overload(
+            [](obe::Engine::ResourceManager* self) -> void {
+                return self->enableAtlas();
+            },
+            [](obe::Engine::ResourceManager* self, unsigned int pageSize) -> void {
+                return self->enableAtlas(pageSize);
+            },
+            [](obe::Engine::ResourceManager* self, unsigned int pageSize,
+                unsigned int padding) -> void {
+                return self->enableAtlas(pageSize, padding);
+            },
+            [](obe::Engine::ResourceManager* self, unsigned int pageSize,
+                unsigned int padding, unsigned int maxImageSize) -> void {
+                return self->enableAtlas(pageSize, padding, maxImageSize);
+            });
+        bindResourceManager["disableAtlas"] = &obe::Engine::ResourceManager::disableAtlas;
+        bindResourceManager["enableFileCache"] = sol::overload(
+            [](obe::Engine::ResourceManager* self) -> void {
+                return self->enableFileCache();
+            },
+            [](obe::Engine::ResourceManager* self, const std::string& directory) -> void {
+                return self->enableFileCache(directory);
+            });
+        bindResourceManager["disableFileCache"]
+            = &obe::Engine::ResourceManager::disableFileCache;
+        bindResourceManager["isFileCacheEnabled"]
+            = &obe::Engine::ResourceManager::isFileCacheEnabled;
+        bindResourceManager["isAtlasEnabled"]
+            = &obe::Engine::ResourceManager::isAtlasEnabled;
         bindResourceManager["defaultAntiAliasing"]
             = &obe::Engine::ResourceManager::defaultAntiAliasing;
     }
+    void LoadClassTextureCacheStats(sol::state_view state)
+    {
+        sol::table EngineNamespace = state["obe"]["Engine"].get<sol::table>();
+        sol::usertype<obe::Engine::TextureCacheStats> bindTextureCacheStats
+            = EngineNamespace.new_usertype<obe::Engine::TextureCacheStats>(
+                "TextureCacheStats", sol::call_constructor, sol::default_constructor);
+        bindTextureCacheStats["hits"] = &obe::Engine::TextureCacheStats::hits;
+        bindTextureCacheStats["misses"] = &obe::Engine::TextureCacheStats::misses;
+        bindTextureCacheStats["evictions"] = &obe::Engine::TextureCacheStats::evictions;
+        bindTextureCacheStats["residentBytes"]
+            = &obe::Engine::TextureCacheStats::residentBytes;
+        bindTextureCacheStats["pendingBytes"]
+            = &obe::Engine::TextureCacheStats::pendingBytes;
+    }
 };
\ No newline at end of file
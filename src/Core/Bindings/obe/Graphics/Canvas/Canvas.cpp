@@ -54,6 +54,8 @@ namespace obe::Graphics::Canvas::Bindings
         bindBezier["points"] = &obe::Graphics::Canvas::Bezier::points;
         bindBezier["colors"] = &obe::Graphics::Canvas::Bezier::colors;
         bindBezier["precision"] = &obe::Graphics::Canvas::Bezier::precision;
+        bindBezier["adaptive"] = &obe::Graphics::Canvas::Bezier::adaptive;
+        bindBezier["flatness"] = &obe::Graphics::Canvas::Bezier::flatness;
         bindBezier["Type"] = sol::var(obe::Graphics::Canvas::Bezier::Type);
     }
     void LoadClassCanvas(sol::state_view state)
@@ -88,6 +90,8 @@ namespace obe::Graphics::Canvas::Bindings
         bindCanvas["remove"] = &obe::Graphics::Canvas::Canvas::remove;
         bindCanvas["getTexture"] = &obe::Graphics::Canvas::Canvas::getTexture;
         bindCanvas["requiresSort"] = &obe::Graphics::Canvas::Canvas::requiresSort;
+        bindCanvas["markDirty"] = &obe::Graphics::Canvas::Canvas::markDirty;
+        bindCanvas["isDirty"] = &obe::Graphics::Canvas::Canvas::isDirty;
         state.script_file("Lib/Internal/Canvas.lua"_fs);
     }
     void LoadClassCanvasElement(sol::state_view state)
@@ -100,6 +104,8 @@ namespace obe::Graphics::Canvas::Bindings
                     obe::Types::Identifiable>());
         bindCanvasElement["draw"] = &obe::Graphics::Canvas::CanvasElement::draw;
         bindCanvasElement["setLayer"] = &obe::Graphics::Canvas::CanvasElement::setLayer;
+        bindCanvasElement["markDirty"] = &obe::Graphics::Canvas::CanvasElement::markDirty;
+        bindCanvasElement["isDirty"] = &obe::Graphics::Canvas::CanvasElement::isDirty;
         bindCanvasElement["layer"] = &obe::Graphics::Canvas::CanvasElement::layer;
         bindCanvasElement["visible"] = &obe::Graphics::Canvas::CanvasElement::visible;
         bindCanvasElement["type"] = &obe::Graphics::Canvas::CanvasElement::type;
@@ -2,12 +2,17 @@
 
 #include <Graphics/Color.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/ParticleEmitter.hpp>
 #include <Graphics/PositionTransformers.hpp>
+#include <Graphics/RenderStats.hpp>
 #include <Graphics/RenderTarget.hpp>
+#include <Graphics/Renderable.hpp>
 #include <Graphics/Shader.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Graphics/Text.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TileLayer.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -231,6 +236,74 @@ namespace obe::Graphics::Bindings
             = &obe::Graphics::Font::operator const sf::Font&;
         bindFont["operator bool"] = &obe::Graphics::Font::operator bool;
     }
+    void LoadClassParticleEmitter(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::ParticleEmitter> bindParticleEmitter
+            = GraphicsNamespace.new_usertype<obe::Graphics::ParticleEmitter>(
+                "ParticleEmitter", sol::call_constructor,
+                sol::constructors<obe::Graphics::ParticleEmitter(const std::string&)>(),
+                sol::base_classes,
+                sol::bases<obe::Graphics::Renderable,
+                    obe::Component::Component<ParticleEmitter>,
+                    obe::Component::ComponentBase, obe::Types::Identifiable,
+                    obe::Types::Serializable>());
+        bindParticleEmitter["attachResourceManager"]
+            = &obe::Graphics::ParticleEmitter::attachResourceManager;
+        bindParticleEmitter["update"] = &obe::Graphics::ParticleEmitter::update;
+        bindParticleEmitter["draw"] = &obe::Graphics::ParticleEmitter::draw;
+        bindParticleEmitter["clear"] = &obe::Graphics::ParticleEmitter::clear;
+        bindParticleEmitter["burst"] = &obe::Graphics::ParticleEmitter::burst;
+        bindParticleEmitter["getParticleAmount"]
+            = &obe::Graphics::ParticleEmitter::getParticleAmount;
+        bindParticleEmitter["setSettings"] = &obe::Graphics::ParticleEmitter::setSettings;
+        bindParticleEmitter["getSettings"] = &obe::Graphics::ParticleEmitter::getSettings;
+        bindParticleEmitter["setPosition"] = &obe::Graphics::ParticleEmitter::setPosition;
+        bindParticleEmitter["getPosition"] = &obe::Graphics::ParticleEmitter::getPosition;
+        bindParticleEmitter["setEmitting"] = &obe::Graphics::ParticleEmitter::setEmitting;
+        bindParticleEmitter["isEmitting"] = &obe::Graphics::ParticleEmitter::isEmitting;
+        bindParticleEmitter["loadTexture"] = &obe::Graphics::ParticleEmitter::loadTexture;
+        bindParticleEmitter["getTexturePath"]
+            = &obe::Graphics::ParticleEmitter::getTexturePath;
+        bindParticleEmitter["dump"] = &obe::Graphics::ParticleEmitter::dump;
+        bindParticleEmitter["load"] = &obe::Graphics::ParticleEmitter::load;
+    }
+    void LoadClassParticleEmitterSettings(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::ParticleEmitterSettings> bindParticleEmitterSettings
+            = GraphicsNamespace.new_usertype<obe::Graphics::ParticleEmitterSettings>(
+                "ParticleEmitterSettings", sol::call_constructor,
+                sol::default_constructor);
+        bindParticleEmitterSettings["rate"]
+            = &obe::Graphics::ParticleEmitterSettings::rate;
+        bindParticleEmitterSettings["maxParticles"]
+            = &obe::Graphics::ParticleEmitterSettings::maxParticles;
+        bindParticleEmitterSettings["minLifetime"]
+            = &obe::Graphics::ParticleEmitterSettings::minLifetime;
+        bindParticleEmitterSettings["maxLifetime"]
+            = &obe::Graphics::ParticleEmitterSettings::maxLifetime;
+        bindParticleEmitterSettings["minSpeed"]
+            = &obe::Graphics::ParticleEmitterSettings::minSpeed;
+        bindParticleEmitterSettings["maxSpeed"]
+            = &obe::Graphics::ParticleEmitterSettings::maxSpeed;
+        bindParticleEmitterSettings["direction"]
+            = &obe::Graphics::ParticleEmitterSettings::direction;
+        bindParticleEmitterSettings["spread"]
+            = &obe::Graphics::ParticleEmitterSettings::spread;
+        bindParticleEmitterSettings["gravityX"]
+            = &obe::Graphics::ParticleEmitterSettings::gravityX;
+        bindParticleEmitterSettings["gravityY"]
+            = &obe::Graphics::ParticleEmitterSettings::gravityY;
+        bindParticleEmitterSettings["startSize"]
+            = &obe::Graphics::ParticleEmitterSettings::startSize;
+        bindParticleEmitterSettings["endSize"]
+            = &obe::Graphics::ParticleEmitterSettings::endSize;
+        bindParticleEmitterSettings["startColor"]
+            = &obe::Graphics::ParticleEmitterSettings::startColor;
+        bindParticleEmitterSettings["endColor"]
+            = &obe::Graphics::ParticleEmitterSettings::endColor;
+    }
     void LoadClassPositionTransformer(sol::state_view state)
     {
         sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
@@ -251,6 +324,21 @@ namespace obe::Graphics::Bindings
         bindPositionTransformer[sol::meta_function::call]
             = &obe::Graphics::PositionTransformer::operator();
     }
+    void LoadClassRenderStats(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::RenderStats> bindRenderStats
+            = GraphicsNamespace.new_usertype<obe::Graphics::RenderStats>(
+                "RenderStats", sol::call_constructor, sol::default_constructor);
+        bindRenderStats["drawCalls"] = &obe::Graphics::RenderStats::drawCalls;
+        bindRenderStats["vertices"] = &obe::Graphics::RenderStats::vertices;
+        bindRenderStats["textureBinds"] = &obe::Graphics::RenderStats::textureBinds;
+        bindRenderStats["shaderSwitches"] = &obe::Graphics::RenderStats::shaderSwitches;
+        bindRenderStats["sprites"] = &obe::Graphics::RenderStats::sprites;
+        bindRenderStats["culledSprites"] = &obe::Graphics::RenderStats::culledSprites;
+        bindRenderStats["canvasRedraws"] = &obe::Graphics::RenderStats::canvasRedraws;
+        bindRenderStats["renderTime"] = &obe::Graphics::RenderStats::renderTime;
+    }
     void LoadClassRenderTarget(sol::state_view state)
     {
         sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
@@ -258,18 +346,86 @@ namespace obe::Graphics::Bindings
             = GraphicsNamespace.new_usertype<obe::Graphics::RenderTarget>("RenderTarget",
                 sol::call_constructor,
                 sol::constructors<obe::Graphics::RenderTarget(sf::RenderTarget&),
-                    obe::Graphics::RenderTarget(sf::RenderWindow&)>());
+                    obe::Graphics::RenderTarget(sf::RenderWindow&),
+                    obe::Graphics::RenderTarget(obe::Graphics::SoftwareRenderTarget&)>());
         bindRenderTarget["draw"] = sol::overload(
             static_cast<void (obe::Graphics::RenderTarget::*)(const sf::Drawable&,
                 const sf::RenderStates&) const>(&obe::Graphics::RenderTarget::draw),
             static_cast<void (obe::Graphics::RenderTarget::*)(const sf::Vertex*,
                 std::size_t, sf::PrimitiveType, const sf::RenderStates&) const>(
                 &obe::Graphics::RenderTarget::draw));
+        bindRenderTarget["isSoftware"] = &obe::Graphics::RenderTarget::isSoftware;
+        bindRenderTarget["isDeferred"] = &obe::Graphics::RenderTarget::isDeferred;
+        bindRenderTarget["clear"] = &obe::Graphics::RenderTarget::clear;
+        bindRenderTarget["getSize"] = &obe::Graphics::RenderTarget::getSize;
+        bindRenderTarget["setView"] = &obe::Graphics::RenderTarget::setView;
+        bindRenderTarget["getView"] = &obe::Graphics::RenderTarget::getView;
+        bindRenderTarget["getDefaultView"] = &obe::Graphics::RenderTarget::getDefaultView;
         bindRenderTarget["operator sf::RenderTarget &"]
             = &obe::Graphics::RenderTarget::operator sf::RenderTarget&;
         bindRenderTarget["operator const sf::RenderTarget &"]
             = &obe::Graphics::RenderTarget::operator const sf::RenderTarget&;
     }
+    void LoadClassRenderable(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::Renderable> bindRenderable
+            = GraphicsNamespace.new_usertype<obe::Graphics::Renderable>("Renderable");
+        bindRenderable["draw"] = &obe::Graphics::Renderable::draw;
+        bindRenderable["setLayer"] = &obe::Graphics::Renderable::setLayer;
+        bindRenderable["getLayer"] = &obe::Graphics::Renderable::getLayer;
+        bindRenderable["setZDepth"] = &obe::Graphics::Renderable::setZDepth;
+        bindRenderable["getZDepth"] = &obe::Graphics::Renderable::getZDepth;
+        bindRenderable["setVisible"] = &obe::Graphics::Renderable::setVisible;
+        bindRenderable["isVisible"] = &obe::Graphics::Renderable::isVisible;
+    }
+    void LoadClassSoftwareRenderTarget(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::SoftwareRenderTarget> bindSoftwareRenderTarget
+            = GraphicsNamespace.new_usertype<obe::Graphics::SoftwareRenderTarget>(
+                "SoftwareRenderTarget", sol::call_constructor,
+                sol::constructors<obe::Graphics::SoftwareRenderTarget(),
+                    obe::Graphics::SoftwareRenderTarget(unsigned int, unsigned int)>());
+        bindSoftwareRenderTarget["create"] = &obe::Graphics::SoftwareRenderTarget::create;
+        bindSoftwareRenderTarget["getSize"]
+            = &obe::Graphics::SoftwareRenderTarget::getSize;
+        bindSoftwareRenderTarget["clear"] = sol::overload(
+            [](obe::Graphics::SoftwareRenderTarget* self) -> void {
+                return self->clear();
+            },
+            [](obe::Graphics::SoftwareRenderTarget* self,
+                const obe::Graphics::Color& color) -> void {
+                return self->clear(color);
+            });
+        bindSoftwareRenderTarget["setView"]
+            = &obe::Graphics::SoftwareRenderTarget::setView;
+        bindSoftwareRenderTarget["getView"]
+            = &obe::Graphics::SoftwareRenderTarget::getView;
+        bindSoftwareRenderTarget["getDefaultView"]
+            = &obe::Graphics::SoftwareRenderTarget::getDefaultView;
+        bindSoftwareRenderTarget["getDrawCalls"]
+            = &obe::Graphics::SoftwareRenderTarget::getDrawCalls;
+        bindSoftwareRenderTarget["copyToImage"]
+            = &obe::Graphics::SoftwareRenderTarget::copyToImage;
+        bindSoftwareRenderTarget["saveToFile"]
+            = &obe::Graphics::SoftwareRenderTarget::saveToFile;
+        bindSoftwareRenderTarget["compare"] = sol::overload(
+            [](obe::Graphics::SoftwareRenderTarget* self, const sf::Image& reference)
+                -> std::size_t { return self->compare(reference); },
+            [](obe::Graphics::SoftwareRenderTarget* self, const sf::Image& reference,
+                std::uint8_t tolerance) -> std::size_t {
+                return self->compare(reference, tolerance);
+            });
+        bindSoftwareRenderTarget["InvalidateTexture"]
+            = &obe::Graphics::SoftwareRenderTarget::InvalidateTexture;
+        bindSoftwareRenderTarget["SetTextureImage"]
+            = &obe::Graphics::SoftwareRenderTarget::SetTextureImage;
+        bindSoftwareRenderTarget["SetEnabled"]
+            = &obe::Graphics::SoftwareRenderTarget::SetEnabled;
+        bindSoftwareRenderTarget["IsEnabled"]
+            = &obe::Graphics::SoftwareRenderTarget::IsEnabled;
+    }
     void LoadClassRichText(sol::state_view state)
     {
         sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
@@ -299,7 +455,25 @@ namespace obe::Graphics::Bindings
                 sol::base_classes, sol::bases<obe::Types::Serializable>());
         bindShader["dump"] = &obe::Graphics::Shader::dump;
         bindShader["load"] = &obe::Graphics::Shader::load;
-        bindShader["loadShader"] = &obe::Graphics::Shader::loadShader;
+        bindShader["loadShader"] = sol::overload(
+            [](obe::Graphics::Shader* self, const std::string& path) -> bool {
+                return self->loadShader(path);
+            },
+            [](obe::Graphics::Shader* self, const std::string& path,
+                const std::vector<std::string>& defines) -> bool {
+                return self->loadShader(path, defines);
+            });
+        bindShader["getPath"] = &obe::Graphics::Shader::getPath;
+        bindShader["getDefines"] = &obe::Graphics::Shader::getDefines;
+        bindShader["setUniformDefault"] = sol::overload(
+            static_cast<void (obe::Graphics::Shader::*)(const std::string&, float)>(
+                &obe::Graphics::Shader::setUniformDefault),
+            static_cast<void (obe::Graphics::Shader::*)(const std::string&, float,
+                float)>(&obe::Graphics::Shader::setUniformDefault),
+            static_cast<void (obe::Graphics::Shader::*)(const std::string&, float, float,
+                float)>(&obe::Graphics::Shader::setUniformDefault),
+            static_cast<void (obe::Graphics::Shader::*)(const std::string&,
+                const obe::Graphics::Color&)>(&obe::Graphics::Shader::setUniformDefault));
     }
     void LoadClassSprite(sol::state_view state)
     {
@@ -337,6 +511,7 @@ namespace obe::Graphics::Bindings
         bindSprite["isVisible"] = &obe::Graphics::Sprite::isVisible;
         bindSprite["load"] = &obe::Graphics::Sprite::load;
         bindSprite["loadTexture"] = &obe::Graphics::Sprite::loadTexture;
+        bindSprite["loadTextureAsync"] = &obe::Graphics::Sprite::loadTextureAsync;
         bindSprite["rotate"] = &obe::Graphics::Sprite::rotate;
         bindSprite["setColor"] = &obe::Graphics::Sprite::setColor;
         bindSprite["setLayer"] = &obe::Graphics::Sprite::setLayer;
@@ -347,6 +522,24 @@ namespace obe::Graphics::Bindings
         bindSprite["setRotationOrigin"] = &obe::Graphics::Sprite::setRotationOrigin;
         bindSprite["setScalingOrigin"] = &obe::Graphics::Sprite::setScalingOrigin;
         bindSprite["setShader"] = &obe::Graphics::Sprite::setShader;
+        bindSprite["loadShader"] = sol::overload(
+            [](obe::Graphics::Sprite* self, const std::string& path) -> void {
+                return self->loadShader(path);
+            },
+            [](obe::Graphics::Sprite* self, const std::string& path,
+                const std::vector<std::string>& defines) -> void {
+                return self->loadShader(path, defines);
+            });
+        bindSprite["setShaderUniform"] = sol::overload(
+            static_cast<void (obe::Graphics::Sprite::*)(const std::string&, float)>(
+                &obe::Graphics::Sprite::setShaderUniform),
+            static_cast<void (obe::Graphics::Sprite::*)(const std::string&, float,
+                float)>(&obe::Graphics::Sprite::setShaderUniform),
+            static_cast<void (obe::Graphics::Sprite::*)(const std::string&, float, float,
+                float)>(&obe::Graphics::Sprite::setShaderUniform),
+            static_cast<void (obe::Graphics::Sprite::*)(const std::string&,
+                const obe::Graphics::Color&)>(&obe::Graphics::Sprite::setShaderUniform));
+        bindSprite["removeShaderUniform"] = &obe::Graphics::Sprite::removeShaderUniform;
         bindSprite["setTexture"] = &obe::Graphics::Sprite::setTexture;
         bindSprite["setTextureRect"] = &obe::Graphics::Sprite::setTextureRect;
         bindSprite["setTranslationOrigin"] = &obe::Graphics::Sprite::setTranslationOrigin;
@@ -416,6 +609,8 @@ namespace obe::Graphics::Bindings
         bindTexture["isRepeated"] = &obe::Graphics::Texture::isRepeated;
         bindTexture["reset"] = &obe::Graphics::Texture::reset;
         bindTexture["useCount"] = &obe::Graphics::Texture::useCount;
+        bindTexture["isView"] = &obe::Graphics::Texture::isView;
+        bindTexture["isLoading"] = &obe::Graphics::Texture::isLoading;
         bindTexture["operator sf::Texture &"]
             = &obe::Graphics::Texture::operator sf::Texture&;
         bindTexture["operator const sf::Texture &"]
@@ -431,6 +626,43 @@ namespace obe::Graphics::Bindings
                 obe::Graphics::Texture::*)(std::shared_ptr<sf::Texture>)>(
                 &obe::Graphics::Texture::operator=));
     }
+    void LoadClassTileLayer(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::TileLayer> bindTileLayer
+            = GraphicsNamespace.new_usertype<obe::Graphics::TileLayer>("TileLayer",
+                sol::call_constructor,
+                sol::constructors<obe::Graphics::TileLayer(const std::string&)>(),
+                sol::base_classes,
+                sol::bases<obe::Graphics::Renderable,
+                    obe::Component::Component<TileLayer>, obe::Component::ComponentBase,
+                    obe::Types::Identifiable, obe::Types::Serializable>());
+        bindTileLayer["attachResourceManager"]
+            = &obe::Graphics::TileLayer::attachResourceManager;
+        bindTileLayer["create"] = &obe::Graphics::TileLayer::create;
+        bindTileLayer["getWidth"] = &obe::Graphics::TileLayer::getWidth;
+        bindTileLayer["getHeight"] = &obe::Graphics::TileLayer::getHeight;
+        bindTileLayer["setTile"] = &obe::Graphics::TileLayer::setTile;
+        bindTileLayer["getTile"] = &obe::Graphics::TileLayer::getTile;
+        bindTileLayer["setTileset"] = &obe::Graphics::TileLayer::setTileset;
+        bindTileLayer["getTilesetPath"] = &obe::Graphics::TileLayer::getTilesetPath;
+        bindTileLayer["setTileSize"] = &obe::Graphics::TileLayer::setTileSize;
+        bindTileLayer["getTileSize"] = &obe::Graphics::TileLayer::getTileSize;
+        bindTileLayer["setPosition"] = &obe::Graphics::TileLayer::setPosition;
+        bindTileLayer["getPosition"] = &obe::Graphics::TileLayer::getPosition;
+        bindTileLayer["setChunkSize"] = &obe::Graphics::TileLayer::setChunkSize;
+        bindTileLayer["getChunkSize"] = &obe::Graphics::TileLayer::getChunkSize;
+        bindTileLayer["getChunkAmount"] = &obe::Graphics::TileLayer::getChunkAmount;
+        bindTileLayer["getDrawnChunkAmount"]
+            = &obe::Graphics::TileLayer::getDrawnChunkAmount;
+        bindTileLayer["setSolidTiles"] = &obe::Graphics::TileLayer::setSolidTiles;
+        bindTileLayer["getSolidTiles"] = &obe::Graphics::TileLayer::getSolidTiles;
+        bindTileLayer["isSolid"] = &obe::Graphics::TileLayer::isSolid;
+        bindTileLayer["getSolidAreas"] = &obe::Graphics::TileLayer::getSolidAreas;
+        bindTileLayer["draw"] = &obe::Graphics::TileLayer::draw;
+        bindTileLayer["dump"] = &obe::Graphics::TileLayer::dump;
+        bindTileLayer["load"] = &obe::Graphics::TileLayer::load;
+    }
     void LoadFunctionInitPositionTransformer(sol::state_view state)
     {
         sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
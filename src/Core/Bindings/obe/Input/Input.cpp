@@ -7,6 +7,7 @@
 #include <Input/InputButtonState.hpp>
 #include <Input/InputCondition.hpp>
 #include <Input/InputManager.hpp>
+#include <Input/InputRecorder.hpp>
 #include <Input/InputType.hpp>
 
 #include <Bindings/Config.hpp>
@@ -118,6 +119,20 @@ namespace obe::Input::Bindings
         bindInputButtonMonitor["getState"] = &obe::Input::InputButtonMonitor::getState;
         bindInputButtonMonitor["update"] = &obe::Input::InputButtonMonitor::update;
     }
+    void LoadClassInputRecorder(sol::state_view state)
+    {
+        sol::table InputNamespace = state["obe"]["Input"].get<sol::table>();
+        sol::usertype<obe::Input::InputRecorder> bindInputRecorder
+            = InputNamespace.new_usertype<obe::Input::InputRecorder>("InputRecorder");
+        bindInputRecorder["startRecording"] = &obe::Input::InputRecorder::startRecording;
+        bindInputRecorder["startReplay"] = &obe::Input::InputRecorder::startReplay;
+        bindInputRecorder["stop"] = &obe::Input::InputRecorder::stop;
+        bindInputRecorder["isRecording"] = &obe::Input::InputRecorder::isRecording;
+        bindInputRecorder["isReplaying"] = &obe::Input::InputRecorder::isReplaying;
+        bindInputRecorder["getPath"] = &obe::Input::InputRecorder::getPath;
+        bindInputRecorder["getSeed"] = &obe::Input::InputRecorder::getSeed;
+        bindInputRecorder["getFrame"] = &obe::Input::InputRecorder::getFrame;
+    }
     void LoadClassInputCondition(sol::state_view state)
     {
         sol::table InputNamespace = state["obe"]["Input"].get<sol::table>();
@@ -165,6 +180,7 @@ namespace obe::Input::Bindings
             static_cast<obe::Input::InputButtonMonitorPtr (obe::Input::InputManager::*)(
                 obe::Input::InputButton&)>(&obe::Input::InputManager::monitor));
         bindInputManager["requireRefresh"] = &obe::Input::InputManager::requireRefresh;
+        bindInputManager["getRecorder"] = &obe::Input::InputManager::getRecorder;
     }
     void LoadFunctionInputButtonStateToString(sol::state_view state)
     {
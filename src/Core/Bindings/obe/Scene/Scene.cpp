@@ -62,6 +62,7 @@ namespace obe::Scene::Bindings
                 static_cast<void (obe::Scene::Scene::*)(
                     const std::string&, const obe::Scene::OnSceneLoadCallback&)>(
                     &obe::Scene::Scene::setFutureLoadFromFile));
+        bindScene["hasFutureLoad"] = &obe::Scene::Scene::hasFutureLoad;
         bindScene["clear"] = &obe::Scene::Scene::clear;
         bindScene["dump"] = &obe::Scene::Scene::dump;
         bindScene["load"] = &obe::Scene::Scene::load;
@@ -131,6 +132,34 @@ namespace obe::Scene::Bindings
         bindScene["getCollider"] = &obe::Scene::Scene::getCollider;
         bindScene["doesColliderExists"] = &obe::Scene::Scene::doesColliderExists;
         bindScene["removeCollider"] = &obe::Scene::Scene::removeCollider;
+        bindScene["createParticleEmitter"] = sol::overload(
+            [](obe::Scene::Scene* self) -> obe::Graphics::ParticleEmitter& {
+                return self->createParticleEmitter();
+            },
+            [](obe::Scene::Scene* self,
+                const std::string& id) -> obe::Graphics::ParticleEmitter& {
+                return self->createParticleEmitter(id);
+            });
+        bindScene["getParticleEmitterAmount"]
+            = &obe::Scene::Scene::getParticleEmitterAmount;
+        bindScene["getAllParticleEmitters"] = &obe::Scene::Scene::getAllParticleEmitters;
+        bindScene["getParticleEmitter"] = &obe::Scene::Scene::getParticleEmitter;
+        bindScene["doesParticleEmitterExists"]
+            = &obe::Scene::Scene::doesParticleEmitterExists;
+        bindScene["removeParticleEmitter"] = &obe::Scene::Scene::removeParticleEmitter;
+        bindScene["createTileLayer"] = sol::overload(
+            [](obe::Scene::Scene* self) -> obe::Graphics::TileLayer& {
+                return self->createTileLayer();
+            },
+            [](obe::Scene::Scene* self,
+                const std::string& id) -> obe::Graphics::TileLayer& {
+                return self->createTileLayer(id);
+            });
+        bindScene["getTileLayerAmount"] = &obe::Scene::Scene::getTileLayerAmount;
+        bindScene["getAllTileLayers"] = &obe::Scene::Scene::getAllTileLayers;
+        bindScene["getTileLayer"] = &obe::Scene::Scene::getTileLayer;
+        bindScene["doesTileLayerExists"] = &obe::Scene::Scene::doesTileLayerExists;
+        bindScene["removeTileLayer"] = &obe::Scene::Scene::removeTileLayer;
         bindScene["getSceneRootNode"] = &obe::Scene::Scene::getSceneRootNode;
         bindScene["getFilePath"] = &obe::Scene::Scene::getFilePath;
         bindScene["reload"] = sol::overload(
@@ -2,6 +2,7 @@
 
 #include <Scene/Scene.hpp>
 #include <Script/GameObject.hpp>
+#include <Script/GarbageCollector.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -78,4 +79,59 @@ namespace obe::Script::Bindings
             = &obe::Script::GameObjectDatabase::ApplyRequirements;
         bindGameObjectDatabase["Clear"] = &obe::Script::GameObjectDatabase::Clear;
     }
+    void LoadEnumGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.new_enum<obe::Script::GarbageCollectorMode>(
+            "GarbageCollectorMode",
+            { { "Full", obe::Script::GarbageCollectorMode::Full },
+                { "Incremental", obe::Script::GarbageCollectorMode::Incremental },
+                { "Generational", obe::Script::GarbageCollectorMode::Generational } });
+    }
+    void LoadClassGarbageCollector(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        sol::usertype<obe::Script::GarbageCollector> bindGarbageCollector
+            = ScriptNamespace.new_usertype<obe::Script::GarbageCollector>(
+                "GarbageCollector");
+        bindGarbageCollector["setMode"] = &obe::Script::GarbageCollector::setMode;
+        bindGarbageCollector["getMode"] = &obe::Script::GarbageCollector::getMode;
+        bindGarbageCollector["setTimeBudget"]
+            = &obe::Script::GarbageCollector::setTimeBudget;
+        bindGarbageCollector["getTimeBudget"]
+            = &obe::Script::GarbageCollector::getTimeBudget;
+        bindGarbageCollector["setStepSize"] = &obe::Script::GarbageCollector::setStepSize;
+        bindGarbageCollector["getStepSize"] = &obe::Script::GarbageCollector::getStepSize;
+        bindGarbageCollector["setHeapLimit"]
+            = &obe::Script::GarbageCollector::setHeapLimit;
+        bindGarbageCollector["getHeapLimit"]
+            = &obe::Script::GarbageCollector::getHeapLimit;
+        bindGarbageCollector["setHeapGrowth"]
+            = &obe::Script::GarbageCollector::setHeapGrowth;
+        bindGarbageCollector["getHeapGrowth"]
+            = &obe::Script::GarbageCollector::getHeapGrowth;
+        bindGarbageCollector["setCollectOnSceneChange"]
+            = &obe::Script::GarbageCollector::setCollectOnSceneChange;
+        bindGarbageCollector["getCollectOnSceneChange"]
+            = &obe::Script::GarbageCollector::getCollectOnSceneChange;
+        bindGarbageCollector["collect"] = &obe::Script::GarbageCollector::collect;
+        bindGarbageCollector["getHeapSize"] = &obe::Script::GarbageCollector::getHeapSize;
+        bindGarbageCollector["getLastFrameStats"]
+            = &obe::Script::GarbageCollector::getLastFrameStats;
+    }
+    void LoadClassGarbageCollectorStats(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        sol::usertype<obe::Script::GarbageCollectorStats> bindGarbageCollectorStats
+            = ScriptNamespace.new_usertype<obe::Script::GarbageCollectorStats>(
+                "GarbageCollectorStats", sol::call_constructor, sol::default_constructor);
+        bindGarbageCollectorStats["collectionTime"]
+            = &obe::Script::GarbageCollectorStats::collectionTime;
+        bindGarbageCollectorStats["heapSize"]
+            = &obe::Script::GarbageCollectorStats::heapSize;
+        bindGarbageCollectorStats["steps"] = &obe::Script::GarbageCollectorStats::steps;
+        bindGarbageCollectorStats["cycles"] = &obe::Script::GarbageCollectorStats::cycles;
+        bindGarbageCollectorStats["fullCollection"]
+            = &obe::Script::GarbageCollectorStats::fullCollection;
+    }
 };
\ No newline at end of file
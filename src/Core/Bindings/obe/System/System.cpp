@@ -187,5 +187,9 @@ namespace obe::System::Bindings
         bindWindow["getClearColor"] = &obe::System::Window::getClearColor;
         bindWindow["setClearColor"] = &obe::System::Window::setClearColor;
         bindWindow["setMouseCursorVisible"] = &obe::System::Window::setMouseCursorVisible;
+        bindWindow["isSoftware"] = &obe::System::Window::isSoftware;
+        bindWindow["getSoftwareTarget"] = &obe::System::Window::getSoftwareTarget;
+        bindWindow["isRenderThreadEnabled"]
+            = &obe::System::Window::isRenderThreadEnabled;
     }
 };
\ No newline at end of file
@@ -62,12 +62,68 @@ namespace obe::Time::Bindings
             = &obe::Time::FramerateManager::setFramerateTarget;
         bindFramerateManager["setVSyncEnabled"]
             = &obe::Time::FramerateManager::setVSyncEnabled;
+        bindFramerateManager["setPacingTolerance"]
+            = &obe::Time::FramerateManager::setPacingTolerance;
+        bindFramerateManager["getPacingTolerance"]
+            = &obe::Time::FramerateManager::getPacingTolerance;
+        bindFramerateManager["setFixedTimestep"] = sol::overload(
+            [](obe::Time::FramerateManager* self, obe::Time::TimeUnit timestep) -> void {
+                return self->setFixedTimestep(timestep);
+            },
+            [](obe::Time::FramerateManager* self, obe::Time::TimeUnit timestep,
+                unsigned int maxUpdates) -> void {
+                return self->setFixedTimestep(timestep, maxUpdates);
+            });
+        bindFramerateManager["getFixedTimestep"]
+            = &obe::Time::FramerateManager::getFixedTimestep;
+        bindFramerateManager["doFixedUpdate"]
+            = &obe::Time::FramerateManager::doFixedUpdate;
+        bindFramerateManager["getInterpolationAlpha"]
+            = &obe::Time::FramerateManager::getInterpolationAlpha;
+        bindFramerateManager["getFrameTimes"]
+            = &obe::Time::FramerateManager::getFrameTimes;
+        bindFramerateManager["getPacingErrors"]
+            = &obe::Time::FramerateManager::getPacingErrors;
+        bindFramerateManager["resetStatistics"]
+            = &obe::Time::FramerateManager::resetStatistics;
+    }
+    void LoadClassFrameTimeHistogram(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        sol::usertype<obe::Time::FrameTimeHistogram> bindFrameTimeHistogram
+            = TimeNamespace.new_usertype<obe::Time::FrameTimeHistogram>(
+                "FrameTimeHistogram", sol::call_constructor,
+                sol::constructors<obe::Time::FrameTimeHistogram(),
+                    obe::Time::FrameTimeHistogram(obe::Time::TimeUnit),
+                    obe::Time::FrameTimeHistogram(obe::Time::TimeUnit, std::size_t)>());
+        bindFrameTimeHistogram["add"] = &obe::Time::FrameTimeHistogram::add;
+        bindFrameTimeHistogram["reset"] = &obe::Time::FrameTimeHistogram::reset;
+        bindFrameTimeHistogram["getCount"] = &obe::Time::FrameTimeHistogram::getCount;
+        bindFrameTimeHistogram["getMin"] = &obe::Time::FrameTimeHistogram::getMin;
+        bindFrameTimeHistogram["getMax"] = &obe::Time::FrameTimeHistogram::getMax;
+        bindFrameTimeHistogram["getMean"] = &obe::Time::FrameTimeHistogram::getMean;
+        bindFrameTimeHistogram["getPercentile"]
+            = &obe::Time::FrameTimeHistogram::getPercentile;
+        bindFrameTimeHistogram["getBucketWidth"]
+            = &obe::Time::FrameTimeHistogram::getBucketWidth;
+        bindFrameTimeHistogram["getBuckets"]
+            = &obe::Time::FrameTimeHistogram::getBuckets;
     }
     void LoadFunctionEpoch(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
         TimeNamespace.set_function("epoch", obe::Time::epoch);
     }
+    void LoadFunctionNow(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("now", obe::Time::now);
+    }
+    void LoadFunctionPreciseNow(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("preciseNow", obe::Time::preciseNow);
+    }
     void LoadGlobalSeconds(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
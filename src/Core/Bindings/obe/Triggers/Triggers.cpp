@@ -4,6 +4,8 @@
 #include <Triggers/Trigger.hpp>
 #include <Triggers/TriggerGroup.hpp>
 #include <Triggers/TriggerManager.hpp>
+#include <Triggers/TriggerQueue.hpp>
+#include <Triggers/TriggerStatistics.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -18,6 +20,16 @@ namespace obe::Triggers::Bindings
                 { "Ready", obe::Triggers::CallbackSchedulerState::Ready },
                 { "Done", obe::Triggers::CallbackSchedulerState::Done } });
     }
+    void LoadEnumTriggerDispatchMode(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        TriggersNamespace.new_enum<obe::Triggers::TriggerDispatchMode>(
+            "TriggerDispatchMode",
+            { { "Immediate", obe::Triggers::TriggerDispatchMode::Immediate },
+                { "Queued", obe::Triggers::TriggerDispatchMode::Queued },
+                { "CoalesceLast", obe::Triggers::TriggerDispatchMode::CoalesceLast },
+                { "CoalesceList", obe::Triggers::TriggerDispatchMode::CoalesceList } });
+    }
     void LoadClassCallbackScheduler(sol::state_view state)
     {
         sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
@@ -28,10 +40,23 @@ namespace obe::Triggers::Bindings
                     obe::Triggers::TriggerManager&)>());
         bindCallbackScheduler["after"] = &obe::Triggers::CallbackScheduler::after;
         bindCallbackScheduler["every"] = &obe::Triggers::CallbackScheduler::every;
+        bindCallbackScheduler["afterFrames"]
+            = &obe::Triggers::CallbackScheduler::afterFrames;
+        bindCallbackScheduler["everyFrames"]
+            = &obe::Triggers::CallbackScheduler::everyFrames;
         bindCallbackScheduler["repeat"] = &obe::Triggers::CallbackScheduler::repeat;
         bindCallbackScheduler["run"] = &obe::Triggers::CallbackScheduler::run;
         bindCallbackScheduler["stop"] = &obe::Triggers::CallbackScheduler::stop;
     }
+    void LoadClassCallbackHandle(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        sol::usertype<obe::Triggers::CallbackHandle> bindCallbackHandle
+            = TriggersNamespace.new_usertype<obe::Triggers::CallbackHandle>(
+                "CallbackHandle", sol::call_constructor, sol::default_constructor);
+        bindCallbackHandle["cancel"] = &obe::Triggers::CallbackHandle::cancel;
+        bindCallbackHandle["isPending"] = &obe::Triggers::CallbackHandle::isPending;
+    }
     void LoadClassTrigger(sol::state_view state)
     {
         sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
@@ -51,6 +76,10 @@ namespace obe::Triggers::Bindings
             = &obe::Triggers::Trigger::unregisterEnvironment;
         bindTrigger["getTriggerLuaTableName"]
             = &obe::Triggers::Trigger::getTriggerLuaTableName;
+        bindTrigger["hasLuaListeners"] = &obe::Triggers::Trigger::hasLuaListeners;
+        bindTrigger["hasNativeListeners"] = &obe::Triggers::Trigger::hasNativeListeners;
+        bindTrigger["setDispatchMode"] = &obe::Triggers::Trigger::setDispatchMode;
+        bindTrigger["getDispatchMode"] = &obe::Triggers::Trigger::getDispatchMode;
     }
     void LoadClassTriggerEnv(sol::state_view state)
     {
@@ -89,6 +118,8 @@ namespace obe::Triggers::Bindings
         bindTriggerGroup["getName"] = &obe::Triggers::TriggerGroup::getName;
         bindTriggerGroup["onRegister"] = &obe::Triggers::TriggerGroup::onRegister;
         bindTriggerGroup["onUnregister"] = &obe::Triggers::TriggerGroup::onUnregister;
+        bindTriggerGroup["setDispatchMode"]
+            = &obe::Triggers::TriggerGroup::setDispatchMode;
     }
     void LoadClassTriggerManager(sol::state_view state)
     {
@@ -117,5 +148,87 @@ namespace obe::Triggers::Bindings
         bindTriggerManager["update"] = &obe::Triggers::TriggerManager::update;
         bindTriggerManager["clear"] = &obe::Triggers::TriggerManager::clear;
         bindTriggerManager["schedule"] = &obe::Triggers::TriggerManager::schedule;
+        bindTriggerManager["getScheduledAmount"]
+            = &obe::Triggers::TriggerManager::getScheduledAmount;
+        bindTriggerManager["getFrame"] = &obe::Triggers::TriggerManager::getFrame;
+        bindTriggerManager["getQueue"] = &obe::Triggers::TriggerManager::getQueue;
+        bindTriggerManager["getStatistics"]
+            = &obe::Triggers::TriggerManager::getStatistics;
+    }
+    void LoadClassTriggerQueue(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        sol::usertype<obe::Triggers::TriggerQueue> bindTriggerQueue
+            = TriggersNamespace.new_usertype<obe::Triggers::TriggerQueue>(
+                "TriggerQueue");
+        bindTriggerQueue["drain"] = &obe::Triggers::TriggerQueue::drain;
+        bindTriggerQueue["getSize"] = &obe::Triggers::TriggerQueue::getSize;
+        bindTriggerQueue["getStats"] = &obe::Triggers::TriggerQueue::getStats;
+        bindTriggerQueue["resetStats"] = &obe::Triggers::TriggerQueue::resetStats;
+        bindTriggerQueue["clear"] = &obe::Triggers::TriggerQueue::clear;
+    }
+    void LoadClassTriggerQueueStats(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        sol::usertype<obe::Triggers::TriggerQueueStats> bindTriggerQueueStats
+            = TriggersNamespace.new_usertype<obe::Triggers::TriggerQueueStats>(
+                "TriggerQueueStats", sol::call_constructor, sol::default_constructor);
+        bindTriggerQueueStats["fired"] = &obe::Triggers::TriggerQueueStats::fired;
+        bindTriggerQueueStats["coalesced"] = &obe::Triggers::TriggerQueueStats::coalesced;
+        bindTriggerQueueStats["executed"] = &obe::Triggers::TriggerQueueStats::executed;
+        bindTriggerQueueStats["drains"] = &obe::Triggers::TriggerQueueStats::drains;
+        bindTriggerQueueStats["lastDepth"] = &obe::Triggers::TriggerQueueStats::lastDepth;
+        bindTriggerQueueStats["maxDepth"] = &obe::Triggers::TriggerQueueStats::maxDepth;
+        bindTriggerQueueStats["lastDrainTime"]
+            = &obe::Triggers::TriggerQueueStats::lastDrainTime;
+        bindTriggerQueueStats["maxDrainTime"]
+            = &obe::Triggers::TriggerQueueStats::maxDrainTime;
+        bindTriggerQueueStats["totalDrainTime"]
+            = &obe::Triggers::TriggerQueueStats::totalDrainTime;
+    }
+    void LoadClassTriggerStatistics(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        sol::usertype<obe::Triggers::TriggerStatistics> bindTriggerStatistics
+            = TriggersNamespace.new_usertype<obe::Triggers::TriggerStatistics>(
+                "TriggerStatistics", sol::call_constructor, sol::default_constructor);
+        bindTriggerStatistics["setEnabled"]
+            = &obe::Triggers::TriggerStatistics::setEnabled;
+        bindTriggerStatistics["isEnabled"] = &obe::Triggers::TriggerStatistics::isEnabled;
+        bindTriggerStatistics["getTop"] = sol::overload(
+            [](obe::Triggers::TriggerStatistics* self)
+                -> std::vector<obe::Triggers::TriggerCallbackStats> {
+                return self->getTop();
+            },
+            [](obe::Triggers::TriggerStatistics* self, std::size_t count)
+                -> std::vector<obe::Triggers::TriggerCallbackStats> {
+                return self->getTop(count);
+            });
+        bindTriggerStatistics["dump"] = sol::overload(
+            [](obe::Triggers::TriggerStatistics* self) -> void { return self->dump(); },
+            [](obe::Triggers::TriggerStatistics* self, std::size_t count) -> void {
+                return self->dump(count);
+            });
+        bindTriggerStatistics["reset"] = &obe::Triggers::TriggerStatistics::reset;
+        bindTriggerStatistics["NativeEnvironmentId"]
+            = sol::var(obe::Triggers::TriggerStatistics::NativeEnvironmentId);
+    }
+    void LoadClassTriggerCallbackStats(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        sol::usertype<obe::Triggers::TriggerCallbackStats> bindTriggerCallbackStats
+            = TriggersNamespace.new_usertype<obe::Triggers::TriggerCallbackStats>(
+                "TriggerCallbackStats", sol::call_constructor, sol::default_constructor);
+        bindTriggerCallbackStats["trigger"]
+            = &obe::Triggers::TriggerCallbackStats::trigger;
+        bindTriggerCallbackStats["environment"]
+            = &obe::Triggers::TriggerCallbackStats::environment;
+        bindTriggerCallbackStats["calls"] = &obe::Triggers::TriggerCallbackStats::calls;
+        bindTriggerCallbackStats["totalTime"]
+            = &obe::Triggers::TriggerCallbackStats::totalTime;
+        bindTriggerCallbackStats["maxTime"]
+            = &obe::Triggers::TriggerCallbackStats::maxTime;
+        bindTriggerCallbackStats["lastTime"]
+            = &obe::Triggers::TriggerCallbackStats::lastTime;
     }
 };
\ No newline at end of file
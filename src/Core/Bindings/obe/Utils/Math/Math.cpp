@@ -16,6 +16,16 @@ namespace obe::Utils::Math::Bindings
         sol::table MathNamespace = state["obe"]["Utils"]["Math"].get<sol::table>();
         MathNamespace.set_function("randfloat", obe::Utils::Math::randfloat);
     }
+    void LoadFunctionSetSeed(sol::state_view state)
+    {
+        sol::table MathNamespace = state["obe"]["Utils"]["Math"].get<sol::table>();
+        MathNamespace.set_function("setSeed", obe::Utils::Math::setSeed);
+    }
+    void LoadFunctionGetSeed(sol::state_view state)
+    {
+        sol::table MathNamespace = state["obe"]["Utils"]["Math"].get<sol::table>();
+        MathNamespace.set_function("getSeed", obe::Utils::Math::getSeed);
+    }
     void LoadFunctionGetMin(sol::state_view state)
     {
         sol::table MathNamespace = state["obe"]["Utils"]["Math"].get<sol::table>();
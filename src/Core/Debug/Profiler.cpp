@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
+
+namespace obe::Debug
+{
+    std::atomic<bool> Profiler::Enabled = false;
+    std::atomic<std::uint64_t> Profiler::Frame = 0;
+
+    namespace
+    {
+        struct ZoneRecord
+        {
+            const char* name = nullptr;
+            std::uint64_t start = 0;
+            std::uint64_t end = 0;
+            std::uint64_t frame = 0;
+            unsigned int depth = 0;
+        };
+
+        struct ThreadBuffer
+        {
+            std::mutex mutex;
+            std::vector<ZoneRecord> zones;
+            std::size_t next = 0;
+            std::size_t count = 0;
+            unsigned int id = 0;
+            std::string name;
+        };
+
+        struct OpenZone
+        {
+            const char* name;
+            std::uint64_t start;
+            std::uint64_t frame;
+            unsigned int depth;
+        };
+
+        const std::chrono::steady_clock::time_point ClockStart
+            = std::chrono::steady_clock::now();
+
+        std::mutex BuffersMutex;
+        std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+        std::size_t Capacity = 65536;
+        unsigned int NextThreadId = 0;
+
+        std::mutex NamesMutex;
+        std::unordered_set<std::string> Names;
+
+        thread_local unsigned int Depth = 0;
+        thread_local std::vector<OpenZone> OpenZones;
+
+        ThreadBuffer& getThreadBuffer()
+        {
+            // Buffers are shared so zones of finished threads can still be exported
+            thread_local const std::shared_ptr<ThreadBuffer> buffer = []() {
+                auto newBuffer = std::make_shared<ThreadBuffer>();
+                const std::lock_guard lock(BuffersMutex);
+                newBuffer->id = NextThreadId++;
+                newBuffer->name = "Thread " + std::to_string(newBuffer->id);
+                newBuffer->zones.resize(Capacity);
+                Buffers.push_back(newBuffer);
+                return newBuffer;
+            }();
+            return *buffer;
+        }
+
+        void writeJsonString(std::ostream& output, std::string_view value)
+        {
+            output << '"';
+            for (const char character : value)
+            {
+                if (character == '"' || character == '\\')
+                    output << '\\' << character;
+                else if (static_cast<unsigned char>(character) < 0x20)
+                    output << ' ';
+                else
+                    output << character;
+            }
+            output << '"';
+        }
+    }
+
+    void Profiler::SetEnabled(bool enabled)
+    {
+#if defined(OBE_PROFILER_DISABLED)
+        if (enabled)
+            Log->warn("<Profiler> The profiler has been disabled at compile time");
+#else
+        Enabled = enabled;
+#endif
+    }
+
+    bool Profiler::IsEnabled()
+    {
+        return Enabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::SetCapacity(std::size_t capacity)
+    {
+        const std::lock_guard lock(BuffersMutex);
+        Capacity = std::max<std::size_t>(capacity, 1);
+        for (const auto& buffer : Buffers)
+        {
+            const std::lock_guard bufferLock(buffer->mutex);
+            buffer->zones.assign(Capacity, ZoneRecord());
+            buffer->next = 0;
+            buffer->count = 0;
+        }
+    }
+
+    void Profiler::BeginFrame()
+    {
+        Frame++;
+    }
+
+    std::uint64_t Profiler::GetFrame()
+    {
+        return Frame;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ThreadBuffer& buffer = getThreadBuffer();
+        const std::lock_guard lock(buffer.mutex);
+        buffer.name = name;
+    }
+
+    const char* Profiler::Intern(std::string_view name)
+    {
+        const std::lock_guard lock(NamesMutex);
+        return Names.emplace(name).first->c_str();
+    }
+
+    void Profiler::BeginZone(const std::string& name)
+    {
+        if (!IsEnabled())
+        {
+            OpenZones.push_back(OpenZone { nullptr, 0, 0, 0 });
+            return;
+        }
+        OpenZones.push_back(OpenZone { Intern(name), Now(), Frame, Depth++ });
+    }
+
+    void Profiler::EndZone()
+    {
+        if (OpenZones.empty())
+        {
+            Log->warn("<Profiler> EndZone called without a matching BeginZone");
+            return;
+        }
+        const OpenZone zone = OpenZones.back();
+        OpenZones.pop_back();
+        if (zone.name)
+        {
+            Depth--;
+            Record(zone.name, zone.start, Now(), zone.frame, zone.depth);
+        }
+    }
+
+    void Profiler::Record(const char* name, std::uint64_t start, std::uint64_t end,
+        std::uint64_t frame, unsigned int depth)
+    {
+        ThreadBuffer& buffer = getThreadBuffer();
+        const std::lock_guard lock(buffer.mutex);
+        buffer.zones[buffer.next] = ZoneRecord { name, start, end, frame, depth };
+        buffer.next = (buffer.next + 1) % buffer.zones.size();
+        buffer.count = std::min(buffer.count + 1, buffer.zones.size());
+    }
+
+    std::uint64_t Profiler::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - ClockStart)
+            .count();
+    }
+
+    void Profiler::Clear()
+    {
+        const std::lock_guard lock(BuffersMutex);
+        for (const auto& buffer : Buffers)
+        {
+            const std::lock_guard bufferLock(buffer->mutex);
+            buffer->next = 0;
+            buffer->count = 0;
+        }
+    }
+
+    std::size_t Profiler::ExportChromeTrace(
+        const std::string& path, std::uint64_t firstFrame, std::uint64_t lastFrame)
+    {
+        std::ofstream output(path);
+        if (!output)
+        {
+            Log->warn("<Profiler> Unable to write trace file '{}'", path);
+            return 0;
+        }
+        std::size_t exported = 0;
+        output << std::fixed << std::setprecision(3);
+        output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        const std::lock_guard lock(BuffersMutex);
+        for (const auto& buffer : Buffers)
+        {
+            std::vector<ZoneRecord> zones;
+            std::string threadName;
+            {
+                const std::lock_guard bufferLock(buffer->mutex);
+                const std::size_t size = buffer->zones.size();
+                const std::size_t first = (buffer->next + size - buffer->count) % size;
+                for (std::size_t i = 0; i < buffer->count; i++)
+                {
+                    const ZoneRecord& zone = buffer->zones[(first + i) % size];
+                    if (zone.frame >= firstFrame && zone.frame <= lastFrame)
+                        zones.push_back(zone);
+                }
+                threadName = buffer->name;
+            }
+            output << ((buffer != Buffers.front()) ? "," : "");
+            output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+                   << buffer->id << ",\"args\":{\"name\":";
+            writeJsonString(output, threadName);
+            output << "}}";
+            for (const ZoneRecord& zone : zones)
+            {
+                output << ",{\"name\":";
+                writeJsonString(output, zone.name);
+                output << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+                       << ",\"ts\":" << zone.start / 1000.0
+                       << ",\"dur\":" << (zone.end - zone.start) / 1000.0
+                       << ",\"args\":{\"frame\":" << zone.frame
+                       << ",\"depth\":" << zone.depth << "}}";
+            }
+            exported += zones.size();
+        }
+        output << "]}";
+        Log->info("<Profiler> Exported {} zones of frames {} to {} in '{}'", exported,
+            firstFrame, lastFrame, path);
+        return exported;
+    }
+
+    ProfilerZone::ProfilerZone(const char* name)
+        : m_name(name)
+        , m_active(Profiler::IsEnabled())
+    {
+        if (m_active)
+        {
+            m_frame = Profiler::GetFrame();
+            m_depth = Depth++;
+            m_start = Profiler::Now();
+        }
+    }
+
+    ProfilerZone::~ProfilerZone()
+    {
+        if (m_active)
+        {
+            Depth--;
+            Profiler::Record(m_name, m_start, Profiler::Now(), m_frame, m_depth);
+        }
+    }
+} // namespace obe::Debug
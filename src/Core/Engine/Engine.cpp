@@ -1,5 +1,9 @@
+#include <SFML/Window/VideoMode.hpp>
+
 #include <Engine/Engine.hpp>
+#include <Debug/Profiler.hpp>
 #include <Engine/Exceptions.hpp>
+#include <Utils/MathUtils.hpp>
 #include <Utils/StringUtils.hpp>
 
 int lua_exception_handler(lua_State* L,
@@ -22,6 +26,37 @@ namespace obe::Engine
     void Engine::initConfig()
     {
         m_config.load();
+        m_config.merge(m_configOverrides);
+    }
+
+    void Engine::initHeadless()
+    {
+        if (!m_config.contains("Headless"))
+            return;
+        const vili::node& headless = m_config.at("Headless");
+        if (headless.contains("enabled"))
+            m_headless = headless.at("enabled");
+        if (headless.contains("frames"))
+            m_headlessFrames = headless.at("frames").as<vili::integer>();
+        if (headless.contains("timestep"))
+        {
+            const vili::node& timestep = headless.at("timestep");
+            if (timestep.is_integer())
+                m_headlessTimestep = timestep.as<vili::integer>();
+            else
+                m_headlessTimestep = timestep.as<vili::number>();
+        }
+        // Display queries need a display server, the surface is configured instead
+        if (m_headless && Transform::UnitVector::Screen.w == 0)
+        {
+            const vili::integer width = (headless.contains("width"))
+                ? headless.at("width").as<vili::integer>()
+                : 1920;
+            const vili::integer height = (headless.contains("height"))
+                ? headless.at("height").as<vili::integer>()
+                : 1080;
+            Transform::UnitVector::Init(width, height);
+        }
     }
 
     void Engine::initTriggers()
@@ -31,7 +66,27 @@ namespace obe::Engine
         m_triggers->createNamespace("Event");
         t_game = m_triggers->createTriggerGroup("Event", "Game");
 
-        t_game->add("Start").trigger("Start").add("End").add("Update").add("Render");
+        t_game->add("Start")
+            .trigger("Start")
+            .add("End")
+            .add("Update")
+            .add("FixedUpdate")
+            .add("Render");
+        m_updateTrigger = t_game->getHandle("Update");
+        m_fixedUpdateTrigger = t_game->getHandle("FixedUpdate");
+        m_renderTrigger = t_game->getHandle("Render");
+
+        if (m_config.contains("Debug") && m_config.at("Debug").contains("triggerStats"))
+        {
+            const vili::node& triggerStats = m_config.at("Debug").at("triggerStats");
+            if (triggerStats.contains("enabled"))
+                m_triggers->getStatistics().setEnabled(triggerStats.at("enabled"));
+            if (triggerStats.contains("dumpCount"))
+            {
+                m_triggerStatsDumpCount
+                    = triggerStats.at("dumpCount").as<vili::integer>();
+            }
+        }
     }
     void Engine::initInput()
     {
@@ -44,9 +99,35 @@ namespace obe::Engine
         m_input->addContext("game");
     }
 
+    void Engine::initInputRecording()
+    {
+        if (!m_config.contains("InputRecording"))
+            return;
+        const vili::node& recording = m_config.at("InputRecording");
+        const std::string mode
+            = recording.contains("mode") ? recording.at("mode").as<vili::string>() : "";
+        const std::string path
+            = recording.contains("path") ? recording.at("path").as<vili::string>() : "";
+        if (mode == "record")
+        {
+            unsigned int seed = 0;
+            if (recording.contains("seed"))
+                seed = recording.at("seed").as<vili::integer>();
+            m_input->getRecorder().startRecording(
+                path, (seed) ? seed : Utils::Math::getSeed());
+        }
+        else if (mode == "replay")
+            m_input->getRecorder().startReplay(path);
+        else if (!mode.empty() && mode != "none")
+            Debug::Log->warn("<Engine> Unknown input recording mode '{}'", mode);
+    }
+
     void Engine::initFramerate()
     {
-        m_framerate = std::make_unique<Time::FramerateManager>(*m_window);
+        if (m_window)
+            m_framerate = std::make_unique<Time::FramerateManager>(*m_window);
+        else
+            m_framerate = std::make_unique<Time::FramerateManager>();
         m_framerate->configure(m_config.at("Framerate"));
     }
 
@@ -68,6 +149,14 @@ namespace obe::Engine
         m_lua->set_exception_handler(&lua_exception_handler);
 
         (*m_lua)["Engine"] = this;
+
+        m_gc = std::make_unique<Script::GarbageCollector>(*m_lua);
+        if (m_config.contains("Script"))
+        {
+            const vili::node& script = m_config.at("Script");
+            if (script.contains("garbageCollector"))
+                m_gc->configure(script.at("garbageCollector"));
+        }
     }
 
     void Engine::initResources()
@@ -83,15 +172,47 @@ namespace obe::Engine
                     m_resources->defaultAntiAliasing);
             }
         }
+        if (m_config.contains("Resources"))
+        {
+            m_resources->configure(m_config.at("Resources"));
+        }
     }
 
     void Engine::initWindow()
     {
+        if (Transform::UnitVector::Screen.w == 0)
+        {
+            const sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
+            Transform::UnitVector::Init(desktop.width, desktop.height);
+        }
+        Debug::Log->info("<Engine> Screen surface resolution {0}x{1}",
+            Transform::UnitVector::Screen.w, Transform::UnitVector::Screen.h);
         vili::node windowConfig = m_config.at("Window").at("Game");
         Debug::Log->debug("<Engine> Window configuration : {}", windowConfig.dump());
         m_window = std::make_unique<System::Window>(windowConfig);
     }
 
+    void Engine::initGraphics()
+    {
+        if (!m_config.contains("Graphics"))
+            return;
+        const vili::node& graphics = m_config.at("Graphics");
+        if (graphics.contains("renderStats"))
+        {
+            const vili::node& renderStats = graphics.at("renderStats");
+            if (renderStats.contains("enabled"))
+                Graphics::RenderStatsCollector::SetEnabled(renderStats.at("enabled"));
+            if (renderStats.contains("logInterval"))
+            {
+                const vili::node& logInterval = renderStats.at("logInterval");
+                if (logInterval.is_integer())
+                    m_renderStatsLogInterval = logInterval.as<vili::integer>();
+                else
+                    m_renderStatsLogInterval = logInterval.as<vili::number>();
+            }
+        }
+    }
+
     void Engine::initCursor()
     {
         m_cursor = std::make_unique<System::Cursor>(*m_window, *m_triggers);
@@ -136,6 +257,17 @@ namespace obe::Engine
                 Debug::Log->set_level(level);
                 Debug::Log->info("Log Level {}", logLevel);
             }
+            if (debug.contains("profiler"))
+            {
+                const vili::node& profiler = debug.at("profiler");
+                if (profiler.contains("capacity"))
+                {
+                    Debug::Profiler::SetCapacity(
+                        profiler.at("capacity").as<vili::integer>());
+                }
+                if (profiler.contains("enabled"))
+                    Debug::Profiler::SetEnabled(profiler.at("enabled"));
+            }
         }
     }
 
@@ -146,7 +278,20 @@ namespace obe::Engine
             t_game->trigger("End");
         }
         if (m_triggers)
+        {
             m_triggers->update();
+            m_triggers->getQueue().drain();
+            const Triggers::TriggerQueueStats& stats = m_triggers->getQueue().getStats();
+            if (stats.fired)
+            {
+                Debug::Log->debug("<Engine> Trigger queue : {} fires, {} coalesced, {} "
+                                  "executions, max depth {}, max drain time {:.3f}ms",
+                    stats.fired, stats.coalesced, stats.executed, stats.maxDepth,
+                    stats.maxDrainTime / Time::milliseconds);
+            }
+            if (m_triggers->getStatistics().isEnabled() && m_triggerStatsDumpCount)
+                m_triggers->getStatistics().dump(m_triggerStatsDumpCount);
+        }
         if (m_scene)
         {
             m_scene->clear();
@@ -165,6 +310,7 @@ namespace obe::Engine
         m_cursor.reset();
         m_framerate.reset();
         m_scene.reset();
+        m_gc.reset();
         if (m_lua)
         {
             m_lua->collect_garbage();
@@ -172,41 +318,76 @@ namespace obe::Engine
         }
         m_resources.reset();
         t_game.reset();
+        m_updateTrigger = Triggers::TriggerHandle();
+        m_fixedUpdateTrigger = Triggers::TriggerHandle();
+        m_renderTrigger = Triggers::TriggerHandle();
         m_input.reset();
         m_triggers.reset();
         m_lua.reset();
     }
 
+    bool Engine::updateFramerate()
+    {
+        Input::InputRecorder& recorder = m_input->getRecorder();
+        if (recorder.isReplaying())
+        {
+            Time::TimeUnit deltaTime = 0;
+            if (!recorder.replayFrame(deltaTime))
+                return false;
+            m_framerate->replay(deltaTime);
+        }
+        else
+            m_framerate->update();
+        recorder.recordFrame(m_framerate->getDeltaTime());
+        return true;
+    }
+
+    void Engine::handleWindowEvent(const sf::Event& event) const
+    {
+        switch (event.type)
+        {
+        case sf::Event::Closed:
+            m_window->close();
+            break;
+        case sf::Event::MouseButtonPressed:
+            [[fallthrough]];
+        case sf::Event::MouseButtonReleased:
+            [[fallthrough]];
+        case sf::Event::JoystickButtonPressed:
+            [[fallthrough]];
+        case sf::Event::JoystickButtonReleased:
+            [[fallthrough]];
+        case sf::Event::JoystickMoved:
+            [[fallthrough]];
+        case sf::Event::KeyReleased:
+            [[fallthrough]];
+        case sf::Event::KeyPressed:
+            m_input->requireRefresh();
+            if (event.key.code == sf::Keyboard::Escape)
+                m_window->close();
+            break;
+        default:
+            break;
+        }
+    }
+
     void Engine::handleWindowEvents() const
     {
+        OBE_PROFILE_ZONE("Engine::handleWindowEvents");
+        Input::InputRecorder& recorder = m_input->getRecorder();
         sf::Event event;
-        while (m_window->pollEvent(event))
+        while (m_window && m_window->pollEvent(event))
         {
-            switch (event.type)
-            {
-            case sf::Event::Closed:
-                m_window->close();
-                break;
-            case sf::Event::MouseButtonPressed:
-                [[fallthrough]];
-            case sf::Event::MouseButtonReleased:
-                [[fallthrough]];
-            case sf::Event::JoystickButtonPressed:
-                [[fallthrough]];
-            case sf::Event::JoystickButtonReleased:
-                [[fallthrough]];
-            case sf::Event::JoystickMoved:
-                [[fallthrough]];
-            case sf::Event::KeyReleased:
-                [[fallthrough]];
-            case sf::Event::KeyPressed:
-                m_input->requireRefresh();
-                if (event.key.code == sf::Keyboard::Escape)
-                    m_window->close();
-                break;
-            default:
-                break;
-            }
+            // While replaying, only the events of the recording are used
+            if (recorder.isReplaying() && event.type != sf::Event::Closed)
+                continue;
+            recorder.recordEvent(event);
+            this->handleWindowEvent(event);
+        }
+        if (recorder.isReplaying())
+        {
+            for (const sf::Event& replayedEvent : recorder.getReplayedEvents())
+                this->handleWindowEvent(replayedEvent);
         }
     }
 
@@ -230,13 +411,21 @@ namespace obe::Engine
 
     void Engine::init()
     {
+        Debug::Profiler::SetThreadName("Main");
         this->initConfig();
         this->initLogger();
+        this->initHeadless();
         this->initScript();
         this->initTriggers();
         this->initInput();
-        this->initWindow();
-        this->initCursor();
+        this->initInputRecording();
+        // The window owns an OpenGL context, it is not created in headless mode
+        if (!m_headless)
+        {
+            this->initWindow();
+            this->initGraphics();
+            this->initCursor();
+        }
         this->initFramerate();
         this->initPlugins();
         this->initResources();
@@ -261,7 +450,9 @@ namespace obe::Engine
             const auto errObj = loadResult.get<sol::error>();
             throw Exceptions::BootScriptLoadingError(errObj.what(), EXC_INFO);
         }
-        m_window->create();
+        if (!m_headless)
+            m_window->create();
+        Time::updateClock();
         const sol::protected_function bootFunction
             = (*m_lua)["Game"]["Start"].get<sol::protected_function>();
 
@@ -273,21 +464,107 @@ namespace obe::Engine
                 "Game.Start", errObj.what(), EXC_INFO);
         }
 
-        while (m_window->isOpen())
+        m_running = true;
+        if (m_headless)
         {
-            m_framerate->update();
+            this->runHeadless();
+            return;
+        }
+        while (m_running && m_window->isOpen())
+        {
+            Debug::Profiler::BeginFrame();
+            OBE_PROFILE_ZONE("Frame");
+            if (!this->updateFramerate())
+                break;
 
-            t_game->pushParameter("Update", "dt", m_framerate->getGameSpeed());
-            t_game->trigger("Update");
+            m_updateTrigger.pushParameter("dt", m_framerate->getGameSpeed()).trigger();
+
+            while (m_framerate->doFixedUpdate())
+            {
+                m_fixedUpdateTrigger.pushParameter("dt", m_framerate->getFixedTimestep())
+                    .trigger();
+            }
 
             if (m_framerate->doRender())
-                t_game->trigger("Render");
+            {
+                m_renderTrigger
+                    .pushParameter("alpha", m_framerate->getInterpolationAlpha())
+                    .trigger();
+            }
 
             this->update();
             this->render();
         }
     }
 
+    void Engine::runHeadless()
+    {
+        Debug::Log->info("<Engine> Running headless for {} frames with {} timestep",
+            (m_headlessFrames) ? std::to_string(m_headlessFrames) : "unlimited",
+            (m_headlessTimestep > 0) ? fmt::format("a {}s", m_headlessTimestep)
+                                     : std::string("a real time"));
+        Time::FrameTimeHistogram frameTimes(0.05 * Time::milliseconds, 2000);
+        const Time::TimeUnit runStart = Time::preciseNow();
+        Time::TimeUnit lastFrame = runStart;
+        Time::TimeUnit simulatedTime = 0;
+        std::size_t frames = 0;
+        while (m_running && (m_headlessFrames == 0 || frames < m_headlessFrames))
+        {
+            Debug::Profiler::BeginFrame();
+            OBE_PROFILE_ZONE("Frame");
+            const Time::TimeUnit frameStart = Time::preciseNow();
+            Time::TimeUnit deltaTime
+                = (m_headlessTimestep > 0) ? m_headlessTimestep : frameStart - lastFrame;
+            lastFrame = frameStart;
+            Input::InputRecorder& recorder = m_input->getRecorder();
+            if (recorder.isReplaying() && !recorder.replayFrame(deltaTime))
+                break;
+            m_framerate->step(deltaTime);
+            recorder.recordFrame(deltaTime);
+            simulatedTime += deltaTime;
+
+            m_updateTrigger.pushParameter("dt", m_framerate->getGameSpeed()).trigger();
+            while (m_framerate->doFixedUpdate())
+            {
+                m_fixedUpdateTrigger.pushParameter("dt", m_framerate->getFixedTimestep())
+                    .trigger();
+            }
+            this->update();
+            {
+                OBE_PROFILE_ZONE("GarbageCollector::update");
+                m_gc->update();
+            }
+            frameTimes.add(Time::preciseNow() - frameStart);
+            frames++;
+        }
+        const Time::TimeUnit elapsed = Time::preciseNow() - runStart;
+        Debug::Log->info("<Engine> Headless run : {} frames in {:.3f}s "
+                         "({:.1f} frames/s), {:.3f}s simulated",
+            frames, elapsed, (elapsed > 0) ? frames / elapsed : 0.0, simulatedTime);
+        Debug::Log->info("<Engine> Frame time (ms) : mean {:.3f}, min {:.3f}, "
+                         "p50 {:.3f}, p99 {:.3f}, max {:.3f}",
+            frameTimes.getMean() / Time::milliseconds,
+            frameTimes.getMin() / Time::milliseconds,
+            frameTimes.getPercentile(0.5) / Time::milliseconds,
+            frameTimes.getPercentile(0.99) / Time::milliseconds,
+            frameTimes.getMax() / Time::milliseconds);
+    }
+
+    void Engine::overrideConfiguration(const vili::node& overrides)
+    {
+        m_configOverrides = overrides;
+    }
+
+    void Engine::stop()
+    {
+        m_running = false;
+    }
+
+    bool Engine::isHeadless() const
+    {
+        return m_headless;
+    }
+
     Audio::AudioManager& Engine::getAudioManager()
     {
         return m_audio;
@@ -325,33 +602,101 @@ namespace obe::Engine
 
     System::Cursor& Engine::getCursor() const
     {
+        if (!m_cursor)
+            throw Exceptions::UnavailableInHeadlessMode("Cursor", EXC_INFO);
         return *m_cursor;
     }
 
     System::Window& Engine::getWindow() const
     {
+        if (!m_window)
+            throw Exceptions::UnavailableInHeadlessMode("Window", EXC_INFO);
         return *m_window;
     }
 
+    Script::GarbageCollector& Engine::getGarbageCollector() const
+    {
+        return *m_gc;
+    }
+
+    const Graphics::RenderStats& Engine::getRenderStats() const
+    {
+        return Graphics::RenderStatsCollector::GetLastFrame();
+    }
+
     void Engine::update() const
     {
+        OBE_PROFILE_ZONE("Engine::update");
         // Events
         this->handleWindowEvents();
+        m_resources->update();
+        if (m_scene->hasFutureLoad())
+            m_gc->notifySceneChange();
         m_scene->update();
         m_triggers->update();
+        // Queued Triggers fired by the Scene and the scheduled callbacks
+        m_triggers->getQueue().drain();
         m_input->update();
-        m_cursor->update();
+        if (m_cursor)
+            m_cursor->update();
+        // Queued Triggers fired by the inputs
+        m_triggers->getQueue().drain();
     }
 
     void Engine::render()
     {
-        m_lua->collect_garbage();
+        OBE_PROFILE_ZONE("Engine::render");
+        {
+            OBE_PROFILE_ZONE("GarbageCollector::update");
+            m_gc->update();
+        }
         if (m_framerate->doRender())
         {
+            Graphics::RenderStatsCollector::BeginFrame();
             m_window->clear();
             m_scene->draw(m_window->getTarget());
 
-            m_window->display();
+            {
+                OBE_PROFILE_ZONE("Window::display");
+                m_window->display();
+            }
+            Graphics::RenderStatsCollector::EndFrame();
+            this->logRenderStats();
         }
     }
+
+    void Engine::logRenderStats()
+    {
+        if (m_renderStatsLogInterval <= 0 || !Graphics::RenderStatsCollector::IsEnabled())
+            return;
+        const Graphics::RenderStats& frame
+            = Graphics::RenderStatsCollector::GetLastFrame();
+        const auto now = std::chrono::steady_clock::now();
+        if (m_renderStatsFrames == 0)
+            m_renderStatsLogStart = now;
+        m_renderStatsFrames++;
+        m_renderStatsTotal.drawCalls += frame.drawCalls;
+        m_renderStatsTotal.vertices += frame.vertices;
+        m_renderStatsTotal.textureBinds += frame.textureBinds;
+        m_renderStatsTotal.shaderSwitches += frame.shaderSwitches;
+        m_renderStatsTotal.sprites += frame.sprites;
+        m_renderStatsTotal.culledSprites += frame.culledSprites;
+        m_renderStatsTotal.canvasRedraws += frame.canvasRedraws;
+        m_renderStatsTotal.renderTime += frame.renderTime;
+
+        const std::chrono::duration<double> elapsed = now - m_renderStatsLogStart;
+        if (elapsed.count() < m_renderStatsLogInterval)
+            return;
+        const std::size_t frames = m_renderStatsFrames;
+        const Graphics::RenderStats& total = m_renderStatsTotal;
+        Debug::Log->info("<RenderStats> Average over {} frames : {} draw calls, {} "
+                         "vertices, {} texture binds, {} shader switches, {} sprites "
+                         "({} culled), {} canvas redraws, {:.3f}ms",
+            frames, total.drawCalls / frames, total.vertices / frames,
+            total.textureBinds / frames, total.shaderSwitches / frames,
+            total.sprites / frames, total.culledSprites / frames,
+            total.canvasRedraws / frames, total.renderTime / frames);
+        m_renderStatsTotal = Graphics::RenderStats();
+        m_renderStatsFrames = 0;
+    }
 }
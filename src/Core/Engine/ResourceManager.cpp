@@ -1,11 +1,107 @@
+#include <Debug/Profiler.hpp>
 #include <Engine/Exceptions.hpp>
 #include <Engine/ResourceManager.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
+#include <Graphics/Sprite.hpp>
 #include <System/Loaders.hpp>
 #include <System/Path.hpp>
 #include <Triggers/TriggerManager.hpp>
 
 namespace obe::Engine
 {
+    std::unique_ptr<Graphics::Texture> ResourceManager::packTexture(
+        const sf::Image& image, bool antiAliasing)
+    {
+        const sf::Vector2u imageSize = image.getSize();
+        if (imageSize.x > m_atlasMaxImageSize || imageSize.y > m_atlasMaxImageSize)
+            return nullptr;
+        std::unique_ptr<Graphics::TextureAtlas>& atlas
+            = (antiAliasing) ? m_atlases.second : m_atlases.first;
+        if (!atlas)
+        {
+            atlas = std::make_unique<Graphics::TextureAtlas>(
+                m_atlasPageSize, m_atlasPadding, antiAliasing);
+        }
+        if (std::optional<Graphics::Texture> view = atlas->insert(image); view)
+            return std::make_unique<Graphics::Texture>(*view);
+        return nullptr;
+    }
+
+    bool ResourceManager::decodeImage(
+        const std::string& path, const std::string& realPath, sf::Image& image) const
+    {
+        if (m_fileCache.loadImage(path, realPath, image))
+            return true;
+        if (!image.loadFromFile(realPath))
+            return false;
+        m_fileCache.store(path, realPath, image);
+        return true;
+    }
+
+    std::unique_ptr<Graphics::Texture>& ResourceManager::getTextureSlot(
+        const std::string& path, bool antiAliasing)
+    {
+        TexturePair& textures = m_textures[path];
+        return (antiAliasing) ? textures.second : textures.first;
+    }
+
+    void ResourceManager::trackTexture(const std::string& path, bool antiAliasing)
+    {
+        const Graphics::Texture& texture = *this->getTextureSlot(path, antiAliasing);
+        // Atlas views are accounted for with their atlas pages
+        std::size_t bytes = 0;
+        if (!texture.isView())
+        {
+            const Transform::UnitVector size = texture.getSize();
+            bytes = static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y)
+                * 4;
+        }
+        m_textureLru.track(TextureKey(path, antiAliasing), bytes);
+    }
+
+    void ResourceManager::touchTexture(const std::string& path, bool antiAliasing)
+    {
+        m_textureLru.touch(TextureKey(path, antiAliasing));
+    }
+
+    void ResourceManager::releaseTexture(const TextureKey& key)
+    {
+        this->getTextureSlot(key.first, key.second).reset();
+        m_textureLru.release(key);
+    }
+
+    void ResourceManager::evictTextures()
+    {
+        if (m_gpuMemoryBudget == 0)
+            return;
+        const std::vector<TextureKey> evictions = m_textureLru.selectEvictions(
+            m_textureLru.getBytes() + this->getAtlasBytes(), m_gpuMemoryBudget,
+            [this](const TextureKey& key) {
+                // Textures still referenced outside of the cache can't be evicted
+                return this->getTextureSlot(key.first, key.second)->useCount() == 1;
+            });
+        for (const TextureKey& key : evictions)
+        {
+            this->releaseTexture(key);
+            m_textureCacheStats.evictions++;
+            Debug::Log->debug("[ResourceManager] Evicted <Texture> {}", key.first);
+        }
+    }
+
+    std::size_t ResourceManager::getAtlasBytes() const
+    {
+        std::size_t bytes = 0;
+        for (const auto* atlas : { m_atlases.first.get(), m_atlases.second.get() })
+        {
+            if (atlas)
+            {
+                const std::size_t pageSize = atlas->getPageSize();
+                bytes += atlas->getPageCount() * pageSize * pageSize * 4;
+            }
+        }
+        return bytes;
+    }
+
     const Graphics::Texture& ResourceManager::getTexture(
         const std::string& path, bool antiAliasing)
     {
@@ -13,27 +109,52 @@ namespace obe::Engine
             || (!m_textures[path].first && !antiAliasing)
             || (!m_textures[path].second && antiAliasing))
         {
-            std::shared_ptr<sf::Texture> tempTexture = std::make_shared<sf::Texture>();
+            m_textureCacheStats.misses++;
+            std::shared_ptr<sf::Texture> tempTexture
+                = Graphics::SoftwareRenderTarget::MakeTexture();
+            std::unique_ptr<Graphics::Texture> texture;
             const std::string realPath = System::Path(path).find();
             Debug::Log->debug(
                 "[ResourceManager] Loading <Texture> {} from {}", path, realPath);
-            const bool success = tempTexture->loadFromFile(realPath);
-
-            if (success)
+            bool success;
+            if (m_atlasEnabled)
+            {
+                sf::Image image;
+                success = this->decodeImage(path, realPath, image);
+                if (success)
+                {
+                    texture = this->packTexture(image, antiAliasing);
+                    if (!texture)
+                        success = tempTexture->loadFromImage(image);
+                }
+            }
+            else if (m_fileCache.isEnabled())
             {
-                tempTexture->setSmooth(antiAliasing);
-                if (!antiAliasing)
+                success = m_fileCache.loadTexture(path, realPath, *tempTexture);
+                if (!success)
                 {
-                    m_textures[path].first
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].first;
+                    sf::Image image;
+                    success = this->decodeImage(path, realPath, image)
+                        && tempTexture->loadFromImage(image);
                 }
-                else
+            }
+            else
+            {
+                success = tempTexture->loadFromFile(realPath);
+            }
+
+            if (success)
+            {
+                if (!texture)
                 {
-                    m_textures[path].second
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].second;
+                    tempTexture->setSmooth(antiAliasing);
+                    texture = std::make_unique<Graphics::Texture>(tempTexture);
                 }
+                std::unique_ptr<Graphics::Texture>& slot
+                    = this->getTextureSlot(path, antiAliasing);
+                slot = std::move(texture);
+                this->trackTexture(path, antiAliasing);
+                return *slot;
             }
             else
                 throw Exceptions::TextureNotFound(
@@ -41,40 +162,306 @@ namespace obe::Engine
         }
         else
         {
-            if (antiAliasing)
+            m_textureCacheStats.hits++;
+            this->touchTexture(path, antiAliasing);
+            return *this->getTextureSlot(path, antiAliasing);
+        }
+    }
+
+    const Graphics::Texture& ResourceManager::getTexture(const std::string& path)
+    {
+        return getTexture(path, defaultAntiAliasing);
+    }
+
+    const Graphics::Texture& ResourceManager::getTextureAsync(
+        const std::string& path, bool antiAliasing)
+    {
+        std::unique_ptr<Graphics::Texture>& cached
+            = this->getTextureSlot(path, antiAliasing);
+        if (cached)
+        {
+            m_textureCacheStats.hits++;
+            this->touchTexture(path, antiAliasing);
+            return *cached;
+        }
+        m_textureCacheStats.misses++;
+
+        const std::string realPath = System::Path(path).find();
+        if (realPath.empty())
+        {
+            throw Exceptions::TextureNotFound(
+                path, System::MountablePath::StringPaths(), EXC_INFO);
+        }
+        Debug::Log->debug(
+            "[ResourceManager] Queuing <Texture> {} from {}", path, realPath);
+
+        if (m_placeholderImage.getSize().x == 0)
+            this->setPlaceholderTexture(Graphics::GetNullTexture());
+        std::shared_ptr<sf::Texture> texture
+            = Graphics::SoftwareRenderTarget::MakeTexture();
+        texture->loadFromImage(m_placeholderImage);
+        texture->setSmooth(antiAliasing);
+        std::shared_ptr<bool> loading = std::make_shared<bool>(true);
+        cached = std::make_unique<Graphics::Texture>(texture);
+        cached->setLoadingState(loading);
+        this->trackTexture(path, antiAliasing);
+
+        const std::size_t request = m_nextTextureRequest++;
+        m_pendingTextures.emplace(
+            request, PendingTexture { path, texture, antiAliasing, loading });
+        if (!m_decoders)
+            m_decoders = std::make_unique<Utils::Exec::ThreadPool>(m_decodeWorkers);
+        m_decoders->submit([this, request, path, realPath]() {
+            DecodedImage decoded { request, sf::Image(), false };
+            decoded.success = this->decodeImage(path, realPath, decoded.image);
+            const sf::Vector2u size = decoded.image.getSize();
+            const std::lock_guard lock(m_decodedImagesMutex);
+            m_decodedBytes += static_cast<std::size_t>(size.x) * size.y * 4;
+            m_decodedImages.push(std::move(decoded));
+        });
+        return *cached;
+    }
+
+    const Graphics::Texture& ResourceManager::getTextureAsync(const std::string& path)
+    {
+        return getTextureAsync(path, defaultAntiAliasing);
+    }
+
+    void ResourceManager::setPlaceholderTexture(const Graphics::Texture& texture)
+    {
+        const sf::Image image
+            = static_cast<const sf::Texture&>(texture).copyToImage();
+        const sf::IntRect rect = texture.getTextureRect();
+        m_placeholderImage.create(rect.width, rect.height);
+        m_placeholderImage.copy(image, 0, 0, rect);
+    }
+
+    void ResourceManager::setUploadBudget(std::size_t bytes)
+    {
+        m_uploadBudget = bytes;
+    }
+
+    std::size_t ResourceManager::getUploadBudget() const
+    {
+        return m_uploadBudget;
+    }
+
+    std::size_t ResourceManager::getPendingTextureCount() const
+    {
+        return m_pendingTextures.size();
+    }
+
+    void ResourceManager::setGpuMemoryBudget(std::size_t bytes)
+    {
+        m_gpuMemoryBudget = bytes;
+    }
+
+    std::size_t ResourceManager::getGpuMemoryBudget() const
+    {
+        return m_gpuMemoryBudget;
+    }
+
+    void ResourceManager::setCpuMemoryBudget(std::size_t bytes)
+    {
+        m_cpuMemoryBudget = bytes;
+    }
+
+    std::size_t ResourceManager::getCpuMemoryBudget() const
+    {
+        return m_cpuMemoryBudget;
+    }
+
+    TextureCacheStats ResourceManager::getTextureCacheStats() const
+    {
+        TextureCacheStats stats = m_textureCacheStats;
+        stats.residentBytes = m_textureLru.getBytes() + this->getAtlasBytes();
+        const std::lock_guard lock(m_decodedImagesMutex);
+        stats.pendingBytes = m_decodedBytes;
+        return stats;
+    }
+
+    void ResourceManager::update()
+    {
+        OBE_PROFILE_ZONE("ResourceManager::update");
+        std::size_t uploaded = 0;
+        while (!m_pendingTextures.empty())
+        {
+            DecodedImage decoded {};
+            {
+                const std::lock_guard lock(m_decodedImagesMutex);
+                if (m_decodedImages.empty())
+                    break;
+                const sf::Vector2u size = m_decodedImages.front().image.getSize();
+                const std::size_t bytes = static_cast<std::size_t>(size.x) * size.y * 4;
+                const bool overCpuBudget
+                    = m_cpuMemoryBudget > 0 && m_decodedBytes > m_cpuMemoryBudget;
+                if (uploaded > 0 && uploaded + bytes > m_uploadBudget && !overCpuBudget)
+                    break;
+                uploaded += bytes;
+                m_decodedBytes -= bytes;
+                decoded = std::move(m_decodedImages.front());
+                m_decodedImages.pop();
+            }
+            const auto pending = m_pendingTextures.find(decoded.request);
+            if (pending == m_pendingTextures.end())
+                continue;
+            if (decoded.success)
             {
-                return *m_textures[path].second;
+                const bool smooth = pending->second.texture->isSmooth();
+                pending->second.texture->loadFromImage(decoded.image);
+                pending->second.texture->setSmooth(smooth);
+                // The placeholder pixels may have been read back already
+                Graphics::SoftwareRenderTarget::InvalidateTexture(
+                    *pending->second.texture);
+                Debug::Log->debug("[ResourceManager] Uploaded <Texture> {}",
+                    pending->second.path);
+                const PendingTexture& texture = pending->second;
+                if (this->getTextureSlot(texture.path, texture.antiAliasing))
+                    this->trackTexture(texture.path, texture.antiAliasing);
             }
             else
             {
-                return *m_textures[path].first;
+                Debug::Log->error("[ResourceManager] Unable to decode <Texture> {}, "
+                                  "keeping placeholder",
+                    pending->second.path);
             }
+            *pending->second.loading = false;
+            m_pendingTextures.erase(pending);
         }
+        this->evictTextures();
     }
 
-    const Graphics::Texture& ResourceManager::getTexture(const std::string& path)
+    void ResourceManager::clean()
+    {
+        for (auto& [path, texturePair] : m_textures)
+        {
+            if (texturePair.first && texturePair.first->useCount() == 1)
+            {
+                this->releaseTexture(TextureKey(path, false));
+            }
+            if (texturePair.second && texturePair.second->useCount() == 1)
+            {
+                this->releaseTexture(TextureKey(path, true));
+            }
+        }
+        for (auto shader = m_shaders.begin(); shader != m_shaders.end();)
+        {
+            if (shader->second.use_count() == 1)
+                shader = m_shaders.erase(shader);
+            else
+                ++shader;
+        }
+        const TextureCacheStats stats = this->getTextureCacheStats();
+        Debug::Log->info("<ResourceManager> Texture cache : {} hits, {} misses, "
+                         "{} evictions, {} resident bytes",
+            stats.hits, stats.misses, stats.evictions, stats.residentBytes);
+    }
+    ResourceManager::ResourceManager()
+        : defaultAntiAliasing(false)
     {
-        return getTexture(path, defaultAntiAliasing);
     }
 
-    void ResourceManager::clean()
+    void ResourceManager::configure(vili::node& config)
     {
-        for (auto& texturePair : m_textures)
+        if (config.contains("atlas"))
         {
-            if (texturePair.second.first && texturePair.second.first->useCount() == 1)
+            vili::node& atlas = config.at("atlas");
+            const bool enabled
+                = !atlas.contains("enabled") || atlas.at("enabled").as<vili::boolean>();
+            if (enabled)
             {
-                texturePair.second.first.reset();
+                unsigned int pageSize = m_atlasPageSize;
+                unsigned int padding = m_atlasPadding;
+                unsigned int maxImageSize = m_atlasMaxImageSize;
+                if (atlas.contains("pageSize"))
+                    pageSize = atlas.at("pageSize");
+                if (atlas.contains("padding"))
+                    padding = atlas.at("padding");
+                if (atlas.contains("maxImageSize"))
+                    maxImageSize = atlas.at("maxImageSize");
+                this->enableAtlas(pageSize, padding, maxImageSize);
             }
-            if (texturePair.second.second && texturePair.second.second->useCount() == 1)
+            else
             {
-                texturePair.second.second.reset();
+                this->disableAtlas();
             }
         }
+        if (config.contains("async"))
+        {
+            vili::node& async = config.at("async");
+            if (async.contains("workers"))
+                m_decodeWorkers = async.at("workers");
+            if (async.contains("uploadBudget"))
+                m_uploadBudget = async.at("uploadBudget").as<vili::integer>();
+        }
+        if (config.contains("fileCache"))
+        {
+            vili::node& fileCache = config.at("fileCache");
+            const bool enabled = !fileCache.contains("enabled")
+                || fileCache.at("enabled").as<vili::boolean>();
+            if (enabled)
+            {
+                std::string directory = ".cache";
+                if (fileCache.contains("directory"))
+                    directory = fileCache.at("directory").as<vili::string>();
+                m_fileCache.enable(directory);
+            }
+            else
+            {
+                m_fileCache.disable();
+            }
+        }
+        if (config.contains("cache"))
+        {
+            vili::node& cache = config.at("cache");
+            if (cache.contains("gpuBudget"))
+                m_gpuMemoryBudget = cache.at("gpuBudget").as<vili::integer>();
+            if (cache.contains("cpuBudget"))
+                m_cpuMemoryBudget = cache.at("cpuBudget").as<vili::integer>();
+        }
     }
 
-    ResourceManager::ResourceManager()
-        : defaultAntiAliasing(false)
+    void ResourceManager::enableAtlas(
+        unsigned int pageSize, unsigned int padding, unsigned int maxImageSize)
+    {
+        Debug::Log->debug("<ResourceManager> Texture atlas enabled (page size : {}, "
+                          "padding : {}, max image size : {})",
+            pageSize, padding, maxImageSize);
+        if (pageSize != m_atlasPageSize || padding != m_atlasPadding)
+        {
+            // Existing pages stay alive as long as a Texture view uses them
+            m_atlases.first.reset();
+            m_atlases.second.reset();
+        }
+        m_atlasEnabled = true;
+        m_atlasPageSize = pageSize;
+        m_atlasPadding = padding;
+        m_atlasMaxImageSize = maxImageSize;
+    }
+
+    void ResourceManager::disableAtlas()
+    {
+        m_atlasEnabled = false;
+    }
+
+    bool ResourceManager::isAtlasEnabled() const
+    {
+        return m_atlasEnabled;
+    }
+
+    void ResourceManager::enableFileCache(const std::string& directory)
+    {
+        m_fileCache.enable(directory);
+    }
+
+    void ResourceManager::disableFileCache()
     {
+        m_fileCache.disable();
+    }
+
+    bool ResourceManager::isFileCacheEnabled() const
+    {
+        return m_fileCache.isEnabled();
     }
 
     std::shared_ptr<Graphics::Font> ResourceManager::getFont(const std::string& path)
@@ -96,6 +483,29 @@ namespace obe::Engine
         return m_fonts[path];
     }
 
+    std::shared_ptr<Graphics::Shader> ResourceManager::getShader(
+        const std::string& path, const std::vector<std::string>& defines)
+    {
+        std::vector<std::string> sortedDefines = defines;
+        std::sort(sortedDefines.begin(), sortedDefines.end());
+        std::string key = path;
+        for (const std::string& define : sortedDefines)
+            key += ";" + define;
+
+        if (const auto shader = m_shaders.find(key); shader != m_shaders.end())
+            return shader->second;
+        auto shader = std::make_shared<Graphics::Shader>();
+        if (!shader->loadShader(path, defines))
+        {
+            throw Exceptions::ShaderLoadingError(
+                path, System::MountablePath::StringPaths(), EXC_INFO);
+        }
+        Debug::Log->debug("[ResourceManager] Loading <Shader> {} ({} defines)", path,
+            defines.size());
+        m_shaders[key] = shader;
+        return shader;
+    }
+
     void ResourceManagedObject::removeResourceManager()
     {
         m_resources = nullptr;
@@ -0,0 +1,312 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <Debug/Logger.hpp>
+#include <Engine/TextureFileCache.hpp>
+#include <Utils/FileUtils.hpp>
+
+namespace obe::Engine
+{
+    static_assert(sizeof(TextureFileCacheHeader) == 32,
+        "TextureFileCacheHeader must not contain any padding");
+
+    namespace
+    {
+        constexpr char CacheMagic[4] = { 'O', 'B', 'T', 'X' };
+        constexpr std::uint32_t CacheVersion = 2;
+
+        struct SourceInfo
+        {
+            std::uint64_t size;
+            std::int64_t modificationTime;
+        };
+
+        /**
+         * \brief Get the size and the modification time (in nanoseconds since
+         *        the Unix epoch) of a file, whole seconds would miss the
+         *        changes made within the second the cache file was written
+         */
+        std::optional<SourceInfo> getSourceInfo(const std::string& path)
+        {
+#if defined(_WIN32) || defined(_WIN64)
+            WIN32_FILE_ATTRIBUTE_DATA attributes;
+            if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+                return std::nullopt;
+            const std::uint64_t size
+                = (static_cast<std::uint64_t>(attributes.nFileSizeHigh) << 32)
+                | attributes.nFileSizeLow;
+            // FILETIME counts intervals of 100 nanoseconds since 1601
+            constexpr std::int64_t UnixEpoch = 116444736000000000;
+            const std::int64_t writeTime = static_cast<std::int64_t>(
+                (static_cast<std::uint64_t>(attributes.ftLastWriteTime.dwHighDateTime)
+                    << 32)
+                | attributes.ftLastWriteTime.dwLowDateTime);
+            return SourceInfo { size, (writeTime - UnixEpoch) * 100 };
+#else
+            struct stat status;
+            if (stat(path.c_str(), &status) != 0)
+                return std::nullopt;
+#if defined(__APPLE__)
+            const struct timespec& modificationTime = status.st_mtimespec;
+#else
+            const struct timespec& modificationTime = status.st_mtim;
+#endif
+            return SourceInfo { static_cast<std::uint64_t>(status.st_size),
+                static_cast<std::int64_t>(modificationTime.tv_sec) * 1000000000
+                    + modificationTime.tv_nsec };
+#endif
+        }
+
+        /**
+         * \brief Read-only memory mapping of a whole file
+         */
+        class MappedFile
+        {
+        private:
+            const std::uint8_t* m_data = nullptr;
+            std::size_t m_size = 0;
+#if defined(_WIN32) || defined(_WIN64)
+            HANDLE m_file = INVALID_HANDLE_VALUE;
+            HANDLE m_mapping = nullptr;
+#endif
+
+        public:
+            explicit MappedFile(const std::string& path)
+            {
+#if defined(_WIN32) || defined(_WIN64)
+                m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (m_file == INVALID_HANDLE_VALUE)
+                    return;
+                LARGE_INTEGER size;
+                if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+                    return;
+                m_mapping
+                    = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (!m_mapping)
+                    return;
+                m_data = static_cast<const std::uint8_t*>(
+                    MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                if (m_data)
+                    m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+                const int file = open(path.c_str(), O_RDONLY);
+                if (file < 0)
+                    return;
+                struct stat status;
+                if (fstat(file, &status) == 0 && status.st_size > 0)
+                {
+                    void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size),
+                        PROT_READ, MAP_PRIVATE, file, 0);
+                    if (data != MAP_FAILED)
+                    {
+                        m_data = static_cast<const std::uint8_t*>(data);
+                        m_size = static_cast<std::size_t>(status.st_size);
+                    }
+                }
+                close(file);
+#endif
+            }
+
+            ~MappedFile()
+            {
+#if defined(_WIN32) || defined(_WIN64)
+                if (m_data)
+                    UnmapViewOfFile(m_data);
+                if (m_mapping)
+                    CloseHandle(m_mapping);
+                if (m_file != INVALID_HANDLE_VALUE)
+                    CloseHandle(m_file);
+#else
+                if (m_data)
+                    munmap(const_cast<std::uint8_t*>(m_data), m_size);
+#endif
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            [[nodiscard]] const std::uint8_t* data() const
+            {
+                return m_data;
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return m_size;
+            }
+        };
+
+        /**
+         * \brief Checks a mapped cache file against its source image
+         * \return The pixels stored in the cache file or nullptr if the file is
+         *         invalid or outdated
+         */
+        const std::uint8_t* getCachedPixels(
+            const MappedFile& file, const std::string& realPath, sf::Vector2u& imageSize)
+        {
+            if (!file.data() || file.size() < sizeof(TextureFileCacheHeader))
+                return nullptr;
+            TextureFileCacheHeader header;
+            std::memcpy(&header, file.data(), sizeof(header));
+            const std::optional<SourceInfo> source = getSourceInfo(realPath);
+            if (!source || std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0
+                || header.version != CacheVersion || header.sourceSize != source->size
+                || header.sourceModificationTime != source->modificationTime)
+                return nullptr;
+            const std::size_t pixelsSize
+                = static_cast<std::size_t>(header.width) * header.height * 4;
+            if (pixelsSize == 0 || file.size() != sizeof(header) + pixelsSize)
+                return nullptr;
+            imageSize = sf::Vector2u(header.width, header.height);
+            return file.data() + sizeof(header);
+        }
+
+        void createParentDirectories(const std::string& path)
+        {
+            for (std::size_t separator = path.find('/'); separator != std::string::npos;
+                 separator = path.find('/', separator + 1))
+            {
+                const std::string directory = path.substr(0, separator);
+                if (!directory.empty() && !Utils::File::directoryExists(directory))
+                    Utils::File::createDirectory(directory);
+            }
+        }
+    }
+
+    std::string TextureFileCache::getCachePath(
+        const std::string& path, const std::string& realPath) const
+    {
+        // Only paths relative to a mounted path can be mirrored in the cache directory
+        if (path.empty() || path.front() == '/' || path.find("..") != std::string::npos
+            || path.find(':') != std::string::npos || realPath.size() < path.size()
+            || realPath.compare(realPath.size() - path.size(), path.size(), path) != 0)
+            return "";
+        std::string directory;
+        {
+            const std::lock_guard lock(m_mutex);
+            if (!m_enabled)
+                return "";
+            directory = m_directory;
+        }
+        const std::string mountPath = realPath.substr(0, realPath.size() - path.size());
+        return mountPath + directory + "/" + path + ".rgba";
+    }
+
+    void TextureFileCache::enable(const std::string& directory)
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_enabled = true;
+            m_directory = directory;
+        }
+        Debug::Log->debug(
+            "<TextureFileCache> Texture file cache enabled in '{}'", directory);
+    }
+
+    void TextureFileCache::disable()
+    {
+        const std::lock_guard lock(m_mutex);
+        m_enabled = false;
+    }
+
+    bool TextureFileCache::isEnabled() const
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_enabled;
+    }
+
+    bool TextureFileCache::loadTexture(
+        const std::string& path, const std::string& realPath, sf::Texture& texture) const
+    {
+        const std::string cachePath = this->getCachePath(path, realPath);
+        if (cachePath.empty())
+            return false;
+        const MappedFile file(cachePath);
+        sf::Vector2u size;
+        const std::uint8_t* pixels = getCachedPixels(file, realPath, size);
+        if (!pixels || !texture.create(size.x, size.y))
+            return false;
+        texture.update(pixels);
+        return true;
+    }
+
+    bool TextureFileCache::loadImage(
+        const std::string& path, const std::string& realPath, sf::Image& image) const
+    {
+        const std::string cachePath = this->getCachePath(path, realPath);
+        if (cachePath.empty())
+            return false;
+        const MappedFile file(cachePath);
+        sf::Vector2u size;
+        const std::uint8_t* pixels = getCachedPixels(file, realPath, size);
+        if (!pixels)
+            return false;
+        image.create(size.x, size.y, pixels);
+        return true;
+    }
+
+    bool TextureFileCache::store(const std::string& path, const std::string& realPath,
+        const sf::Image& image) const
+    {
+        const std::string cachePath = this->getCachePath(path, realPath);
+        const std::optional<SourceInfo> source = getSourceInfo(realPath);
+        const sf::Vector2u size = image.getSize();
+        if (cachePath.empty() || !source || size.x == 0 || size.y == 0)
+            return false;
+
+        createParentDirectories(cachePath);
+        TextureFileCacheHeader header {};
+        std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.version = CacheVersion;
+        header.width = size.x;
+        header.height = size.y;
+        header.sourceSize = source->size;
+        header.sourceModificationTime = source->modificationTime;
+
+        // Written in a temporary file first so readers never map a partial file
+        std::ostringstream temporaryPath;
+        temporaryPath << cachePath << ".tmp" << std::this_thread::get_id();
+        {
+            std::ofstream file(temporaryPath.str(), std::ios::binary);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(image.getPixelsPtr()),
+                static_cast<std::streamsize>(size.x) * size.y * 4);
+            if (!file)
+            {
+                Debug::Log->warn("<TextureFileCache> Unable to write cache file '{}'",
+                    temporaryPath.str());
+                std::remove(temporaryPath.str().c_str());
+                return false;
+            }
+        }
+        // std::rename does not replace existing files on every platform
+        std::remove(cachePath.c_str());
+        if (std::rename(temporaryPath.str().c_str(), cachePath.c_str()) != 0)
+        {
+            std::remove(temporaryPath.str().c_str());
+            return false;
+        }
+        Debug::Log->trace("<TextureFileCache> Stored '{}' in '{}'", path, cachePath);
+        return true;
+    }
+} // namespace obe::Engine
@@ -0,0 +1,67 @@
+#include <Engine/TextureLru.hpp>
+
+namespace obe::Engine
+{
+    void TextureLru::track(const TextureKey& key, const std::size_t bytes)
+    {
+        if (const auto usage = m_usages.find(key); usage != m_usages.end())
+        {
+            m_bytes -= usage->second.bytes;
+            usage->second.bytes = bytes;
+            m_order.splice(m_order.begin(), m_order, usage->second.lruPosition);
+        }
+        else
+        {
+            m_order.push_front(key);
+            m_usages.emplace(key, TextureUsage { bytes, m_order.begin() });
+        }
+        m_bytes += bytes;
+    }
+
+    void TextureLru::touch(const TextureKey& key)
+    {
+        if (const auto usage = m_usages.find(key); usage != m_usages.end())
+            m_order.splice(m_order.begin(), m_order, usage->second.lruPosition);
+    }
+
+    void TextureLru::release(const TextureKey& key)
+    {
+        if (const auto usage = m_usages.find(key); usage != m_usages.end())
+        {
+            m_bytes -= usage->second.bytes;
+            m_order.erase(usage->second.lruPosition);
+            m_usages.erase(usage);
+        }
+    }
+
+    bool TextureLru::contains(const TextureKey& key) const
+    {
+        return m_usages.find(key) != m_usages.end();
+    }
+
+    std::size_t TextureLru::getBytes() const
+    {
+        return m_bytes;
+    }
+
+    std::vector<TextureKey> TextureLru::getOrder() const
+    {
+        return std::vector<TextureKey>(m_order.rbegin(), m_order.rend());
+    }
+
+    std::vector<TextureKey> TextureLru::selectEvictions(std::size_t residentBytes,
+        const std::size_t budget,
+        const std::function<bool(const TextureKey&)>& isEvictable) const
+    {
+        std::vector<TextureKey> evictions;
+        for (auto position = m_order.rbegin();
+             position != m_order.rend() && residentBytes > budget; ++position)
+        {
+            if (!isEvictable(*position))
+                continue;
+            evictions.push_back(*position);
+            residentBytes -= m_usages.at(*position).bytes;
+        }
+        return evictions;
+    }
+} // namespace obe::Engine
@@ -1,7 +1,11 @@
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <bezier/bezier.h>
 
 #include <Graphics/Canvas.hpp>
+#include <Graphics/DrawUtils.hpp>
+#include <Graphics/RenderThread.hpp>
 #include <System/Loaders.hpp>
 #include <Utils/StringUtils.hpp>
 
@@ -42,17 +46,154 @@ namespace obe::Graphics::Canvas
         return os;
     }
 
+    namespace
+    {
+        using OptionalRect = std::optional<sf::FloatRect>;
+        OptionalRect uniteBounds(const OptionalRect& first, const OptionalRect& second)
+        {
+            if (!first)
+                return second;
+            if (!second)
+                return first;
+            const float left = std::min(first->left, second->left);
+            const float top = std::min(first->top, second->top);
+            const float right
+                = std::max(first->left + first->width, second->left + second->width);
+            const float bottom
+                = std::max(first->top + first->height, second->top + second->height);
+            return sf::FloatRect(left, top, right - left, bottom - top);
+        }
+
+        /**
+         * \brief Get the color of a cubic curve of a Bezier at the given position
+         * \param colors Colors of the control points of the Bezier
+         * \param curveIndex Index of the first control point of the cubic curve
+         * \param t Position on the cubic curve (between 0 and 1)
+         */
+        Color getCurveColor(
+            const std::vector<Color>& colors, std::size_t curveIndex, double t)
+        {
+            const double tc = fmod(t * 4, 4);
+            const std::size_t first
+                = (t >= 1) ? 3 : static_cast<std::size_t>(floor(t * 4));
+            const std::size_t second
+                = (t >= 0.75) ? 3 : static_cast<std::size_t>(ceil(t * 4));
+            return (colors[first + curveIndex] * (1 - tc))
+                + (colors[second + curveIndex] * tc);
+        }
+
+        struct CubicCurve
+        {
+            sf::Vector2f p0;
+            sf::Vector2f p1;
+            sf::Vector2f p2;
+            sf::Vector2f p3;
+        };
+
+        float distanceToChord(const CubicCurve& curve, const sf::Vector2f& point)
+        {
+            const sf::Vector2f chord = curve.p3 - curve.p0;
+            const sf::Vector2f offset = point - curve.p0;
+            const float length = std::sqrt(chord.x * chord.x + chord.y * chord.y);
+            if (length == 0.f)
+                return std::sqrt(offset.x * offset.x + offset.y * offset.y);
+            return std::abs(chord.x * offset.y - chord.y * offset.x) / length;
+        }
+
+        constexpr unsigned int MaxBezierSubdivisions = 16;
+
+        /**
+         * \brief Appends the end of each flat enough part of the curve, using
+         *        de Casteljau's algorithm to split the parts that are not
+         */
+        void subdivideCurve(const CubicCurve& curve, double tStart, double tEnd,
+            unsigned int depth, float flatness, const std::vector<Color>& colors,
+            std::size_t curveIndex, std::vector<sf::Vertex>& vertices)
+        {
+            if (depth >= MaxBezierSubdivisions
+                || std::max(distanceToChord(curve, curve.p1),
+                       distanceToChord(curve, curve.p2))
+                    <= flatness)
+            {
+                vertices.emplace_back(curve.p3, getCurveColor(colors, curveIndex, tEnd));
+                return;
+            }
+            const sf::Vector2f p01 = (curve.p0 + curve.p1) * 0.5f;
+            const sf::Vector2f p12 = (curve.p1 + curve.p2) * 0.5f;
+            const sf::Vector2f p23 = (curve.p2 + curve.p3) * 0.5f;
+            const sf::Vector2f p012 = (p01 + p12) * 0.5f;
+            const sf::Vector2f p123 = (p12 + p23) * 0.5f;
+            const sf::Vector2f middle = (p012 + p123) * 0.5f;
+            const double tMiddle = (tStart + tEnd) / 2;
+            subdivideCurve({ curve.p0, p01, p012, middle }, tStart, tMiddle, depth + 1,
+                flatness, colors, curveIndex, vertices);
+            subdivideCurve({ middle, p123, p23, curve.p3 }, tMiddle, tEnd, depth + 1,
+                flatness, colors, curveIndex, vertices);
+        }
+
+        bool batchShape(const sf::Shape& shape, CanvasBatch& batch)
+        {
+            if (shape.getTexture())
+                return false;
+            sf::VertexArray& vertices = batch.get(sf::Triangles);
+            Utils::tessellateShape(shape, vertices, vertices);
+            return true;
+        }
+    }
+
+    CanvasBatch::CanvasBatch(RenderTarget target)
+        : m_target(target)
+    {
+    }
+
+    sf::VertexArray& CanvasBatch::get(sf::PrimitiveType type)
+    {
+        if (m_vertices.getPrimitiveType() != type)
+        {
+            this->flush();
+            m_vertices.setPrimitiveType(type);
+        }
+        return m_vertices;
+    }
+
+    void CanvasBatch::flush()
+    {
+        if (m_vertices.getVertexCount() > 0)
+        {
+            RenderStatsCollector::CountDraw(m_vertices, sf::RenderStates::Default);
+            m_target.draw(m_vertices);
+            m_vertices.clear();
+        }
+    }
+
     CanvasElement::CanvasElement(Canvas& parent, const std::string& id)
         : ProtectedIdentifiable(id)
         , parent(parent)
     {
     }
 
+    void CanvasElement::markDirty()
+    {
+        m_dirty = true;
+        parent.m_dirty = true;
+    }
+
+    bool CanvasElement::isDirty() const
+    {
+        return m_dirty;
+    }
+
+    bool CanvasElement::batch(CanvasBatch&) const
+    {
+        return false;
+    }
+
     void CanvasElement::setLayer(const unsigned int layer)
     {
         if (this->layer != layer)
         {
             this->layer = layer;
+            this->markDirty();
             parent.requiresSort();
         }
     }
@@ -72,6 +213,27 @@ namespace obe::Graphics::Canvas
         target.draw(line, 2, sf::Lines);
     }
 
+    bool Line::batch(CanvasBatch& batch) const
+    {
+        const Transform::UnitVector p1px = p1.to<Transform::Units::ScenePixels>();
+        const Transform::UnitVector p2px = p2.to<Transform::Units::ScenePixels>();
+        sf::VertexArray& vertices = batch.get(sf::Lines);
+        vertices.append(sf::Vertex(sf::Vector2f(p1px.x, p1px.y), p1color));
+        vertices.append(sf::Vertex(sf::Vector2f(p2px.x, p2px.y), p2color));
+        return true;
+    }
+
+    sf::FloatRect Line::getBounds() const
+    {
+        const Transform::UnitVector p1px = p1.to<Transform::Units::ScenePixels>();
+        const Transform::UnitVector p2px = p2.to<Transform::Units::ScenePixels>();
+        const float left = std::min(p1px.x, p2px.x);
+        const float top = std::min(p1px.y, p2px.y);
+        // Lines are rasterized one pixel wide, even when horizontal or vertical
+        return sf::FloatRect(left - 1, top - 1, std::abs(p2px.x - p1px.x) + 2,
+            std::abs(p2px.y - p1px.y) + 2);
+    }
+
     CanvasPositionable::CanvasPositionable(Canvas& parent, const std::string& id)
         : CanvasElement(parent, id)
     {
@@ -87,9 +249,20 @@ namespace obe::Graphics::Canvas
 
     void Rectangle::draw(RenderTarget target)
     {
+        RenderStatsCollector::CountDraw(shape.shape, sf::RenderStates::Default);
         target.draw(shape);
     }
 
+    bool Rectangle::batch(CanvasBatch& batch) const
+    {
+        return batchShape(shape.shape, batch);
+    }
+
+    sf::FloatRect Rectangle::getBounds() const
+    {
+        return shape.shape.getGlobalBounds();
+    }
+
     Text::Text(Canvas& parent, const std::string& id)
         : CanvasPositionable(parent, id)
         , h_align()
@@ -110,20 +283,36 @@ namespace obe::Graphics::Canvas
         else if (v_align == TextVerticalAlign::Bottom)
             offset.y -= shape.getGlobalBounds().getSize().y;
         shape.move(offset);
+        RenderStatsCollector::CountDraw(shape.shape, sf::RenderStates::Default);
         target.draw(shape);
         shape.move(-offset);
     }
 
+    sf::FloatRect Text::getBounds() const
+    {
+        sf::FloatRect bounds = shape.shape.getGlobalBounds();
+        if (h_align == TextHorizontalAlign::Center)
+            bounds.left -= bounds.width / 2;
+        else if (h_align == TextHorizontalAlign::Right)
+            bounds.left -= bounds.width;
+        if (v_align == TextVerticalAlign::Center)
+            bounds.top -= bounds.height / 2;
+        else if (v_align == TextVerticalAlign::Bottom)
+            bounds.top -= bounds.height;
+        return bounds;
+    }
+
     void Text::refresh()
     {
         shape.clear();
-        for (auto text : texts)
+        for (const Graphics::Text& text : texts)
         {
             if (!text.string.empty())
             {
                 shape.append(text);
             }
         }
+        this->markDirty();
     }
 
     Graphics::Text& Text::currentText()
@@ -138,9 +327,20 @@ namespace obe::Graphics::Canvas
 
     void Circle::draw(RenderTarget target)
     {
+        RenderStatsCollector::CountDraw(shape.shape, sf::RenderStates::Default);
         target.draw(shape);
     }
 
+    bool Circle::batch(CanvasBatch& batch) const
+    {
+        return batchShape(shape.shape, batch);
+    }
+
+    sf::FloatRect Circle::getBounds() const
+    {
+        return shape.shape.getGlobalBounds();
+    }
+
     Polygon::Polygon(Canvas& parent, const std::string& id)
         : CanvasPositionable(parent, id)
     {
@@ -148,52 +348,117 @@ namespace obe::Graphics::Canvas
 
     void Polygon::draw(RenderTarget target)
     {
+        RenderStatsCollector::CountDraw(shape.shape, sf::RenderStates::Default);
         target.draw(shape);
     }
 
+    bool Polygon::batch(CanvasBatch& batch) const
+    {
+        return batchShape(shape.shape, batch);
+    }
+
+    sf::FloatRect Polygon::getBounds() const
+    {
+        return shape.shape.getGlobalBounds();
+    }
+
     Bezier::Bezier(Canvas& parent, const std::string& id)
         : CanvasElement(parent, id)
     {
     }
 
-    void Bezier::draw(RenderTarget target)
+    bool Bezier::updateControlPoints()
     {
-        std::vector<::Bezier::Point> controlPoints;
-        controlPoints.reserve(points.size());
-        for (Transform::UnitVector& point : points)
+        bool changed = m_cachedPoints.size() != points.size() || m_cachedColors != colors
+            || m_cachedPrecision != precision || m_cachedAdaptive != adaptive
+            || m_cachedFlatness != flatness;
+        m_cachedPoints.resize(points.size());
+        for (std::size_t i = 0; i < points.size(); i++)
         {
             const Transform::UnitVector pixelPosition
-                = point.to<Transform::Units::ScenePixels>();
-            controlPoints.push_back(::Bezier::Point(pixelPosition.x, pixelPosition.y));
+                = points[i].to<Transform::Units::ScenePixels>();
+            const sf::Vector2f point(pixelPosition.x, pixelPosition.y);
+            if (m_cachedPoints[i] != point)
+            {
+                m_cachedPoints[i] = point;
+                changed = true;
+            }
         }
-        std::vector<::Bezier::Bezier<3>> bezierCurves;
-        bezierCurves.reserve((controlPoints.size() - 1) / 3);
-        for (std::size_t i = 3; i < controlPoints.size(); i += 3)
+        if (changed)
+        {
+            m_cachedColors = colors;
+            m_cachedPrecision = precision;
+            m_cachedAdaptive = adaptive;
+            m_cachedFlatness = flatness;
+        }
+        return changed;
+    }
+
+    void Bezier::tessellate()
+    {
+        const std::size_t steps = (precision % 2) ? precision : precision + 1;
+        for (std::size_t curveIndex = 0; curveIndex + 3 < m_cachedPoints.size();
+             curveIndex += 3)
+        {
+            std::vector<::Bezier::Point> bezierPoints;
+            for (std::size_t i = curveIndex; i <= curveIndex + 3; i++)
+                bezierPoints.emplace_back(m_cachedPoints[i].x, m_cachedPoints[i].y);
+            const ::Bezier::Bezier<3> bezier(bezierPoints);
+            for (std::size_t i = 0; i < steps; i++)
+            {
+                const double t = static_cast<double>(i) / precision;
+                const ::Bezier::Point p = bezier.valueAt(t);
+                m_vertices.emplace_back(
+                    sf::Vector2f(p.x, p.y), getCurveColor(m_cachedColors, curveIndex, t));
+            }
+        }
+    }
+
+    void Bezier::tessellateAdaptive()
+    {
+        const float tolerance = std::max(flatness, 0.01f);
+        for (std::size_t curveIndex = 0; curveIndex + 3 < m_cachedPoints.size();
+             curveIndex += 3)
         {
-            auto bezierPoints = std::vector<::Bezier::Point>(
-                controlPoints.begin() + (i - 3), controlPoints.begin() + (i + 1));
-            bezierCurves.push_back(bezierPoints);
+            const CubicCurve curve { m_cachedPoints[curveIndex],
+                m_cachedPoints[curveIndex + 1], m_cachedPoints[curveIndex + 2],
+                m_cachedPoints[curveIndex + 3] };
+            // Cubic curves are joined, their first point is the end of the previous one
+            if (curveIndex == 0)
+                m_vertices.emplace_back(curve.p0, getCurveColor(m_cachedColors, 0, 0));
+            subdivideCurve(
+                curve, 0, 1, 0, tolerance, m_cachedColors, curveIndex, m_vertices);
         }
-        const std::size_t maximum = bezierCurves.size() * precision;
-        std::vector<sf::Vertex> vertices;
-        vertices.reserve(maximum);
+    }
 
-        std::size_t curveIndex = 0;
-        for (::Bezier::Bezier<3>& bezier : bezierCurves)
+    void Bezier::draw(RenderTarget target)
+    {
+        if (this->updateControlPoints())
         {
-            for (std::size_t i = 0; i < (precision % 2 ? precision : precision + 1); i++)
+            m_vertices.clear();
+            if (colors.size() >= points.size())
             {
-                double t = static_cast<double>(i) / precision;
-                double tc = fmod(t * 4, 4);
-                Color firstColor = colors[((t >= 1) ? 3 : floor(t * 4)) + curveIndex];
-                Color secondColor = colors[((t >= 0.75) ? 3 : ceil(t * 4)) + curveIndex];
-                Color color = (firstColor * (1 - tc)) + (secondColor * tc);
-                ::Bezier::Point p = bezier.valueAt(t);
-                vertices.emplace_back(sf::Vector2f(p.x, p.y), color);
+                if (adaptive)
+                    this->tessellateAdaptive();
+                else
+                    this->tessellate();
             }
-            curveIndex += 3;
         }
-        target.draw(vertices.data(), maximum, sf::LineStrip);
+        if (m_vertices.size() > 1)
+            target.draw(m_vertices.data(), m_vertices.size(), sf::LineStrip);
+    }
+
+    sf::FloatRect Bezier::getBounds() const
+    {
+        std::optional<sf::FloatRect> bounds;
+        for (const Transform::UnitVector& point : points)
+        {
+            const Transform::UnitVector pixelPosition
+                = point.to<Transform::Units::ScenePixels>();
+            bounds = uniteBounds(
+                bounds, sf::FloatRect(pixelPosition.x - 1, pixelPosition.y - 1, 2, 2));
+        }
+        return bounds.value_or(sf::FloatRect());
     }
 
     void Canvas::sortElements()
@@ -206,59 +471,231 @@ namespace obe::Graphics::Canvas
 
     Canvas::Canvas(unsigned int width, unsigned int height)
     {
-        m_canvas.create(width, height);
+        if (SoftwareRenderTarget::IsEnabled())
+        {
+            m_softwareCanvas = std::make_unique<SoftwareRenderTarget>(width, height);
+            m_softwareTexture.create(width, height);
+        }
+        else
+        {
+            m_canvas = SoftwareRenderTarget::MakeRenderTexture();
+            m_canvas->create(width, height);
+        }
+    }
+
+    Canvas::~Canvas()
+    {
+        SoftwareRenderTarget::InvalidateTexture(m_softwareTexture);
+        RenderThread::ReleaseAfterPresent(std::move(m_canvas));
+        RenderThread::ReleaseAfterPresent(std::move(m_spareCanvas));
+    }
+
+    void Canvas::swapCanvasTexture(bool keepContent)
+    {
+        std::shared_ptr<sf::RenderTexture> previous = std::move(m_canvas);
+        // The spare texture is only shared with the frames that still use it
+        if (m_spareCanvas && m_spareCanvas.use_count() == 1)
+            m_canvas = std::move(m_spareCanvas);
+        else
+        {
+            const sf::Vector2u size = previous->getSize();
+            m_canvas = SoftwareRenderTarget::MakeRenderTexture();
+            m_canvas->create(size.x, size.y);
+        }
+        if (keepContent)
+            m_canvas->draw(sf::Sprite(previous->getTexture()), sf::BlendNone);
+        RenderThread::ReleaseAfterPresent(previous);
+        m_spareCanvas = std::move(previous);
+    }
+
+    RenderTarget Canvas::getCanvasTarget()
+    {
+        if (m_softwareCanvas)
+            return *m_softwareCanvas;
+        return *m_canvas;
+    }
+
+    const sf::Texture& Canvas::getCanvasTexture() const
+    {
+        if (m_softwareCanvas)
+            return m_softwareTexture;
+        return m_canvas->getTexture();
     }
 
     CanvasElement* Canvas::get(const std::string& id)
     {
-        for (auto& elem : m_elements)
+        if (const auto element = m_elementsById.find(id); element != m_elementsById.end())
+            return element->second;
+        return nullptr;
+    }
+
+    void Canvas::redraw(const std::optional<sf::IntRect>& region)
+    {
+        RenderStatsCollector::CountCanvasRedraw();
+        // Frames waiting for the render thread may still sample the texture
+        if (!m_softwareCanvas && RenderThread::IsActive())
+            this->swapCanvasTexture(region.has_value());
+        const RenderTarget canvas = this->getCanvasTarget();
+        if (!region)
         {
-            if (elem->getId() == id)
+            canvas.clear(Color(0, 0, 0, 0));
+            CanvasBatch batch(canvas);
+            for (auto& element : m_elements)
             {
-                return elem.get();
+                if (element->visible && !element->batch(batch))
+                {
+                    batch.flush();
+                    element->draw(canvas);
+                }
             }
+            batch.flush();
+        }
+        else
+        {
+            // The viewport clips drawing to the region, everything else is kept
+            const sf::Vector2u canvasSize = canvas.getSize();
+            sf::View regionView { sf::FloatRect(*region) };
+            regionView.setViewport(sf::FloatRect(
+                static_cast<float>(region->left) / static_cast<float>(canvasSize.x),
+                static_cast<float>(region->top) / static_cast<float>(canvasSize.y),
+                static_cast<float>(region->width) / static_cast<float>(canvasSize.x),
+                static_cast<float>(region->height) / static_cast<float>(canvasSize.y)));
+            canvas.setView(regionView);
+
+            sf::RectangleShape eraser(sf::Vector2f(region->width, region->height));
+            eraser.setPosition(region->left, region->top);
+            eraser.setFillColor(sf::Color(0, 0, 0, 0));
+            RenderStatsCollector::CountDraw(eraser, sf::RenderStates(sf::BlendNone));
+            canvas.draw(eraser, sf::RenderStates(sf::BlendNone));
+
+            const sf::FloatRect regionBounds(*region);
+            CanvasBatch batch(canvas);
+            for (auto& element : m_elements)
+            {
+                if (element->visible && element->m_renderedBounds
+                    && element->m_renderedBounds->intersects(regionBounds)
+                    && !element->batch(batch))
+                {
+                    batch.flush();
+                    element->draw(canvas);
+                }
+            }
+            batch.flush();
+            canvas.setView(canvas.getDefaultView());
+        }
+        if (m_softwareCanvas)
+        {
+            m_softwareTexture.update(m_softwareCanvas->getPixels().data());
+            SoftwareRenderTarget::SetTextureImage(
+                m_softwareTexture, m_softwareCanvas->copyToImage());
+        }
+        else
+        {
+            m_canvas->display();
+            SoftwareRenderTarget::InvalidateTexture(m_canvas->getTexture());
         }
-        return nullptr;
     }
 
     void Canvas::render(Sprite& target)
     {
-        m_canvas.clear(sf::Color(0, 0, 0, 0));
-
         if (m_sortRequired)
         {
             this->sortElements();
             m_sortRequired = false;
+            m_redrawRequired = true;
         }
 
-        for (auto& element : m_elements)
+        if (m_dirty || m_redrawRequired)
         {
-            if (element->visible)
-                element->draw(m_canvas);
+            std::optional<sf::FloatRect> dirtyBounds = m_removedBounds;
+            for (auto& element : m_elements)
+            {
+                if (element->m_dirty || m_redrawRequired)
+                {
+                    dirtyBounds = uniteBounds(dirtyBounds, element->m_renderedBounds);
+                    element->m_renderedBounds.reset();
+                    if (element->visible)
+                        element->m_renderedBounds = element->getBounds();
+                    dirtyBounds = uniteBounds(dirtyBounds, element->m_renderedBounds);
+                    element->m_dirty = false;
+                }
+            }
+
+            const sf::Vector2u canvasSize = this->getCanvasTexture().getSize();
+            std::optional<sf::IntRect> region;
+            if (!m_redrawRequired && dirtyBounds)
+            {
+                // Extended to whole pixels, with a margin for anti-aliased edges
+                const sf::FloatRect& bounds = *dirtyBounds;
+                const int left
+                    = std::max(0, static_cast<int>(std::floor(bounds.left)) - 1);
+                const int top = std::max(0, static_cast<int>(std::floor(bounds.top)) - 1);
+                const int right = std::min(static_cast<int>(canvasSize.x),
+                    static_cast<int>(std::ceil(bounds.left + bounds.width)) + 1);
+                const int bottom = std::min(static_cast<int>(canvasSize.y),
+                    static_cast<int>(std::ceil(bounds.top + bounds.height)) + 1);
+                if (right > left && bottom > top)
+                    region = sf::IntRect(left, top, right - left, bottom - top);
+            }
+
+            const std::size_t canvasArea
+                = static_cast<std::size_t>(canvasSize.x) * canvasSize.y;
+            if (m_redrawRequired
+                || (region
+                    && static_cast<std::size_t>(region->width) * region->height * 2
+                        >= canvasArea))
+                this->redraw(std::nullopt);
+            else if (region)
+                this->redraw(region);
+
+            m_removedBounds.reset();
+            m_redrawRequired = false;
+            m_dirty = false;
         }
-        m_canvas.display();
-        target.setTexture(m_canvas.getTexture());
+        target.setTexture(this->getCanvasTexture());
     }
 
     void Canvas::clear()
     {
         m_elements.clear();
+        m_elementsById.clear();
+        m_removedBounds.reset();
+        this->markDirty();
     }
 
     void Canvas::remove(const std::string& id)
     {
-        m_elements.erase(std::remove_if(m_elements.begin(), m_elements.end(),
-                             [&id](auto& elem) { return elem->getId() == id; }),
-            m_elements.end());
+        if (m_elementsById.erase(id) == 0)
+            return;
+        // Ids are unique, the element is looked up before being destroyed to keep
+        // its bounds
+        const auto element = std::find_if(m_elements.begin(), m_elements.end(),
+            [&id](const auto& elem) { return elem->getId() == id; });
+        if (element == m_elements.end())
+            return;
+        m_removedBounds = uniteBounds(m_removedBounds, (*element)->m_renderedBounds);
+        m_dirty = true;
+        m_elements.erase(element);
     }
 
     Texture Canvas::getTexture() const
     {
-        return m_canvas.getTexture();
+        return this->getCanvasTexture();
     }
 
     void Canvas::requiresSort()
     {
         m_sortRequired = true;
     }
+
+    void Canvas::markDirty()
+    {
+        m_dirty = true;
+        m_redrawRequired = true;
+    }
+
+    bool Canvas::isDirty() const
+    {
+        return m_dirty || m_redrawRequired || m_sortRequired;
+    }
 } // namespace obe::Graphics::Canvas
\ No newline at end of file
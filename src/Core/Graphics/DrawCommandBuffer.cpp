@@ -0,0 +1,144 @@
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Graphics/DrawCommandBuffer.hpp>
+#include <Graphics/DrawUtils.hpp>
+
+namespace obe::Graphics
+{
+    void DrawCommandBuffer::reset(
+        sf::Vector2u size, const sf::View& view, const sf::View& defaultView)
+    {
+        m_commands.clear();
+        m_vertices.clear();
+        m_views.clear();
+        m_uniforms.clear();
+        m_size = size;
+        m_defaultView = defaultView;
+        this->setView(view);
+    }
+
+    void DrawCommandBuffer::clear(const Color& color)
+    {
+        Command command;
+        command.type = CommandType::Clear;
+        command.color = color;
+        m_commands.push_back(command);
+    }
+
+    void DrawCommandBuffer::setView(const sf::View& view)
+    {
+        Command command;
+        command.type = CommandType::SetView;
+        command.first = m_views.size();
+        m_views.push_back(view);
+        m_commands.push_back(command);
+    }
+
+    const sf::View& DrawCommandBuffer::getView() const
+    {
+        if (m_views.empty())
+            return m_defaultView;
+        return m_views.back();
+    }
+
+    const sf::View& DrawCommandBuffer::getDefaultView() const
+    {
+        return m_defaultView;
+    }
+
+    sf::Vector2u DrawCommandBuffer::getSize() const
+    {
+        return m_size;
+    }
+
+    void DrawCommandBuffer::draw(
+        const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        const bool supported = Utils::decomposeDrawable(drawable, states,
+            [this](const sf::Vertex* vertices, std::size_t vertexCount,
+                sf::PrimitiveType type, const sf::RenderStates& primitiveStates) {
+                this->draw(vertices, vertexCount, type, primitiveStates);
+            });
+        static bool warned = false;
+        if (!supported && !warned)
+        {
+            Debug::Log->warn("<DrawCommandBuffer> Drawables other than sprites, shapes, "
+                             "vertex arrays and RichText are not rendered");
+            warned = true;
+        }
+    }
+
+    void DrawCommandBuffer::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+        sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if (!vertices || vertexCount == 0)
+            return;
+        Command command;
+        command.type = CommandType::Draw;
+        command.first = m_vertices.size();
+        command.count = vertexCount;
+        command.primitive = type;
+        command.states = states;
+        m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+        m_commands.push_back(command);
+    }
+
+    void DrawCommandBuffer::draw(
+        const sf::Drawable& drawable, Shader& shader, const ShaderUniforms& uniforms)
+    {
+        const std::size_t firstCommand = m_commands.size();
+        this->draw(drawable, sf::RenderStates(&shader));
+        if (m_commands.size() == firstCommand)
+            return;
+        m_uniforms.push_back(uniforms);
+        for (std::size_t i = firstCommand; i < m_commands.size(); i++)
+        {
+            m_commands[i].shader = &shader;
+            m_commands[i].uniforms = m_uniforms.size() - 1;
+        }
+    }
+
+    void DrawCommandBuffer::retain(std::shared_ptr<const void> resource)
+    {
+        if (resource)
+            m_resources.push_back(std::move(resource));
+    }
+
+    void DrawCommandBuffer::releaseResources()
+    {
+        m_resources.clear();
+    }
+
+    void DrawCommandBuffer::replay(sf::RenderTarget& target) const
+    {
+        for (const Command& command : m_commands)
+        {
+            switch (command.type)
+            {
+            case CommandType::Clear:
+                target.clear(command.color);
+                break;
+            case CommandType::SetView:
+                target.setView(m_views[command.first]);
+                break;
+            case CommandType::Draw:
+                if (command.shader)
+                    command.shader->applyUniforms(m_uniforms[command.uniforms]);
+                target.draw(&m_vertices[command.first], command.count, command.primitive,
+                    command.states);
+                break;
+            }
+        }
+    }
+
+    std::size_t DrawCommandBuffer::getCommandAmount() const
+    {
+        return m_commands.size();
+    }
+
+    std::size_t DrawCommandBuffer::getVertexAmount() const
+    {
+        return m_vertices.size();
+    }
+} // namespace obe::Graphics
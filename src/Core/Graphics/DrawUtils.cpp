@@ -1,6 +1,13 @@
+#include <cmath>
+
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <sfe/ComplexSprite.hpp>
 
 #include <Graphics/DrawUtils.hpp>
+#include <Graphics/Shapes.hpp>
+#include <Graphics/Text.hpp>
 #include <System/Window.hpp>
 
 namespace obe::Graphics::Utils // <REVISION> Move to Utils/ ?
@@ -20,6 +27,7 @@ namespace obe::Graphics::Utils // <REVISION> Move to Utils/ ?
         drawPt.setRadius(radius);
         drawPt.setPosition(sf::Vector2f(x, y));
         drawPt.setFillColor(color);
+        RenderStatsCollector::CountDraw(drawPt, sf::RenderStates::Default);
         surface.draw(drawPt);
     }
 
@@ -70,8 +78,165 @@ namespace obe::Graphics::Utils // <REVISION> Move to Utils/ ?
                     options, ("point_color_" + std::to_string(i)).c_str(), pointColor);
                 polyPt.setFillColor(currentPointColor);
                 polyPt.setPosition(point1.x - pointRadius, point1.y - pointRadius);
+                RenderStatsCollector::CountDraw(polyPt, sf::RenderStates::Default);
                 surface.draw(polyPt);
             }
         }
     }
+
+    namespace
+    {
+        sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2)
+        {
+            sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+            const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+            if (length != 0.f)
+                normal /= length;
+            return normal;
+        }
+    }
+
+    void tessellateShape(
+        const sf::Shape& shape, sf::VertexArray& fill, sf::VertexArray& outline)
+    {
+        const std::size_t count = shape.getPointCount();
+        if (count < 3)
+            return;
+        const sf::Transform& transform = shape.getTransform();
+        const sf::FloatRect bounds = shape.getLocalBounds();
+        const sf::IntRect textureRect = shape.getTextureRect();
+        const auto toVertex = [&](const sf::Vector2f& point, const sf::Color& color) {
+            const float xRatio
+                = (bounds.width > 0) ? (point.x - bounds.left) / bounds.width : 0;
+            const float yRatio
+                = (bounds.height > 0) ? (point.y - bounds.top) / bounds.height : 0;
+            return sf::Vertex(transform.transformPoint(point), color,
+                sf::Vector2f(textureRect.left + textureRect.width * xRatio,
+                    textureRect.top + textureRect.height * yRatio));
+        };
+
+        const sf::Color fillColor = shape.getFillColor();
+        const sf::Vertex origin = toVertex(shape.getPoint(0), fillColor);
+        sf::Vertex previous = toVertex(shape.getPoint(1), fillColor);
+        for (std::size_t i = 2; i < count; i++)
+        {
+            const sf::Vertex current = toVertex(shape.getPoint(i), fillColor);
+            fill.append(origin);
+            fill.append(previous);
+            fill.append(current);
+            previous = current;
+        }
+
+        const float thickness = shape.getOutlineThickness();
+        const sf::Color outlineColor = shape.getOutlineColor();
+        if (thickness == 0.f)
+            return;
+        const sf::Vector2f center(
+            bounds.left + bounds.width / 2, bounds.top + bounds.height / 2);
+        std::vector<sf::Vector2f> inner(count);
+        std::vector<sf::Vector2f> outer(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const sf::Vector2f p0 = shape.getPoint((i + count - 1) % count);
+            const sf::Vector2f p1 = shape.getPoint(i);
+            const sf::Vector2f p2 = shape.getPoint((i + 1) % count);
+            sf::Vector2f n1 = computeNormal(p0, p1);
+            sf::Vector2f n2 = computeNormal(p1, p2);
+            // Normals have to point towards the outside of the shape
+            if (n1.x * (center.x - p1.x) + n1.y * (center.y - p1.y) > 0)
+                n1 = -n1;
+            if (n2.x * (center.x - p1.x) + n2.y * (center.y - p1.y) > 0)
+                n2 = -n2;
+            const float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+            const sf::Vector2f normal = (n1 + n2) / factor;
+            inner[i] = transform.transformPoint(p1);
+            outer[i] = transform.transformPoint(p1 + normal * thickness);
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::size_t next = (i + 1) % count;
+            outline.append(sf::Vertex(inner[i], outlineColor));
+            outline.append(sf::Vertex(outer[i], outlineColor));
+            outline.append(sf::Vertex(inner[next], outlineColor));
+            outline.append(sf::Vertex(inner[next], outlineColor));
+            outline.append(sf::Vertex(outer[i], outlineColor));
+            outline.append(sf::Vertex(outer[next], outlineColor));
+        }
+    }
+
+    bool decomposeDrawable(const sf::Drawable& drawable, const sf::RenderStates& states,
+        const PrimitiveCallback& callback)
+    {
+        sf::RenderStates drawableStates(states);
+        if (const auto* sprite = dynamic_cast<const sfe::ComplexSprite*>(&drawable))
+        {
+            if (!sprite->getTexture())
+                return true;
+            drawableStates.transform *= sprite->getTransform();
+            drawableStates.texture = sprite->getTexture();
+            callback(sprite->getVertices(), 4, sf::TriangleStrip, drawableStates);
+        }
+        else if (const auto* sfSprite = dynamic_cast<const sf::Sprite*>(&drawable))
+        {
+            if (!sfSprite->getTexture())
+                return true;
+            const sf::FloatRect bounds = sfSprite->getLocalBounds();
+            const sf::IntRect rect = sfSprite->getTextureRect();
+            const float left = static_cast<float>(rect.left);
+            const float right = left + rect.width;
+            const float top = static_cast<float>(rect.top);
+            const float bottom = top + rect.height;
+            const sf::Color color = sfSprite->getColor();
+            const float width = bounds.width;
+            const float height = bounds.height;
+            const sf::Vertex vertices[] = {
+                sf::Vertex(sf::Vector2f(0, 0), color, sf::Vector2f(left, top)),
+                sf::Vertex(sf::Vector2f(0, height), color, sf::Vector2f(left, bottom)),
+                sf::Vertex(sf::Vector2f(width, 0), color, sf::Vector2f(right, top)),
+                sf::Vertex(
+                    sf::Vector2f(width, height), color, sf::Vector2f(right, bottom)),
+            };
+            drawableStates.transform *= sfSprite->getTransform();
+            drawableStates.texture = sfSprite->getTexture();
+            callback(vertices, 4, sf::TriangleStrip, drawableStates);
+        }
+        else if (const auto* shape = dynamic_cast<const sf::Shape*>(&drawable))
+        {
+            sf::VertexArray fill(sf::Triangles);
+            sf::VertexArray outline(sf::Triangles);
+            tessellateShape(*shape, fill, outline);
+            drawableStates.texture = shape->getTexture();
+            decomposeDrawable(fill, drawableStates, callback);
+            drawableStates.texture = nullptr;
+            decomposeDrawable(outline, drawableStates, callback);
+        }
+        else if (const auto* array = dynamic_cast<const sf::VertexArray*>(&drawable))
+        {
+            if (array->getVertexCount() > 0)
+            {
+                callback(&(*array)[0], array->getVertexCount(),
+                    array->getPrimitiveType(), states);
+            }
+        }
+        else if (const auto* richText = dynamic_cast<const RichText*>(&drawable))
+        {
+            if (!richText->getFont())
+                return true;
+            drawableStates.transform *= richText->getTransform();
+            drawableStates.texture = &static_cast<const sf::Font&>(richText->getFont())
+                                          .getTexture(richText->getCharacterSize());
+            decomposeDrawable(richText->getVertices(), drawableStates, callback);
+        }
+        else if (const auto* rect = dynamic_cast<const Shapes::Rectangle*>(&drawable))
+            return decomposeDrawable(rect->shape, states, callback);
+        else if (const auto* circle = dynamic_cast<const Shapes::Circle*>(&drawable))
+            return decomposeDrawable(circle->shape, states, callback);
+        else if (const auto* polygon = dynamic_cast<const Shapes::Polygon*>(&drawable))
+            return decomposeDrawable(polygon->shape, states, callback);
+        else if (const auto* text = dynamic_cast<const Shapes::Text*>(&drawable))
+            return decomposeDrawable(text->shape, states, callback);
+        else
+            return false;
+        return true;
+    }
 } // namespace obe::Graphics::Utils
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <Engine/ResourceManager.hpp>
+#include <Graphics/ParticleEmitter.hpp>
+#include <System/Path.hpp>
+#include <Time/TimeUtils.hpp>
+#include <Utils/ExecUtils.hpp>
+#include <Utils/MathUtils.hpp>
+
+#include <vili/node.hpp>
+
+namespace obe::Graphics
+{
+    namespace
+    {
+        /**
+         * \brief Shortest lifetime given to a particle (in seconds), the age of
+         *        a particle is divided by its lifetime
+         */
+        constexpr float MinimumLifetime = 0.001f;
+
+        /**
+         * \brief Worker shared by all emitters, simulations are small enough
+         *        to run one after the other
+         */
+        Utils::Exec::ThreadPool& getSimulationWorker()
+        {
+            static Utils::Exec::ThreadPool worker(1);
+            return worker;
+        }
+
+        double toDouble(const vili::node& number)
+        {
+            if (number.is_integer())
+                return static_cast<double>(number.as<vili::integer>());
+            return number.as<vili::number>();
+        }
+
+        Color loadColor(const vili::node& color)
+        {
+            if (color.is<vili::string>())
+                return Color(color.as<vili::string>());
+            const double alpha = color.contains("a") ? toDouble(color.at("a")) : 255;
+            return Color(toDouble(color.at("r")), toDouble(color.at("g")),
+                toDouble(color.at("b")), alpha);
+        }
+
+        vili::node dumpColor(const Color& color)
+        {
+            return vili::object { { "r", color.r }, { "g", color.g }, { "b", color.b },
+                { "a", color.a } };
+        }
+
+        void loadRange(const vili::node& range, double& min, double& max)
+        {
+            if (range.is_numeric())
+            {
+                min = max = toDouble(range);
+                return;
+            }
+            if (range.contains("min"))
+                min = toDouble(range.at("min"));
+            if (range.contains("max"))
+                max = toDouble(range.at("max"));
+        }
+    }
+
+    ParticleEmitter::ParticleEmitter(const std::string& id)
+        : Component(id)
+        , m_random(static_cast<unsigned int>(
+              Utils::Math::randint(1, std::numeric_limits<int>::max())))
+    {
+    }
+
+    ParticleEmitter::~ParticleEmitter()
+    {
+        this->waitForSimulation();
+    }
+
+    void ParticleEmitter::attachResourceManager(Engine::ResourceManager& resources)
+    {
+        m_resources = &resources;
+    }
+
+    void ParticleEmitter::waitForSimulation()
+    {
+        if (m_job.valid())
+        {
+            m_job.wait();
+            m_job = std::future<void>();
+        }
+    }
+
+    void ParticleEmitter::simulate(const ParticleEmitterSettings& settings,
+        const float dt, std::size_t spawnAmount, const float originX, const float originY)
+    {
+        std::size_t count = m_positionX.size();
+        float* positionX = m_positionX.data();
+        float* positionY = m_positionY.data();
+        float* velocityX = m_velocityX.data();
+        float* velocityY = m_velocityY.data();
+        float* age = m_age.data();
+        const float* lifetime = m_lifetime.data();
+
+        // Branchless loops over contiguous arrays, left to the compiler to vectorize
+        const float gravityX = static_cast<float>(settings.gravityX) * dt;
+        const float gravityY = static_cast<float>(settings.gravityY) * dt;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            velocityX[i] += gravityX;
+            velocityY[i] += gravityY;
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            positionX[i] += velocityX[i] * dt;
+            positionY[i] += velocityY[i] * dt;
+            age[i] += dt;
+        }
+
+        // Dead particles are replaced by the last one to keep the arrays packed
+        for (std::size_t i = 0; i < count;)
+        {
+            if (age[i] >= lifetime[i])
+            {
+                count--;
+                m_positionX[i] = m_positionX[count];
+                m_positionY[i] = m_positionY[count];
+                m_velocityX[i] = m_velocityX[count];
+                m_velocityY[i] = m_velocityY[count];
+                m_age[i] = m_age[count];
+                m_lifetime[i] = m_lifetime[count];
+            }
+            else
+                i++;
+        }
+
+        if (count >= settings.maxParticles)
+            spawnAmount = 0;
+        else
+            spawnAmount = std::min(spawnAmount, settings.maxParticles - count);
+        const std::size_t newCount = count + spawnAmount;
+        m_positionX.resize(newCount);
+        m_positionY.resize(newCount);
+        m_velocityX.resize(newCount);
+        m_velocityY.resize(newCount);
+        m_age.resize(newCount);
+        m_lifetime.resize(newCount);
+
+        std::uniform_real_distribution<float> spread(-1.f, 1.f);
+        std::uniform_real_distribution<float> speed(static_cast<float>(settings.minSpeed),
+            static_cast<float>(std::max(settings.minSpeed, settings.maxSpeed)));
+        const float minLifetime
+            = std::max(static_cast<float>(settings.minLifetime), MinimumLifetime);
+        std::uniform_real_distribution<float> life(minLifetime,
+            std::max(minLifetime, static_cast<float>(settings.maxLifetime)));
+        const float direction = static_cast<float>(settings.direction);
+        const float maxDeviation = static_cast<float>(settings.spread);
+        for (std::size_t i = count; i < newCount; i++)
+        {
+            const float angle = static_cast<float>(Utils::Math::convertToRadian(
+                direction + maxDeviation * spread(m_random)));
+            const float particleSpeed = speed(m_random);
+            m_positionX[i] = originX;
+            m_positionY[i] = originY;
+            // SceneUnits grow downwards
+            m_velocityX[i] = std::cos(angle) * particleSpeed;
+            m_velocityY[i] = -std::sin(angle) * particleSpeed;
+            m_age[i] = 0;
+            m_lifetime[i] = life(m_random);
+        }
+    }
+
+    void ParticleEmitter::buildVertices(const ParticleEmitterSettings& settings,
+        const float pixelsX, const float pixelsY, const sf::FloatRect& textureRect)
+    {
+        const std::size_t count = m_positionX.size();
+        m_nextVertices.resize(count * 6);
+
+        const float startSize = static_cast<float>(settings.startSize);
+        const float sizeDelta = static_cast<float>(settings.endSize) - startSize;
+        const Color& startColor = settings.startColor;
+        const Color& endColor = settings.endColor;
+        const float startR = static_cast<float>(startColor.r);
+        const float startG = static_cast<float>(startColor.g);
+        const float startB = static_cast<float>(startColor.b);
+        const float startA = static_cast<float>(startColor.a);
+        const float deltaR = static_cast<float>(endColor.r) - startR;
+        const float deltaG = static_cast<float>(endColor.g) - startG;
+        const float deltaB = static_cast<float>(endColor.b) - startB;
+        const float deltaA = static_cast<float>(endColor.a) - startA;
+
+        const sf::Vector2f texTopLeft(textureRect.left, textureRect.top);
+        const sf::Vector2f texTopRight(
+            textureRect.left + textureRect.width, textureRect.top);
+        const sf::Vector2f texBottomRight(
+            textureRect.left + textureRect.width, textureRect.top + textureRect.height);
+        const sf::Vector2f texBottomLeft(
+            textureRect.left, textureRect.top + textureRect.height);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float progress = std::min(m_age[i] / m_lifetime[i], 1.f);
+            const float halfSize = (startSize + sizeDelta * progress) * 0.5f;
+            const float x = m_positionX[i] * pixelsX;
+            const float y = m_positionY[i] * pixelsY;
+            const float halfWidth = halfSize * pixelsX;
+            const float halfHeight = halfSize * pixelsY;
+            const sf::Color color(static_cast<sf::Uint8>(startR + deltaR * progress),
+                static_cast<sf::Uint8>(startG + deltaG * progress),
+                static_cast<sf::Uint8>(startB + deltaB * progress),
+                static_cast<sf::Uint8>(startA + deltaA * progress));
+
+            const sf::Vertex topLeft(
+                sf::Vector2f(x - halfWidth, y - halfHeight), color, texTopLeft);
+            const sf::Vertex topRight(
+                sf::Vector2f(x + halfWidth, y - halfHeight), color, texTopRight);
+            const sf::Vertex bottomRight(
+                sf::Vector2f(x + halfWidth, y + halfHeight), color, texBottomRight);
+            const sf::Vertex bottomLeft(
+                sf::Vector2f(x - halfWidth, y + halfHeight), color, texBottomLeft);
+            sf::Vertex* quad = &m_nextVertices[i * 6];
+            quad[0] = topLeft;
+            quad[1] = topRight;
+            quad[2] = bottomRight;
+            quad[3] = topLeft;
+            quad[4] = bottomRight;
+            quad[5] = bottomLeft;
+        }
+    }
+
+    void ParticleEmitter::update()
+    {
+        this->waitForSimulation();
+        std::swap(m_vertices, m_nextVertices);
+
+        const double now = Time::now();
+        // Long frames (loading, breakpoints) would spawn a wave of particles
+        const double dt = (m_lastUpdate == 0) ? 0 : std::min(now - m_lastUpdate, 0.25);
+        m_lastUpdate = now;
+
+        std::size_t spawnAmount = m_burst;
+        m_burst = 0;
+        if (m_emitting)
+        {
+            m_spawnAccumulator += dt * m_settings.rate;
+            const double wholeParticles = std::floor(m_spawnAccumulator);
+            m_spawnAccumulator -= wholeParticles;
+            spawnAmount += static_cast<std::size_t>(wholeParticles);
+        }
+
+        // Unit conversions read global state, they stay on the main thread
+        const Transform::UnitVector origin
+            = m_position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector pixels
+            = Transform::UnitVector(1, 1).to<Transform::Units::ScenePixels>();
+        sf::FloatRect textureRect;
+        if (!m_path.empty())
+            textureRect = sf::FloatRect(m_texture.getTextureRect());
+
+        auto job = std::make_shared<std::packaged_task<void()>>(
+            [this, settings = m_settings, dt, spawnAmount, origin, pixels,
+                textureRect]() {
+                this->simulate(settings, static_cast<float>(dt), spawnAmount,
+                    static_cast<float>(origin.x), static_cast<float>(origin.y));
+                this->buildVertices(settings, static_cast<float>(pixels.x),
+                    static_cast<float>(pixels.y), textureRect);
+            });
+        m_job = job->get_future();
+        getSimulationWorker().submit([job]() { (*job)(); });
+    }
+
+    void ParticleEmitter::draw(RenderTarget surface, const Transform::UnitVector& camera)
+    {
+        if (m_vertices.empty())
+            return;
+        sf::RenderStates states;
+        states.transform.translate(
+            static_cast<float>(-camera.x), static_cast<float>(-camera.y));
+        if (!m_path.empty())
+        {
+            states.texture = &static_cast<const sf::Texture&>(m_texture);
+            surface.retain(m_texture.getSharedTexture());
+        }
+        surface.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+    }
+
+    void ParticleEmitter::clear()
+    {
+        this->waitForSimulation();
+        m_positionX.clear();
+        m_positionY.clear();
+        m_velocityX.clear();
+        m_velocityY.clear();
+        m_age.clear();
+        m_lifetime.clear();
+        m_vertices.clear();
+        m_nextVertices.clear();
+        m_spawnAccumulator = 0;
+        m_burst = 0;
+    }
+
+    void ParticleEmitter::burst(std::size_t amount)
+    {
+        m_burst += amount;
+    }
+
+    std::size_t ParticleEmitter::getParticleAmount()
+    {
+        this->waitForSimulation();
+        return m_positionX.size();
+    }
+
+    void ParticleEmitter::setSettings(const ParticleEmitterSettings& settings)
+    {
+        m_settings = settings;
+    }
+
+    ParticleEmitterSettings ParticleEmitter::getSettings() const
+    {
+        return m_settings;
+    }
+
+    void ParticleEmitter::setPosition(const Transform::UnitVector& position)
+    {
+        m_position = position;
+    }
+
+    Transform::UnitVector ParticleEmitter::getPosition() const
+    {
+        return m_position;
+    }
+
+    void ParticleEmitter::setEmitting(bool emitting)
+    {
+        m_emitting = emitting;
+        if (!emitting)
+            m_spawnAccumulator = 0;
+    }
+
+    bool ParticleEmitter::isEmitting() const
+    {
+        return m_emitting;
+    }
+
+    void ParticleEmitter::loadTexture(const std::string& path)
+    {
+        if (path == m_path)
+            return;
+        m_path = path;
+        if (path.empty())
+            m_texture.reset();
+        else if (m_resources)
+            m_texture = m_resources->getTexture(path);
+        else
+        {
+            m_texture.reset();
+            m_texture.loadFromFile(System::Path(path).find());
+        }
+    }
+
+    std::string ParticleEmitter::getTexturePath() const
+    {
+        return m_path;
+    }
+
+    vili::node ParticleEmitter::dump() const
+    {
+        const Transform::UnitVector position
+            = m_position.to<Transform::Units::SceneUnits>();
+        vili::node result = vili::object {};
+        result["position"] = vili::object { { "x", position.x }, { "y", position.y },
+            { "unit", Transform::unitsToString(Transform::Units::SceneUnits) } };
+        result["layer"] = m_layer;
+        result["zdepth"] = m_zdepth;
+        result["rate"] = m_settings.rate;
+        result["maxParticles"] = static_cast<vili::integer>(m_settings.maxParticles);
+        result["lifetime"] = vili::object { { "min", m_settings.minLifetime },
+            { "max", m_settings.maxLifetime } };
+        result["speed"] = vili::object { { "min", m_settings.minSpeed },
+            { "max", m_settings.maxSpeed } };
+        result["direction"] = m_settings.direction;
+        result["spread"] = m_settings.spread;
+        result["gravity"] = vili::object { { "x", m_settings.gravityX },
+            { "y", m_settings.gravityY } };
+        result["size"] = vili::object { { "start", m_settings.startSize },
+            { "end", m_settings.endSize } };
+        result["color"] = vili::object { { "start", dumpColor(m_settings.startColor) },
+            { "end", dumpColor(m_settings.endColor) } };
+        if (!m_path.empty())
+            result["texture"] = m_path;
+        result["emitting"] = m_emitting;
+        result["visible"] = m_visible;
+        return result;
+    }
+
+    void ParticleEmitter::load(vili::node& data)
+    {
+        if (data.contains("position"))
+        {
+            vili::node& position = data.at("position");
+            Transform::Units unit = Transform::Units::SceneUnits;
+            if (position.contains("unit"))
+                unit = Transform::stringToUnits(position.at("unit"));
+            m_position = Transform::UnitVector(
+                toDouble(position.at("x")), toDouble(position.at("y")), unit);
+        }
+        if (data.contains("layer"))
+            m_layer = data.at("layer").as<vili::integer>();
+        if (data.contains("zdepth"))
+            m_zdepth = data.at("zdepth").as<vili::integer>();
+        if (data.contains("rate"))
+            m_settings.rate = toDouble(data.at("rate"));
+        if (data.contains("maxParticles"))
+            m_settings.maxParticles = data.at("maxParticles").as<vili::integer>();
+        if (data.contains("lifetime"))
+            loadRange(
+                data.at("lifetime"), m_settings.minLifetime, m_settings.maxLifetime);
+        if (data.contains("speed"))
+            loadRange(data.at("speed"), m_settings.minSpeed, m_settings.maxSpeed);
+        if (data.contains("direction"))
+            m_settings.direction = toDouble(data.at("direction"));
+        if (data.contains("spread"))
+            m_settings.spread = toDouble(data.at("spread"));
+        if (data.contains("gravity"))
+        {
+            vili::node& gravity = data.at("gravity");
+            if (gravity.contains("x"))
+                m_settings.gravityX = toDouble(gravity.at("x"));
+            if (gravity.contains("y"))
+                m_settings.gravityY = toDouble(gravity.at("y"));
+        }
+        if (data.contains("size"))
+        {
+            vili::node& size = data.at("size");
+            if (size.is_numeric())
+                m_settings.startSize = m_settings.endSize = toDouble(size);
+            else
+            {
+                if (size.contains("start"))
+                    m_settings.startSize = toDouble(size.at("start"));
+                if (size.contains("end"))
+                    m_settings.endSize = toDouble(size.at("end"));
+            }
+        }
+        if (data.contains("color"))
+        {
+            vili::node& color = data.at("color");
+            if (color.contains("start"))
+                m_settings.startColor = loadColor(color.at("start"));
+            if (color.contains("end"))
+                m_settings.endColor = loadColor(color.at("end"));
+        }
+        if (data.contains("texture"))
+            this->loadTexture(data.at("texture"));
+        if (data.contains("emitting"))
+            this->setEmitting(data.at("emitting"));
+        if (data.contains("visible"))
+            m_visible = data.at("visible");
+    }
+} // namespace obe::Graphics
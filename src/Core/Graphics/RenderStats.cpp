@@ -0,0 +1,143 @@
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <sfe/ComplexSprite.hpp>
+
+#include <Graphics/RenderStats.hpp>
+#include <Graphics/Text.hpp>
+
+namespace obe::Graphics
+{
+    bool RenderStatsCollector::Enabled = false;
+    RenderStats RenderStatsCollector::Current;
+    RenderStats RenderStatsCollector::LastFrame;
+    const sf::Texture* RenderStatsCollector::LastTexture = nullptr;
+    const sf::Shader* RenderStatsCollector::LastShader = nullptr;
+    std::chrono::steady_clock::time_point RenderStatsCollector::FrameStart;
+
+    namespace
+    {
+        void countBinds(RenderStats& stats, const sf::Texture* texture,
+            const sf::Shader* shader, const sf::Texture*& lastTexture,
+            const sf::Shader*& lastShader)
+        {
+            if (texture && texture != lastTexture)
+                stats.textureBinds++;
+            if (shader != lastShader)
+                stats.shaderSwitches++;
+            lastTexture = texture;
+            lastShader = shader;
+        }
+    }
+
+    void RenderStatsCollector::SetEnabled(bool enabled)
+    {
+        Enabled = enabled;
+    }
+
+    bool RenderStatsCollector::IsEnabled()
+    {
+        return Enabled;
+    }
+
+    void RenderStatsCollector::BeginFrame()
+    {
+        Current = RenderStats();
+        LastTexture = nullptr;
+        LastShader = nullptr;
+        FrameStart = std::chrono::steady_clock::now();
+    }
+
+    void RenderStatsCollector::EndFrame()
+    {
+        const std::chrono::duration<double, std::milli> elapsed
+            = std::chrono::steady_clock::now() - FrameStart;
+        Current.renderTime = elapsed.count();
+        LastFrame = Current;
+    }
+
+    void RenderStatsCollector::CountDraw(
+        std::size_t vertexCount, const sf::RenderStates& states)
+    {
+        if (!Enabled)
+            return;
+        Current.drawCalls++;
+        Current.vertices += vertexCount;
+        countBinds(Current, states.texture, states.shader, LastTexture, LastShader);
+    }
+
+    void RenderStatsCollector::CountDraw(
+        const sfe::ComplexSprite& sprite, const sf::RenderStates& states)
+    {
+        if (!Enabled)
+            return;
+        // Drawables bind their own texture, it is not part of the given states
+        sf::RenderStates spriteStates = states;
+        spriteStates.texture = sprite.getTexture();
+        CountDraw(4, spriteStates);
+    }
+
+    void RenderStatsCollector::CountDraw(
+        const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        if (!Enabled)
+            return;
+        // sf::Shape draws its fill and its untextured outline separately
+        sf::RenderStates shapeStates = states;
+        shapeStates.texture = shape.getTexture();
+        CountDraw(shape.getPointCount() + 2, shapeStates);
+        if (shape.getOutlineThickness() != 0.f)
+        {
+            shapeStates.texture = nullptr;
+            CountDraw((shape.getPointCount() + 1) * 2, shapeStates);
+        }
+    }
+
+    void RenderStatsCollector::CountDraw(
+        const sf::VertexArray& vertices, const sf::RenderStates& states)
+    {
+        CountDraw(vertices.getVertexCount(), states);
+    }
+
+    void RenderStatsCollector::CountDraw(
+        const sf::VertexBuffer& buffer, const sf::RenderStates& states)
+    {
+        CountDraw(buffer.getVertexCount(), states);
+    }
+
+    void RenderStatsCollector::CountDraw(
+        const RichText& text, const sf::RenderStates& states)
+    {
+        if (!Enabled)
+            return;
+        sf::RenderStates textStates = states;
+        if (text.getFont())
+        {
+            const sf::Font& font = text.getFont();
+            textStates.texture = &font.getTexture(text.getCharacterSize());
+        }
+        CountDraw(text.getVertices().getVertexCount(), textStates);
+    }
+
+    void RenderStatsCollector::CountSprite(bool culled)
+    {
+        if (!Enabled)
+            return;
+        if (culled)
+            Current.culledSprites++;
+        else
+            Current.sprites++;
+    }
+
+    void RenderStatsCollector::CountCanvasRedraw()
+    {
+        if (Enabled)
+            Current.canvasRedraws++;
+    }
+
+    const RenderStats& RenderStatsCollector::GetLastFrame()
+    {
+        return LastFrame;
+    }
+} // namespace obe::Graphics
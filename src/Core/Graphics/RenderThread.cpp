@@ -0,0 +1,140 @@
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
+#include <Graphics/RenderThread.hpp>
+
+namespace obe::Graphics
+{
+    RenderThread* RenderThread::Current = nullptr;
+
+    RenderThread::RenderThread(sf::RenderWindow& window)
+        : m_window(window)
+    {
+    }
+
+    RenderThread::~RenderThread()
+    {
+        this->stop();
+    }
+
+    void RenderThread::run()
+    {
+        Debug::Profiler::SetThreadName("Render");
+        if (!m_window.setActive(true))
+        {
+            Debug::Log->error("<RenderThread> Unable to activate the OpenGL context");
+            m_running = false;
+            return;
+        }
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_wakeMutex);
+                m_wake.wait(lock, [this]() { return m_pending || !m_running; });
+                m_pending = false;
+            }
+            if (!m_frames.acquire())
+            {
+                if (!m_running)
+                    break;
+                continue;
+            }
+            OBE_PROFILE_ZONE("RenderThread::replay");
+            const int verticalSync = m_verticalSync.exchange(-1);
+            if (verticalSync != -1)
+                m_window.setVerticalSyncEnabled(verticalSync == 1);
+            m_frames.getReadBuffer().replay(m_window);
+            m_window.display();
+            m_renderedFrames++;
+        }
+        m_window.setActive(false);
+    }
+
+    void RenderThread::start()
+    {
+        if (m_running)
+            return;
+        const sf::Vector2u size = m_window.getSize();
+        m_frames.getWriteBuffer().reset(
+            size, m_window.getView(), m_window.getDefaultView());
+        m_window.setActive(false);
+        m_running = true;
+        m_thread = std::thread(&RenderThread::run, this);
+        Current = this;
+        Debug::Log->info("<RenderThread> Rendering on a dedicated thread");
+    }
+
+    void RenderThread::stop()
+    {
+        if (!m_thread.joinable())
+            return;
+        {
+            std::lock_guard lock(m_wakeMutex);
+            m_running = false;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+        m_window.setActive(true);
+        if (Current == this)
+            Current = nullptr;
+        m_frames.getWriteBuffer().releaseResources();
+        m_frames.getReadBuffer().releaseResources();
+    }
+
+    bool RenderThread::isRunning() const
+    {
+        return m_running;
+    }
+
+    DrawCommandBuffer& RenderThread::getFrame()
+    {
+        return m_frames.getWriteBuffer();
+    }
+
+    void RenderThread::submitFrame()
+    {
+        const DrawCommandBuffer& submitted = m_frames.getWriteBuffer();
+        const sf::Vector2u size = submitted.getSize();
+        const sf::View view = submitted.getView();
+        const sf::View defaultView = submitted.getDefaultView();
+        // A dropped frame may have retained resources still used by the frame
+        // being rendered, they stay in the buffer and go with the next frame
+        if (!m_frames.publish())
+            m_droppedFrames++;
+        else
+            m_frames.getWriteBuffer().releaseResources();
+        {
+            std::lock_guard lock(m_wakeMutex);
+            m_pending = true;
+        }
+        m_wake.notify_one();
+        m_frames.getWriteBuffer().reset(size, view, defaultView);
+    }
+
+    void RenderThread::setVerticalSyncEnabled(bool enabled)
+    {
+        m_verticalSync = enabled ? 1 : 0;
+    }
+
+    std::size_t RenderThread::getRenderedFrameAmount() const
+    {
+        return m_renderedFrames;
+    }
+
+    std::size_t RenderThread::getDroppedFrameAmount() const
+    {
+        return m_droppedFrames;
+    }
+
+    bool RenderThread::IsActive()
+    {
+        return Current != nullptr;
+    }
+
+    void RenderThread::ReleaseAfterPresent(std::shared_ptr<const void> resource)
+    {
+        if (Current)
+            Current->m_frames.getWriteBuffer().retain(std::move(resource));
+    }
+} // namespace obe::Graphics
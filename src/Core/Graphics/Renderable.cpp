@@ -0,0 +1,34 @@
+#include <Graphics/Renderable.hpp>
+
+namespace obe::Graphics
+{
+    void Renderable::setLayer(int layer)
+    {
+        m_layer = layer;
+    }
+
+    int Renderable::getLayer() const
+    {
+        return m_layer;
+    }
+
+    void Renderable::setZDepth(int zdepth)
+    {
+        m_zdepth = zdepth;
+    }
+
+    int Renderable::getZDepth() const
+    {
+        return m_zdepth;
+    }
+
+    void Renderable::setVisible(bool visible)
+    {
+        m_visible = visible;
+    }
+
+    bool Renderable::isVisible() const
+    {
+        return m_visible;
+    }
+} // namespace obe::Graphics
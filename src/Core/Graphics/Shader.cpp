@@ -1,8 +1,130 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <Debug/Logger.hpp>
 #include <Graphics/Shader.hpp>
 #include <System/Path.hpp>
 
 namespace obe::Graphics
 {
+    namespace
+    {
+        /**
+         * \brief Inserts the defines after the #version directive (which has
+         *        to stay the first statement of the shader)
+         */
+        std::string insertDefines(
+            const std::string& source, const std::vector<std::string>& defines)
+        {
+            std::string directives;
+            for (const std::string& define : defines)
+            {
+                const std::size_t separator = define.find('=');
+                if (separator == std::string::npos)
+                    directives += "#define " + define + "\n";
+                else
+                {
+                    directives += "#define " + define.substr(0, separator) + " "
+                        + define.substr(separator + 1) + "\n";
+                }
+            }
+            std::size_t insertPosition = 0;
+            const std::size_t version = source.find("#version");
+            if (version != std::string::npos)
+            {
+                const std::size_t lineEnd = source.find('\n', version);
+                if (lineEnd == std::string::npos)
+                    return source + "\n" + directives;
+                insertPosition = lineEnd + 1;
+            }
+            std::string result = source;
+            return result.insert(insertPosition, directives);
+        }
+
+        struct UniformSetter
+        {
+            sf::Shader& shader;
+            const std::string& name;
+
+            void operator()(float value) const
+            {
+                shader.setUniform(name, value);
+            }
+            void operator()(const sf::Vector2f& value) const
+            {
+                shader.setUniform(name, sf::Glsl::Vec2(value));
+            }
+            void operator()(const sf::Vector3f& value) const
+            {
+                shader.setUniform(name, sf::Glsl::Vec3(value));
+            }
+            void operator()(const Color& value) const
+            {
+                shader.setUniform(name, sf::Glsl::Vec4(static_cast<sf::Color>(value)));
+            }
+        };
+
+        /**
+         * \brief Value of a uniform that has no registered default, all
+         *        components are zero like a GLSL uniform without initializer
+         */
+        ShaderUniformValue zeroOf(const ShaderUniformValue& value)
+        {
+            if (std::holds_alternative<Color>(value))
+                return Color(0, 0, 0, 0);
+            return std::visit(
+                [](const auto& typed) -> ShaderUniformValue {
+                    return std::decay_t<decltype(typed)> {};
+                },
+                value);
+        }
+
+        bool isSetIn(const ShaderUniforms& uniforms, const std::string& name)
+        {
+            const auto& values = uniforms.getValues();
+            return std::any_of(values.begin(), values.end(),
+                [&name](const auto& uniform) { return uniform.first == name; });
+        }
+    }
+
+    void ShaderUniforms::set(const std::string& name, const ShaderUniformValue& value)
+    {
+        for (auto& [uniformName, uniformValue] : m_values)
+        {
+            if (uniformName == name)
+            {
+                uniformValue = value;
+                return;
+            }
+        }
+        m_values.emplace_back(name, value);
+    }
+
+    void ShaderUniforms::remove(const std::string& name)
+    {
+        const auto isNamed
+            = [&name](const auto& uniform) { return uniform.first == name; };
+        m_values.erase(
+            std::remove_if(m_values.begin(), m_values.end(), isNamed), m_values.end());
+    }
+
+    void ShaderUniforms::clear()
+    {
+        m_values.clear();
+    }
+
+    bool ShaderUniforms::empty() const
+    {
+        return m_values.empty();
+    }
+
+    const std::vector<std::pair<std::string, ShaderUniformValue>>&
+    ShaderUniforms::getValues() const
+    {
+        return m_values;
+    }
+
     Shader::Shader()
     {
         m_path = "";
@@ -13,17 +135,109 @@ namespace obe::Graphics
         this->loadShader(path);
     }
 
-    void Shader::loadShader(const std::string& path)
+    bool Shader::loadShader(
+        const std::string& path, const std::vector<std::string>& defines)
     {
-        this->loadFromFile(System::Path(path).find(), sf::Shader::Type::Fragment);
         m_path = path;
+        m_defines = defines;
+        m_boundUniforms.clear();
+        const std::string realPath = System::Path(path).find();
+        if (defines.empty())
+            return this->loadFromFile(realPath, sf::Shader::Type::Fragment);
+
+        std::ifstream file(realPath);
+        if (!file)
+        {
+            Debug::Log->error("<Shader> Unable to open shader '{}'", path);
+            return false;
+        }
+        std::stringstream source;
+        source << file.rdbuf();
+        return this->loadFromMemory(
+            insertDefines(source.str(), defines), sf::Shader::Type::Fragment);
     }
+
+    std::string Shader::getPath() const
+    {
+        return m_path;
+    }
+
+    std::vector<std::string> Shader::getDefines() const
+    {
+        return m_defines;
+    }
+
+    void Shader::sendUniform(const std::string& name, const ShaderUniformValue& value)
+    {
+        const auto bound = m_boundUniforms.find(name);
+        if (bound != m_boundUniforms.end() && bound->second == value)
+            return;
+        std::visit(UniformSetter { *this, name }, value);
+        m_boundUniforms.insert_or_assign(name, value);
+    }
+
+    void Shader::setUniformDefault(const std::string& name, float value)
+    {
+        m_defaultUniforms.insert_or_assign(name, value);
+    }
+
+    void Shader::setUniformDefault(const std::string& name, float x, float y)
+    {
+        m_defaultUniforms.insert_or_assign(name, sf::Vector2f(x, y));
+    }
+
+    void Shader::setUniformDefault(const std::string& name, float x, float y, float z)
+    {
+        m_defaultUniforms.insert_or_assign(name, sf::Vector3f(x, y, z));
+    }
+
+    void Shader::setUniformDefault(const std::string& name, const Color& color)
+    {
+        m_defaultUniforms.insert_or_assign(name, color);
+    }
+
+    void Shader::applyUniforms(const ShaderUniforms& uniforms)
+    {
+        for (const auto& [name, value] : m_defaultUniforms)
+        {
+            if (!isSetIn(uniforms, name))
+                this->sendUniform(name, value);
+        }
+        for (auto& [name, bound] : m_boundUniforms)
+        {
+            if (m_defaultUniforms.count(name) || isSetIn(uniforms, name))
+                continue;
+            const ShaderUniformValue zero = zeroOf(bound);
+            if (bound == zero)
+                continue;
+            std::visit(UniformSetter { *this, name }, zero);
+            bound = zero;
+        }
+        for (const auto& [name, value] : uniforms.getValues())
+            this->sendUniform(name, value);
+    }
+
     vili::node Shader::dump() const
     {
-        vili::node result;
+        vili::node result = vili::object {};
+        result.emplace("path", m_path);
+        if (!m_defines.empty())
+        {
+            vili::node defines = vili::array {};
+            for (const std::string& define : m_defines)
+                defines.push(define);
+            result.emplace("defines", defines);
+        }
         return result;
     }
     void Shader::load(vili::node& data)
     {
+        std::vector<std::string> defines;
+        if (data.contains("defines"))
+        {
+            for (vili::node& define : data.at("defines"))
+                defines.push_back(define.as<vili::string>());
+        }
+        this->loadShader(data.at("path"), defines);
     }
 } // namespace obe::Graphics
\ No newline at end of file
@@ -0,0 +1,535 @@
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Graphics/DrawUtils.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
+
+namespace obe::Graphics
+{
+    std::unordered_map<const sf::Texture*, SoftwareRenderTarget::CachedTexture>
+        SoftwareRenderTarget::TextureCache;
+    std::mutex SoftwareRenderTarget::TextureCacheMutex;
+    bool SoftwareRenderTarget::Enabled = false;
+
+    namespace
+    {
+        struct Rgba
+        {
+            float r;
+            float g;
+            float b;
+            float a;
+        };
+
+        Rgba toRgba(const sf::Color& color)
+        {
+            return { color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f };
+        }
+
+        float getBlendFactor(sf::BlendMode::Factor factor, float source,
+            float destination, float sourceAlpha, float destinationAlpha)
+        {
+            switch (factor)
+            {
+            case sf::BlendMode::Zero:
+                return 0.f;
+            case sf::BlendMode::One:
+                return 1.f;
+            case sf::BlendMode::SrcColor:
+                return source;
+            case sf::BlendMode::OneMinusSrcColor:
+                return 1.f - source;
+            case sf::BlendMode::DstColor:
+                return destination;
+            case sf::BlendMode::OneMinusDstColor:
+                return 1.f - destination;
+            case sf::BlendMode::SrcAlpha:
+                return sourceAlpha;
+            case sf::BlendMode::OneMinusSrcAlpha:
+                return 1.f - sourceAlpha;
+            case sf::BlendMode::DstAlpha:
+                return destinationAlpha;
+            case sf::BlendMode::OneMinusDstAlpha:
+                return 1.f - destinationAlpha;
+            }
+            return 1.f;
+        }
+
+        float applyBlendEquation(
+            sf::BlendMode::Equation equation, float source, float destination)
+        {
+            float result = source + destination;
+            if (equation == sf::BlendMode::Subtract)
+                result = source - destination;
+            else if (equation == sf::BlendMode::ReverseSubtract)
+                result = destination - source;
+            return std::clamp(result, 0.f, 1.f);
+        }
+
+        sf::Uint8 toChannel(float value)
+        {
+            return static_cast<sf::Uint8>(value * 255.f + 0.5f);
+        }
+
+        sf::Uint8 interpolate(sf::Uint8 first, sf::Uint8 second, float t)
+        {
+            return static_cast<sf::Uint8>(first + (second - first) * t);
+        }
+
+        float edgeFunction(
+            const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& point)
+        {
+            return (b.x - a.x) * (point.y - a.y) - (b.y - a.y) * (point.x - a.x);
+        }
+
+        /**
+         * \brief Pixels exactly on an edge shared by two triangles must only
+         *        be drawn once, they belong to the triangle for which this is true
+         */
+        bool ownsEdge(const sf::Vector2f& a, const sf::Vector2f& b)
+        {
+            return (b.y > a.y) || (b.y == a.y && b.x < a.x);
+        }
+
+        int wrapCoordinate(int coordinate, int size, bool repeated)
+        {
+            if (repeated)
+            {
+                coordinate %= size;
+                return (coordinate < 0) ? coordinate + size : coordinate;
+            }
+            return std::clamp(coordinate, 0, size - 1);
+        }
+
+        Rgba getTexel(const sf::Image& image, int x, int y, bool repeated)
+        {
+            const sf::Vector2u size = image.getSize();
+            x = wrapCoordinate(x, static_cast<int>(size.x), repeated);
+            y = wrapCoordinate(y, static_cast<int>(size.y), repeated);
+            const sf::Uint8* texel
+                = image.getPixelsPtr() + (static_cast<std::size_t>(y) * size.x + x) * 4;
+            return { texel[0] / 255.f, texel[1] / 255.f, texel[2] / 255.f,
+                texel[3] / 255.f };
+        }
+
+        Rgba sampleTexture(
+            const sf::Image& image, float u, float v, bool smooth, bool repeated)
+        {
+            if (!smooth)
+            {
+                return getTexel(image, static_cast<int>(std::floor(u)),
+                    static_cast<int>(std::floor(v)), repeated);
+            }
+            const float x = u - 0.5f;
+            const float y = v - 0.5f;
+            const int left = static_cast<int>(std::floor(x));
+            const int top = static_cast<int>(std::floor(y));
+            const float xRatio = x - left;
+            const float yRatio = y - top;
+            const Rgba topLeft = getTexel(image, left, top, repeated);
+            const Rgba topRight = getTexel(image, left + 1, top, repeated);
+            const Rgba bottomLeft = getTexel(image, left, top + 1, repeated);
+            const Rgba bottomRight = getTexel(image, left + 1, top + 1, repeated);
+            const auto mix = [xRatio, yRatio](float tl, float tr, float bl, float br) {
+                return (tl * (1 - xRatio) + tr * xRatio) * (1 - yRatio)
+                    + (bl * (1 - xRatio) + br * xRatio) * yRatio;
+            };
+            return { mix(topLeft.r, topRight.r, bottomLeft.r, bottomRight.r),
+                mix(topLeft.g, topRight.g, bottomLeft.g, bottomRight.g),
+                mix(topLeft.b, topRight.b, bottomLeft.b, bottomRight.b),
+                mix(topLeft.a, topRight.a, bottomLeft.a, bottomRight.a) };
+        }
+
+        void warnUnsupportedDrawable()
+        {
+            static bool warned = false;
+            if (!warned)
+            {
+                Debug::Log->warn("<SoftwareRenderTarget> Drawables other than sprites, "
+                                 "shapes, vertex arrays and RichText are not rendered");
+                warned = true;
+            }
+        }
+    }
+
+    SoftwareRenderTarget::SoftwareRenderTarget(unsigned int width, unsigned int height)
+    {
+        this->create(width, height);
+    }
+
+    void SoftwareRenderTarget::create(unsigned int width, unsigned int height)
+    {
+        m_width = width;
+        m_height = height;
+        m_pixels.assign(static_cast<std::size_t>(width) * height * 4, 0);
+        m_defaultView.reset(sf::FloatRect(0, 0, width, height));
+        m_view = m_defaultView;
+    }
+
+    sf::Vector2u SoftwareRenderTarget::getSize() const
+    {
+        return sf::Vector2u(m_width, m_height);
+    }
+
+    void SoftwareRenderTarget::clear(const Color& color)
+    {
+        const sf::Color clearColor = color;
+        for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+        {
+            m_pixels[i] = clearColor.r;
+            m_pixels[i + 1] = clearColor.g;
+            m_pixels[i + 2] = clearColor.b;
+            m_pixels[i + 3] = clearColor.a;
+        }
+        m_drawCalls = 0;
+    }
+
+    void SoftwareRenderTarget::setView(const sf::View& view)
+    {
+        m_view = view;
+    }
+
+    const sf::View& SoftwareRenderTarget::getView() const
+    {
+        return m_view;
+    }
+
+    const sf::View& SoftwareRenderTarget::getDefaultView() const
+    {
+        return m_defaultView;
+    }
+
+    sf::IntRect SoftwareRenderTarget::getViewport() const
+    {
+        const float width = static_cast<float>(m_width);
+        const float height = static_cast<float>(m_height);
+        const sf::FloatRect& viewport = m_view.getViewport();
+        return sf::IntRect(static_cast<int>(0.5f + width * viewport.left),
+            static_cast<int>(0.5f + height * viewport.top),
+            static_cast<int>(0.5f + width * viewport.width),
+            static_cast<int>(0.5f + height * viewport.height));
+    }
+
+    bool SoftwareRenderTarget::isInside(int x, int y, const sf::IntRect& viewport) const
+    {
+        return x >= std::max(viewport.left, 0) && y >= std::max(viewport.top, 0)
+            && x < std::min(viewport.left + viewport.width, static_cast<int>(m_width))
+            && y < std::min(viewport.top + viewport.height, static_cast<int>(m_height));
+    }
+
+    const sf::Image* SoftwareRenderTarget::getTextureImage(
+        const sf::Texture* texture) const
+    {
+        if (!texture)
+            return nullptr;
+        const std::lock_guard lock(TextureCacheMutex);
+        const auto cached = TextureCache.find(texture);
+        if (cached != TextureCache.end())
+            return &cached->second.image;
+        CachedTexture& entry = TextureCache[texture];
+        entry.image = texture->copyToImage();
+        return &entry.image;
+    }
+
+    void SoftwareRenderTarget::blend(
+        int x, int y, const sf::Color& source, const sf::BlendMode& mode)
+    {
+        sf::Uint8* pixel
+            = m_pixels.data() + (static_cast<std::size_t>(y) * m_width + x) * 4;
+        if (mode == sf::BlendNone)
+        {
+            pixel[0] = source.r;
+            pixel[1] = source.g;
+            pixel[2] = source.b;
+            pixel[3] = source.a;
+            return;
+        }
+        const Rgba src = toRgba(source);
+        const Rgba dst = toRgba(sf::Color(pixel[0], pixel[1], pixel[2], pixel[3]));
+        const auto blendColor = [&](float s, float d) {
+            return applyBlendEquation(mode.colorEquation,
+                s * getBlendFactor(mode.colorSrcFactor, s, d, src.a, dst.a),
+                d * getBlendFactor(mode.colorDstFactor, s, d, src.a, dst.a));
+        };
+        pixel[0] = toChannel(blendColor(src.r, dst.r));
+        pixel[1] = toChannel(blendColor(src.g, dst.g));
+        pixel[2] = toChannel(blendColor(src.b, dst.b));
+        pixel[3] = toChannel(applyBlendEquation(mode.alphaEquation,
+            src.a * getBlendFactor(mode.alphaSrcFactor, src.a, dst.a, src.a, dst.a),
+            dst.a * getBlendFactor(mode.alphaDstFactor, src.a, dst.a, src.a, dst.a)));
+    }
+
+    void SoftwareRenderTarget::drawTriangle(const sf::Vertex* vertices,
+        const sf::Image* texture, bool smooth, bool repeated, const sf::BlendMode& mode)
+    {
+        const sf::Vertex* v0 = &vertices[0];
+        const sf::Vertex* v1 = &vertices[1];
+        const sf::Vertex* v2 = &vertices[2];
+        float area = edgeFunction(v0->position, v1->position, v2->position);
+        if (area == 0.f)
+            return;
+        if (area < 0.f)
+        {
+            std::swap(v1, v2);
+            area = -area;
+        }
+
+        const sf::IntRect viewport = this->getViewport();
+        const int minX = std::max({ viewport.left, 0,
+            static_cast<int>(std::floor(
+                std::min({ v0->position.x, v1->position.x, v2->position.x }))) });
+        const int minY = std::max({ viewport.top, 0,
+            static_cast<int>(std::floor(
+                std::min({ v0->position.y, v1->position.y, v2->position.y }))) });
+        const int maxX = std::min({ viewport.left + viewport.width,
+            static_cast<int>(m_width),
+            static_cast<int>(std::ceil(
+                std::max({ v0->position.x, v1->position.x, v2->position.x }))) });
+        const int maxY = std::min({ viewport.top + viewport.height,
+            static_cast<int>(m_height),
+            static_cast<int>(std::ceil(
+                std::max({ v0->position.y, v1->position.y, v2->position.y }))) });
+
+        const bool ownsEdge0 = ownsEdge(v1->position, v2->position);
+        const bool ownsEdge1 = ownsEdge(v2->position, v0->position);
+        const bool ownsEdge2 = ownsEdge(v0->position, v1->position);
+        const Rgba c0 = toRgba(v0->color);
+        const Rgba c1 = toRgba(v1->color);
+        const Rgba c2 = toRgba(v2->color);
+        for (int y = minY; y < maxY; y++)
+        {
+            const float centerY = y + 0.5f;
+            for (int x = minX; x < maxX; x++)
+            {
+                const sf::Vector2f center(x + 0.5f, centerY);
+                const float w0 = edgeFunction(v1->position, v2->position, center);
+                const float w1 = edgeFunction(v2->position, v0->position, center);
+                const float w2 = edgeFunction(v0->position, v1->position, center);
+                if (w0 < 0 || w1 < 0 || w2 < 0 || (w0 == 0 && !ownsEdge0)
+                    || (w1 == 0 && !ownsEdge1) || (w2 == 0 && !ownsEdge2))
+                    continue;
+                const float b0 = w0 / area;
+                const float b1 = w1 / area;
+                const float b2 = w2 / area;
+                Rgba color { c0.r * b0 + c1.r * b1 + c2.r * b2,
+                    c0.g * b0 + c1.g * b1 + c2.g * b2, c0.b * b0 + c1.b * b1 + c2.b * b2,
+                    c0.a * b0 + c1.a * b1 + c2.a * b2 };
+                if (texture)
+                {
+                    const float u = v0->texCoords.x * b0 + v1->texCoords.x * b1
+                        + v2->texCoords.x * b2;
+                    const float v = v0->texCoords.y * b0 + v1->texCoords.y * b1
+                        + v2->texCoords.y * b2;
+                    const Rgba texel = sampleTexture(*texture, u, v, smooth, repeated);
+                    color = { color.r * texel.r, color.g * texel.g, color.b * texel.b,
+                        color.a * texel.a };
+                }
+                this->blend(x, y,
+                    sf::Color(toChannel(std::clamp(color.r, 0.f, 1.f)),
+                        toChannel(std::clamp(color.g, 0.f, 1.f)),
+                        toChannel(std::clamp(color.b, 0.f, 1.f)),
+                        toChannel(std::clamp(color.a, 0.f, 1.f))),
+                    mode);
+            }
+        }
+    }
+
+    void SoftwareRenderTarget::drawLine(
+        const sf::Vertex& first, const sf::Vertex& second, const sf::BlendMode& mode)
+    {
+        const sf::Vector2f delta = second.position - first.position;
+        const int steps = static_cast<int>(
+            std::ceil(std::max(std::abs(delta.x), std::abs(delta.y))));
+        const sf::IntRect viewport = this->getViewport();
+        // The last pixel is left to the next segment, like OpenGL does
+        for (int i = 0; i < steps; i++)
+        {
+            const float t = (i + 0.5f) / steps;
+            const int x = static_cast<int>(std::floor(first.position.x + delta.x * t));
+            const int y = static_cast<int>(std::floor(first.position.y + delta.y * t));
+            if (this->isInside(x, y, viewport))
+            {
+                this->blend(x, y,
+                    sf::Color(interpolate(first.color.r, second.color.r, t),
+                        interpolate(first.color.g, second.color.g, t),
+                        interpolate(first.color.b, second.color.b, t),
+                        interpolate(first.color.a, second.color.a, t)),
+                    mode);
+            }
+        }
+    }
+
+    void SoftwareRenderTarget::draw(
+        const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        const bool supported = Utils::decomposeDrawable(drawable, states,
+            [this](const sf::Vertex* vertices, std::size_t vertexCount,
+                sf::PrimitiveType type, const sf::RenderStates& primitiveStates) {
+                this->draw(vertices, vertexCount, type, primitiveStates);
+            });
+        if (!supported)
+            warnUnsupportedDrawable();
+    }
+
+    void SoftwareRenderTarget::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+        sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        m_drawCalls++;
+        if (!vertices || vertexCount == 0 || m_pixels.empty())
+            return;
+
+        // Same mapping as sf::RenderTarget::mapCoordsToPixel
+        const sf::Transform transform = m_view.getTransform() * states.transform;
+        const sf::IntRect viewport = this->getViewport();
+        std::vector<sf::Vertex> pixelVertices(vertices, vertices + vertexCount);
+        for (sf::Vertex& vertex : pixelVertices)
+        {
+            const sf::Vector2f normalized = transform.transformPoint(vertex.position);
+            vertex.position.x
+                = (normalized.x + 1.f) / 2.f * viewport.width + viewport.left;
+            vertex.position.y
+                = (-normalized.y + 1.f) / 2.f * viewport.height + viewport.top;
+        }
+
+        const sf::Image* texture = this->getTextureImage(states.texture);
+        if (texture && (texture->getSize().x == 0 || texture->getSize().y == 0))
+            texture = nullptr;
+        const bool smooth = states.texture && states.texture->isSmooth();
+        const bool repeated = states.texture && states.texture->isRepeated();
+        const auto triangle = [&](std::size_t i0, std::size_t i1, std::size_t i2) {
+            const sf::Vertex corners[]
+                = { pixelVertices[i0], pixelVertices[i1], pixelVertices[i2] };
+            this->drawTriangle(corners, texture, smooth, repeated, states.blendMode);
+        };
+
+        switch (type)
+        {
+        case sf::Points:
+            for (const sf::Vertex& vertex : pixelVertices)
+            {
+                const int x = static_cast<int>(std::floor(vertex.position.x));
+                const int y = static_cast<int>(std::floor(vertex.position.y));
+                if (this->isInside(x, y, viewport))
+                    this->blend(x, y, vertex.color, states.blendMode);
+            }
+            break;
+        case sf::Lines:
+            for (std::size_t i = 1; i < vertexCount; i += 2)
+                this->drawLine(pixelVertices[i - 1], pixelVertices[i], states.blendMode);
+            break;
+        case sf::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; i++)
+                this->drawLine(pixelVertices[i - 1], pixelVertices[i], states.blendMode);
+            break;
+        case sf::Triangles:
+            for (std::size_t i = 2; i < vertexCount; i += 3)
+                triangle(i - 2, i - 1, i);
+            break;
+        case sf::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; i++)
+                triangle(i - 2, i - 1, i);
+            break;
+        case sf::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; i++)
+                triangle(0, i - 1, i);
+            break;
+        case sf::Quads:
+            for (std::size_t i = 3; i < vertexCount; i += 4)
+            {
+                triangle(i - 3, i - 2, i - 1);
+                triangle(i - 3, i - 1, i);
+            }
+            break;
+        }
+    }
+
+    std::size_t SoftwareRenderTarget::getDrawCalls() const
+    {
+        return m_drawCalls;
+    }
+
+    const std::vector<std::uint8_t>& SoftwareRenderTarget::getPixels() const
+    {
+        return m_pixels;
+    }
+
+    sf::Image SoftwareRenderTarget::copyToImage() const
+    {
+        sf::Image image;
+        if (!m_pixels.empty())
+            image.create(m_width, m_height, m_pixels.data());
+        return image;
+    }
+
+    bool SoftwareRenderTarget::saveToFile(const std::string& path) const
+    {
+        return this->copyToImage().saveToFile(path);
+    }
+
+    std::size_t SoftwareRenderTarget::compare(
+        const sf::Image& reference, std::uint8_t tolerance) const
+    {
+        const std::size_t pixelCount = static_cast<std::size_t>(m_width) * m_height;
+        if (reference.getSize() != this->getSize())
+            return pixelCount;
+        const sf::Uint8* referencePixels = reference.getPixelsPtr();
+        std::size_t differentPixels = 0;
+        for (std::size_t i = 0; i < pixelCount * 4; i += 4)
+        {
+            for (std::size_t channel = 0; channel < 4; channel++)
+            {
+                const int difference = std::abs(static_cast<int>(m_pixels[i + channel])
+                    - static_cast<int>(referencePixels[i + channel]));
+                if (difference > tolerance)
+                {
+                    differentPixels++;
+                    break;
+                }
+            }
+        }
+        return differentPixels;
+    }
+
+    void SoftwareRenderTarget::InvalidateTexture(const sf::Texture& texture)
+    {
+        const std::lock_guard lock(TextureCacheMutex);
+        TextureCache.erase(&texture);
+    }
+
+    void SoftwareRenderTarget::SetTextureImage(
+        const sf::Texture& texture, const sf::Image& image)
+    {
+        const std::lock_guard lock(TextureCacheMutex);
+        TextureCache[&texture].image = image;
+    }
+
+    std::shared_ptr<sf::Texture> SoftwareRenderTarget::MakeTexture()
+    {
+        return std::shared_ptr<sf::Texture>(new sf::Texture(), [](sf::Texture* texture) {
+            InvalidateTexture(*texture);
+            delete texture;
+        });
+    }
+
+    std::shared_ptr<sf::RenderTexture> SoftwareRenderTarget::MakeRenderTexture()
+    {
+        return std::shared_ptr<sf::RenderTexture>(
+            new sf::RenderTexture(), [](sf::RenderTexture* texture) {
+                InvalidateTexture(texture->getTexture());
+                delete texture;
+            });
+    }
+
+    void SoftwareRenderTarget::SetEnabled(bool enabled)
+    {
+        Enabled = enabled;
+    }
+
+    bool SoftwareRenderTarget::IsEnabled()
+    {
+        return Enabled;
+    }
+} // namespace obe::Graphics
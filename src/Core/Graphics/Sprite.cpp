@@ -1,3 +1,4 @@
+#include <Debug/Logger.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <Graphics/DrawUtils.hpp>
 #include <Graphics/Exceptions.hpp>
@@ -9,7 +10,16 @@
 
 namespace obe::Graphics
 {
-    static Graphics::Texture NullTexture;
+    namespace
+    {
+        // Created on first use, a texture needs an OpenGL context
+        Texture& nullTexture()
+        {
+            static Texture texture;
+            return texture;
+        }
+    }
+
     void MakeNullTexture()
     {
         sf::Image nullImage;
@@ -24,7 +34,13 @@ namespace obe::Graphics
                     nullImage.setPixel(i, j, sf::Color::Red);
             }
         }
-        NullTexture.loadFromImage(nullImage);
+        nullTexture().loadFromImage(nullImage);
+    }
+
+    const Texture& GetNullTexture()
+    {
+        [[maybe_unused]] static const bool made = (MakeNullTexture(), true);
+        return nullTexture();
     }
 
     sf::Vertex toSfVertex(const Transform::UnitVector& uv)
@@ -32,11 +48,40 @@ namespace obe::Graphics
         return sf::Vertex(sf::Vector2f(uv.x, uv.y));
     }
 
+    namespace
+    {
+        /**
+         * \brief Checks if the bounding box of the vertices is outside of an
+         *        unrotated view
+         */
+        bool isOutsideView(
+            const std::array<sf::Vertex, 4>& vertices, const sf::View& view)
+        {
+            if (view.getRotation() != 0.f)
+                return false;
+            float left = vertices[0].position.x;
+            float top = vertices[0].position.y;
+            float right = left;
+            float bottom = top;
+            for (const sf::Vertex& vertex : vertices)
+            {
+                left = std::min(left, vertex.position.x);
+                top = std::min(top, vertex.position.y);
+                right = std::max(right, vertex.position.x);
+                bottom = std::max(bottom, vertex.position.y);
+            }
+            const sf::Vector2f viewSize = view.getSize();
+            const sf::Vector2f viewOrigin = view.getCenter() - viewSize / 2.f;
+            return right < viewOrigin.x || bottom < viewOrigin.y
+                || left > viewOrigin.x + viewSize.x || top > viewOrigin.y + viewSize.y;
+        }
+    }
+
     Sprite::Sprite(const std::string& id)
         : Selectable(false)
         , Component(id)
     {
-        this->setTexture(NullTexture);
+        this->setTexture(GetNullTexture());
 
         for (Transform::Referential& ref : Transform::Referential::Referentials)
         {
@@ -71,10 +116,28 @@ namespace obe::Graphics
             Rect::getPosition(Transform::Referential::BottomRight), camera, m_layer)
                                      .to<Transform::Units::ScenePixels>());
 
+        // Shaders can move vertices and handles have to stay visible
+        const bool culled
+            = !m_shader && !m_selected && isOutsideView(vertices, surface.getView());
+        RenderStatsCollector::CountSprite(culled);
+        if (culled)
+            return;
+
         m_sprite.setVertices(vertices);
+        if (m_textureLoading && !m_texture.isLoading())
+        {
+            m_textureLoading = false;
+            m_sprite.setTextureRect(m_texture.getTextureRect());
+        }
 
+        if (surface.isDeferred())
+        {
+            surface.retain(m_texture.getSharedTexture());
+            surface.retain(m_sharedShader);
+        }
+        RenderStatsCollector::CountDraw(m_sprite, sf::RenderStates(m_shader));
         if (m_shader)
-            surface.draw(m_sprite, m_shader);
+            surface.draw(m_sprite, *m_shader, m_shaderUniforms);
         else
             surface.draw(m_sprite);
 
@@ -112,8 +175,19 @@ namespace obe::Graphics
             }
 
             m_sprite.setTexture(m_texture);
-            m_sprite.setTextureRect(
-                sf::IntRect(0, 0, m_texture.getSize().x, m_texture.getSize().y));
+            m_sprite.setTextureRect(m_texture.getTextureRect());
+            m_textureLoading = false;
+        }
+    }
+
+    void Sprite::loadTextureAsync(const std::string& path)
+    {
+        if (!m_resources)
+            return this->loadTexture(path);
+        if (!path.empty() and path != m_path)
+        {
+            m_path = path;
+            this->setTexture(m_resources->getTextureAsync(path, m_antiAliasing));
         }
     }
 
@@ -123,16 +197,19 @@ namespace obe::Graphics
 
     void Sprite::setTexture(const Texture& texture)
     {
-        // m_texture = std::shared_ptr<Texture>(std::shared_ptr<Texture>(), texture);
+        m_texture = texture;
+        m_textureLoading = texture.isLoading();
         m_sprite.setTexture(texture);
-        m_sprite.setTextureRect(
-            sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+        m_sprite.setTextureRect(texture.getTextureRect());
     }
 
     void Sprite::setTextureRect(
         unsigned int x, unsigned int y, unsigned int width, unsigned int height)
     {
-        m_sprite.setTextureRect(sf::IntRect(x, y, width, height));
+        // Coordinates are relative to the region covered by the Texture (atlas views)
+        const sf::IntRect textureRect = m_texture.getTextureRect();
+        m_sprite.setTextureRect(
+            sf::IntRect(textureRect.left + x, textureRect.top + y, width, height));
     }
 
     const Graphics::Texture& Sprite::getTexture() const
@@ -475,6 +552,30 @@ namespace obe::Graphics
                 vili::object { { "r", color.r }, { "g", color.g }, { "b", color.b },
                     { "a", color.a } });
         }
+        if (m_sharedShader)
+        {
+            vili::node shader = m_sharedShader->dump();
+            if (!m_shaderUniforms.empty())
+            {
+                vili::node uniforms = vili::object {};
+                for (const auto& [name, value] : m_shaderUniforms.getValues())
+                {
+                    if (const auto* number = std::get_if<float>(&value))
+                        uniforms.emplace(name, *number);
+                    else if (const auto* vec2 = std::get_if<sf::Vector2f>(&value))
+                        uniforms.emplace(name, vili::array { vec2->x, vec2->y });
+                    else if (const auto* vec3 = std::get_if<sf::Vector3f>(&value))
+                        uniforms.emplace(name, vili::array { vec3->x, vec3->y, vec3->z });
+                    else if (const auto* vec4 = std::get_if<Color>(&value))
+                    {
+                        uniforms.emplace(
+                            name, vili::array { vec4->r, vec4->g, vec4->b, vec4->a });
+                    }
+                }
+                shader.emplace("uniforms", uniforms);
+            }
+            result.emplace("shader", shader);
+        }
         return result;
     }
 
@@ -584,12 +685,102 @@ namespace obe::Graphics
         {
             this->setVisible(data.at("visible"));
         }
+
+        if (data.contains("shader"))
+        {
+            vili::node& shader = data.at("shader");
+            std::vector<std::string> defines;
+            if (shader.contains("defines"))
+            {
+                for (vili::node& define : shader.at("defines"))
+                    defines.push_back(define.as<vili::string>());
+            }
+            this->loadShader(shader.at("path"), defines);
+            if (shader.contains("uniforms"))
+            {
+                for (auto [name, value] : shader.at("uniforms").items())
+                    this->loadShaderUniform(name, value);
+            }
+        }
+    }
+
+    void Sprite::loadShaderUniform(const std::string& name, vili::node& value)
+    {
+        const auto toFloat = [](vili::node& number) -> float {
+            if (number.is_integer())
+                return static_cast<float>(number.as<vili::integer>());
+            return static_cast<float>(number.as<vili::number>());
+        };
+        if (value.is_numeric())
+            this->setShaderUniform(name, toFloat(value));
+        else if (value.is<vili::array>() && value.size() == 2)
+            this->setShaderUniform(name, toFloat(value.at(0)), toFloat(value.at(1)));
+        else if (value.is<vili::array>() && value.size() == 3)
+        {
+            this->setShaderUniform(
+                name, toFloat(value.at(0)), toFloat(value.at(1)), toFloat(value.at(2)));
+        }
+        else if (value.is<vili::array>() && value.size() == 4)
+        {
+            this->setShaderUniform(name,
+                Color(toFloat(value.at(0)), toFloat(value.at(1)), toFloat(value.at(2)),
+                    toFloat(value.at(3))));
+        }
+        else
+        {
+            Debug::Log->warn(
+                "<Sprite> Ignoring shader uniform '{}' of Sprite '{}' with value {}",
+                name, this->getId(), value.dump());
+        }
     }
 
     void Sprite::setShader(Shader* shader)
     {
+        if (shader != m_sharedShader.get())
+            m_sharedShader.reset();
         m_shader = shader;
-        m_shader->setUniform("texture", sf::Shader::CurrentTexture);
+        if (m_shader)
+            m_shader->setUniform("texture", sf::Shader::CurrentTexture);
+    }
+
+    void Sprite::loadShader(
+        const std::string& path, const std::vector<std::string>& defines)
+    {
+        std::shared_ptr<Shader> shader;
+        if (m_resources)
+            shader = m_resources->getShader(path, defines);
+        else
+        {
+            shader = std::make_shared<Shader>();
+            shader->loadShader(path, defines);
+        }
+        m_sharedShader = shader;
+        this->setShader(shader.get());
+    }
+
+    void Sprite::setShaderUniform(const std::string& name, float value)
+    {
+        m_shaderUniforms.set(name, value);
+    }
+
+    void Sprite::setShaderUniform(const std::string& name, float x, float y)
+    {
+        m_shaderUniforms.set(name, sf::Vector2f(x, y));
+    }
+
+    void Sprite::setShaderUniform(const std::string& name, float x, float y, float z)
+    {
+        m_shaderUniforms.set(name, sf::Vector3f(x, y, z));
+    }
+
+    void Sprite::setShaderUniform(const std::string& name, const Color& color)
+    {
+        m_shaderUniforms.set(name, color);
+    }
+
+    void Sprite::removeShaderUniform(const std::string& name)
+    {
+        m_shaderUniforms.remove(name);
     }
 
     Shader& Sprite::getShader() const
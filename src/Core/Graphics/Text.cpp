@@ -1,3 +1,4 @@
+#include <Graphics/SoftwareRenderTarget.hpp>
 #include <Graphics/Text.hpp>
 #include <codecvt>
 
@@ -9,30 +10,193 @@
 
 namespace obe::Graphics
 {
+    namespace
+    {
+        // Same geometry as sf::Text (see Text.cpp in SFML 2.5)
+        void addLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop,
+            float offset, float thickness, float outlineThickness = 0)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+            const float left = -outlineThickness;
+            const float right = lineLength + outlineThickness;
+            const sf::Vector2f texCoords(1, 1);
+            const sf::Color color = sf::Color::White;
+            vertices.emplace_back(
+                sf::Vector2f(left, top - outlineThickness), color, texCoords);
+            vertices.emplace_back(
+                sf::Vector2f(right, top - outlineThickness), color, texCoords);
+            vertices.emplace_back(
+                sf::Vector2f(left, bottom + outlineThickness), color, texCoords);
+            vertices.emplace_back(
+                sf::Vector2f(left, bottom + outlineThickness), color, texCoords);
+            vertices.emplace_back(
+                sf::Vector2f(right, top - outlineThickness), color, texCoords);
+            vertices.emplace_back(
+                sf::Vector2f(right, bottom + outlineThickness), color, texCoords);
+        }
+
+        void addGlyphQuad(std::vector<sf::Vertex>& vertices, const sf::Vector2f& position,
+            const sf::Glyph& glyph, float italicShear, float outlineThickness = 0)
+        {
+            const float padding = 1.0;
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const sf::IntRect& textureRect = glyph.textureRect;
+            const float u1 = static_cast<float>(textureRect.left) - padding;
+            const float v1 = static_cast<float>(textureRect.top) - padding;
+            const float u2
+                = static_cast<float>(textureRect.left + textureRect.width) + padding;
+            const float v2
+                = static_cast<float>(textureRect.top + textureRect.height) + padding;
+
+            const float x = position.x - outlineThickness;
+            const float y = position.y - outlineThickness;
+            const sf::Vector2f topLeft(x + left - italicShear * top, y + top);
+            const sf::Vector2f topRight(x + right - italicShear * top, y + top);
+            const sf::Vector2f bottomLeft(x + left - italicShear * bottom, y + bottom);
+            const sf::Vector2f bottomRight(x + right - italicShear * bottom, y + bottom);
+            const sf::Color color = sf::Color::White;
+            vertices.emplace_back(topLeft, color, sf::Vector2f(u1, v1));
+            vertices.emplace_back(topRight, color, sf::Vector2f(u2, v1));
+            vertices.emplace_back(bottomLeft, color, sf::Vector2f(u1, v2));
+            vertices.emplace_back(bottomLeft, color, sf::Vector2f(u1, v2));
+            vertices.emplace_back(topRight, color, sf::Vector2f(u2, v1));
+            vertices.emplace_back(bottomRight, color, sf::Vector2f(u2, v2));
+        }
+
+        TextLayout computeLayout(const sf::Font& font, const sf::String& string,
+            unsigned int characterSize, sf::Uint32 style, float outlineThickness)
+        {
+            TextLayout layout;
+            layout.lineSpacing = font.getLineSpacing(characterSize);
+            if (string.isEmpty())
+                return layout;
+
+            const bool isBold = style & sf::Text::Bold;
+            const bool isUnderlined = style & sf::Text::Underlined;
+            const bool isStrikeThrough = style & sf::Text::StrikeThrough;
+            const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f;
+            const float underlineOffset = font.getUnderlinePosition(characterSize);
+            const float underlineThickness = font.getUnderlineThickness(characterSize);
+            const sf::FloatRect xBounds
+                = font.getGlyph(L'x', characterSize, isBold).bounds;
+            const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+            const float whitespaceWidth
+                = font.getGlyph(L' ', characterSize, isBold).advance;
+
+            float x = 0.f;
+            const float y = static_cast<float>(characterSize);
+            float minX = static_cast<float>(characterSize);
+            float minY = static_cast<float>(characterSize);
+            float maxX = 0.f;
+            float maxY = 0.f;
+            sf::Uint32 previousCharacter = 0;
+            for (const sf::Uint32 character : string)
+            {
+                if (character == L'\r')
+                    continue;
+                x += font.getKerning(previousCharacter, character, characterSize);
+                previousCharacter = character;
+
+                if (character == L' ' || character == L'\t')
+                {
+                    minX = std::min(minX, x);
+                    minY = std::min(minY, y);
+                    x += (character == L' ') ? whitespaceWidth : whitespaceWidth * 4;
+                    maxX = std::max(maxX, x);
+                    maxY = std::max(maxY, y);
+                    continue;
+                }
+
+                if (outlineThickness != 0)
+                {
+                    const sf::Glyph& glyph = font.getGlyph(
+                        character, characterSize, isBold, outlineThickness);
+                    const sf::FloatRect& bounds = glyph.bounds;
+                    addGlyphQuad(layout.outline, sf::Vector2f(x, y), glyph, italicShear,
+                        outlineThickness);
+                    minX = std::min(minX,
+                        x + bounds.left - italicShear * (bounds.top + bounds.height)
+                            - outlineThickness);
+                    maxX = std::max(maxX,
+                        x + bounds.left + bounds.width - italicShear * bounds.top
+                            - outlineThickness);
+                    minY = std::min(minY, y + bounds.top - outlineThickness);
+                    maxY = std::max(
+                        maxY, y + bounds.top + bounds.height - outlineThickness);
+                }
+
+                const sf::Glyph& glyph = font.getGlyph(character, characterSize, isBold);
+                addGlyphQuad(layout.fill, sf::Vector2f(x, y), glyph, italicShear);
+                if (outlineThickness == 0)
+                {
+                    const sf::FloatRect& bounds = glyph.bounds;
+                    minX = std::min(minX,
+                        x + bounds.left - italicShear * (bounds.top + bounds.height));
+                    maxX = std::max(
+                        maxX, x + bounds.left + bounds.width - italicShear * bounds.top);
+                    minY = std::min(minY, y + bounds.top);
+                    maxY = std::max(maxY, y + bounds.top + bounds.height);
+                }
+                x += glyph.advance;
+            }
+
+            if (isUnderlined && x > 0)
+            {
+                addLine(layout.fill, x, y, underlineOffset, underlineThickness);
+                if (outlineThickness != 0)
+                    addLine(layout.outline, x, y, underlineOffset, underlineThickness,
+                        outlineThickness);
+            }
+            if (isStrikeThrough && x > 0)
+            {
+                addLine(layout.fill, x, y, strikeThroughOffset, underlineThickness);
+                if (outlineThickness != 0)
+                    addLine(layout.outline, x, y, strikeThroughOffset, underlineThickness,
+                        outlineThickness);
+            }
+
+            layout.bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+            return layout;
+        }
+
+        void appendLayoutVertices(sf::VertexArray& vertices,
+            const std::vector<sf::Vertex>& layoutVertices, const sf::Vector2f& offset,
+            const sf::Color& color)
+        {
+            for (const sf::Vertex& vertex : layoutVertices)
+            {
+                vertices.append(
+                    sf::Vertex(vertex.position + offset, color, vertex.texCoords));
+            }
+        }
+    }
+
     Text::Text()
     {
     }
 
     Text::Text(const std::string& string)
     {
-        this->string
-            = std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(string);
+        // Creating the converter is more expensive than the conversion itself
+        thread_local std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+        this->string = converter.from_bytes(string);
     }
 
     void RichText::Line::setCharacterSize(unsigned int size) const
     {
         for (sf::Text& text : m_texts)
             text.setCharacterSize(size);
-
-        updateGeometry();
     }
 
     void RichText::Line::setFont(const sf::Font& font) const
     {
         for (sf::Text& text : m_texts)
             text.setFont(font);
-
-        updateGeometry();
     }
 
     const std::vector<sf::Text>& RichText::Line::getTexts() const
@@ -40,13 +204,14 @@ namespace obe::Graphics
         return m_texts;
     }
 
-    void RichText::Line::appendText(sf::Text text)
+    void RichText::Line::appendText(sf::Text text, TextLayoutPtr layout)
     {
         // Set text offset
-        updateTextAndGeometry(text);
+        updateTextAndGeometry(text, *layout);
 
         // Push back
         m_texts.push_back(std::move(text));
+        m_layouts.push_back(std::move(layout));
     }
 
     ////////////////////////////////////////////////////////////////////////////////
@@ -71,24 +236,42 @@ namespace obe::Graphics
     }
 
     ////////////////////////////////////////////////////////////////////////////////
-    void RichText::Line::updateGeometry() const
+    void RichText::Line::updateGeometry(const RichText& richText) const
     {
         m_bounds = sf::FloatRect();
 
-        for (sf::Text& text : m_texts)
-            updateTextAndGeometry(text);
+        for (std::size_t i = 0; i < m_texts.size(); i++)
+        {
+            m_layouts[i] = richText.getLayout(m_texts[i]);
+            updateTextAndGeometry(m_texts[i], *m_layouts[i]);
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////
-    void RichText::Line::updateTextAndGeometry(sf::Text& text) const
+    void RichText::Line::appendVertices(sf::VertexArray& vertices) const
+    {
+        for (std::size_t i = 0; i < m_texts.size(); i++)
+        {
+            // Outline is drawn below the fill of the same text, like sf::Text does
+            const sf::Vector2f offset = getPosition() + m_texts[i].getPosition();
+            appendLayoutVertices(vertices, m_layouts[i]->outline, offset,
+                m_texts[i].getOutlineColor());
+            appendLayoutVertices(
+                vertices, m_layouts[i]->fill, offset, m_texts[i].getFillColor());
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    void RichText::Line::updateTextAndGeometry(
+        sf::Text& text, const TextLayout& layout) const
     {
         // Set text offset
         text.setPosition(m_bounds.width, 0.f);
 
         // Update bounds
-        const int lineSpacing = text.getFont()->getLineSpacing(text.getCharacterSize());
+        const int lineSpacing = static_cast<int>(layout.lineSpacing);
         m_bounds.height = std::max(m_bounds.height, static_cast<float>(lineSpacing));
-        m_bounds.width += text.getGlobalBounds().width;
+        m_bounds.width += layout.bounds.width;
     }
 
     ////////////////////////////////////////////////////////////////////////////////
@@ -145,7 +328,10 @@ namespace obe::Graphics
 
         // Set texts character size
         for (Line& line : m_lines)
+        {
             line.setCharacterSize(size);
+            line.updateGeometry(*this);
+        }
 
         updateGeometry();
     }
@@ -160,9 +346,15 @@ namespace obe::Graphics
         // Update font
         m_font = font;
 
+        // Layouts of the previous font can't be used anymore
+        m_layouts.clear();
+
         // Set texts font
         for (Line& line : m_lines)
+        {
             line.setFont(font);
+            line.updateGeometry(*this);
+        }
 
         updateGeometry();
     }
@@ -170,8 +362,9 @@ namespace obe::Graphics
     ////////////////////////////////////////////////////////////////////////////////
     void RichText::clear()
     {
-        // Clear texts
+        // Clear texts (layouts are kept for the texts appended next)
         m_lines.clear();
+        m_verticesNeedUpdate = true;
 
         // Reset bounds
         m_bounds = sf::FloatRect();
@@ -199,8 +392,10 @@ namespace obe::Graphics
             m_bounds.height -= line.getGlobalBounds().height;
 
             // Append text
-            line.appendText(
-                createText(*it, text.color, text.outline, text.thickness, text.style));
+            sf::Text newText
+                = createText(*it, text.color, text.outline, text.thickness, text.style);
+            TextLayoutPtr layout = getLayout(newText);
+            line.appendText(std::move(newText), std::move(layout));
 
             // Update bounds
             m_bounds.height += line.getGlobalBounds().height;
@@ -212,8 +407,10 @@ namespace obe::Graphics
         {
             Line line;
             line.setPosition(0.f, m_bounds.height);
-            line.appendText(
-                createText(*it, text.color, text.outline, text.thickness, text.style));
+            sf::Text newText
+                = createText(*it, text.color, text.outline, text.thickness, text.style);
+            TextLayoutPtr layout = getLayout(newText);
+            line.appendText(std::move(newText), std::move(layout));
 
             // Update bounds
             m_bounds.height += line.getGlobalBounds().height;
@@ -222,6 +419,8 @@ namespace obe::Graphics
             m_lines.push_back(std::move(line));
         }
 
+        m_verticesNeedUpdate = true;
+
         // Return
         return *this;
     }
@@ -259,10 +458,14 @@ namespace obe::Graphics
     ////////////////////////////////////////////////////////////////////////////////
     void RichText::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        states.transform *= getTransform();
+        if (!m_font)
+            return;
 
-        for (const Line& line : m_lines)
-            target.draw(line, states);
+        // Every text shares the glyph texture of the font, they are drawn at once
+        states.transform *= getTransform();
+        states.texture
+            = &static_cast<const sf::Font&>(m_font).getTexture(m_characterSize);
+        target.draw(getVertices(), states);
     }
 
     ////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +485,55 @@ namespace obe::Graphics
         return text;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    const sf::VertexArray& RichText::getVertices() const
+    {
+        if (m_verticesNeedUpdate)
+            updateVertices();
+        return m_vertices;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    RichText::TextLayoutPtr RichText::getLayout(const sf::Text& text) const
+    {
+        const TextLayoutKey key(text.getString(), text.getCharacterSize(),
+            text.getStyle(), text.getOutlineThickness());
+        if (const auto layout = m_layouts.find(key); layout != m_layouts.end())
+            return layout->second;
+        TextLayoutPtr layout;
+        if (m_font)
+        {
+            layout = std::make_shared<const TextLayout>(computeLayout(m_font,
+                text.getString(), text.getCharacterSize(), text.getStyle(),
+                text.getOutlineThickness()));
+            // Glyphs rasterized by the layout are added to the glyph page
+            SoftwareRenderTarget::InvalidateTexture(
+                static_cast<const sf::Font&>(m_font).getTexture(text.getCharacterSize()));
+        }
+        else
+            layout = std::make_shared<const TextLayout>();
+        m_layouts.emplace(key, layout);
+        return layout;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    void RichText::updateVertices() const
+    {
+        m_vertices.clear();
+        for (const Line& line : m_lines)
+            line.appendVertices(m_vertices);
+        m_verticesNeedUpdate = false;
+
+        // Forget the layouts of the texts that are not displayed anymore
+        for (auto layout = m_layouts.begin(); layout != m_layouts.end();)
+        {
+            if (layout->second.use_count() == 1)
+                layout = m_layouts.erase(layout);
+            else
+                ++layout;
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     void RichText::updateGeometry() const
     {
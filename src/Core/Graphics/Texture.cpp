@@ -1,4 +1,5 @@
 #include <Graphics/Exceptions.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
 #include <Graphics/Texture.hpp>
 
 #include "Debug/Logger.hpp"
@@ -6,9 +7,20 @@
 
 namespace obe::Graphics
 {
+    namespace
+    {
+        // Pixels read back by the software renderer are stale once modified
+        bool invalidate(const sf::Texture& texture, bool success)
+        {
+            SoftwareRenderTarget::InvalidateTexture(texture);
+            return success;
+        }
+    }
+
     Texture::Texture()
     {
-        m_texture = sf::Texture {};
+        // Owned textures are shared so pending draw calls can keep them alive
+        m_texture = SoftwareRenderTarget::MakeTexture();
     }
 
     Texture::Texture(std::shared_ptr<sf::Texture> texture)
@@ -16,12 +28,20 @@ namespace obe::Graphics
         m_texture = texture;
     }
 
+    Texture::Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect)
+    {
+        m_texture = texture;
+        m_subRect = subRect;
+    }
+
     Texture::Texture(const sf::Texture& texture)
     {
         m_texture = &texture;
     }
 
     Texture::Texture(const Texture& copy)
+        : m_subRect(copy.m_subRect)
+        , m_loading(copy.m_loading)
     {
         if (std::holds_alternative<sf::Texture>(copy.m_texture))
         {
@@ -39,18 +59,25 @@ namespace obe::Graphics
 
     Texture::~Texture()
     {
+        if (std::holds_alternative<sf::Texture>(m_texture))
+            SoftwareRenderTarget::InvalidateTexture(std::get<sf::Texture>(m_texture));
     }
 
     bool Texture::create(unsigned width, unsigned height)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("create", EXC_INFO);
+        }
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
-            return std::get<sf::Texture>(m_texture).create(width, height);
+            sf::Texture& texture = std::get<sf::Texture>(m_texture);
+            return invalidate(texture, texture.create(width, height));
         }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
-            return std::get<std::shared_ptr<sf::Texture>>(m_texture)->create(
-                width, height);
+            sf::Texture& texture = *std::get<std::shared_ptr<sf::Texture>>(m_texture);
+            return invalidate(texture, texture.create(width, height));
         }
         if (std::holds_alternative<const sf::Texture*>(m_texture))
         {
@@ -61,14 +88,19 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("loadFromFile", EXC_INFO);
+        }
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
-            return std::get<sf::Texture>(m_texture).loadFromFile(filename);
+            sf::Texture& texture = std::get<sf::Texture>(m_texture);
+            return invalidate(texture, texture.loadFromFile(filename));
         }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
-            return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromFile(
-                filename);
+            sf::Texture& texture = *std::get<std::shared_ptr<sf::Texture>>(m_texture);
+            return invalidate(texture, texture.loadFromFile(filename));
         }
         if (std::holds_alternative<const sf::Texture*>(m_texture))
         {
@@ -79,6 +111,10 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename, const Transform::Rect& rect)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("loadFromFile", EXC_INFO);
+        }
         const Transform::UnitVector position
             = rect.getPosition().to<Transform::Units::ScenePixels>();
         const Transform::UnitVector size
@@ -86,12 +122,13 @@ namespace obe::Graphics
         const sf::IntRect sfRect(position.x, position.y, size.x, size.y);
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
-            return std::get<sf::Texture>(m_texture).loadFromFile(filename, sfRect);
+            sf::Texture& texture = std::get<sf::Texture>(m_texture);
+            return invalidate(texture, texture.loadFromFile(filename, sfRect));
         }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
-            return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromFile(
-                filename, sfRect);
+            sf::Texture& texture = *std::get<std::shared_ptr<sf::Texture>>(m_texture);
+            return invalidate(texture, texture.loadFromFile(filename, sfRect));
         }
         if (std::holds_alternative<const sf::Texture*>(m_texture))
         {
@@ -102,14 +139,19 @@ namespace obe::Graphics
 
     bool Texture::loadFromImage(const sf::Image& image)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("loadFromImage", EXC_INFO);
+        }
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
-            return std::get<sf::Texture>(m_texture).loadFromImage(image);
+            sf::Texture& texture = std::get<sf::Texture>(m_texture);
+            return invalidate(texture, texture.loadFromImage(image));
         }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
-            return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromImage(
-                image);
+            sf::Texture& texture = *std::get<std::shared_ptr<sf::Texture>>(m_texture);
+            return invalidate(texture, texture.loadFromImage(image));
         }
         if (std::holds_alternative<const sf::Texture*>(m_texture))
         {
@@ -120,6 +162,11 @@ namespace obe::Graphics
 
     Transform::UnitVector Texture::getSize() const
     {
+        if (m_subRect)
+        {
+            return Transform::UnitVector(
+                m_subRect->width, m_subRect->height, Transform::Units::ScenePixels);
+        }
         sf::Vector2u textureSize;
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
@@ -137,8 +184,37 @@ namespace obe::Graphics
             textureSize.x, textureSize.y, Transform::Units::ScenePixels);
     }
 
+    bool Texture::isView() const
+    {
+        return m_subRect.has_value();
+    }
+
+    sf::IntRect Texture::getTextureRect() const
+    {
+        if (m_subRect)
+        {
+            return *m_subRect;
+        }
+        const Transform::UnitVector size = this->getSize();
+        return sf::IntRect(0, 0, size.x, size.y);
+    }
+
+    bool Texture::isLoading() const
+    {
+        return m_loading && *m_loading;
+    }
+
+    void Texture::setLoadingState(std::shared_ptr<const bool> loading)
+    {
+        m_loading = std::move(loading);
+    }
+
     void Texture::setAntiAliasing(bool antiAliasing)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("setAntiAliasing", EXC_INFO);
+        }
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).setSmooth(antiAliasing);
@@ -173,6 +249,10 @@ namespace obe::Graphics
 
     void Texture::setRepeated(bool repeated)
     {
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture("setRepeated", EXC_INFO);
+        }
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).setRepeated(repeated);
@@ -207,7 +287,9 @@ namespace obe::Graphics
 
     void Texture::reset()
     {
-        m_texture = sf::Texture {};
+        m_texture = SoftwareRenderTarget::MakeTexture();
+        m_subRect.reset();
+        m_loading.reset();
     }
 
     unsigned Texture::useCount()
@@ -227,6 +309,13 @@ namespace obe::Graphics
         return false;
     }
 
+    std::shared_ptr<const sf::Texture> Texture::getSharedTexture() const
+    {
+        if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
+            return std::get<std::shared_ptr<sf::Texture>>(m_texture);
+        return nullptr;
+    }
+
     Texture::operator sf::Texture&()
     {
         if (std::holds_alternative<sf::Texture>(m_texture))
@@ -255,6 +344,8 @@ namespace obe::Graphics
 
     Texture& Texture::operator=(const Texture& copy)
     {
+        m_subRect = copy.m_subRect;
+        m_loading = copy.m_loading;
         if (std::holds_alternative<sf::Texture>(copy.m_texture))
         {
             m_texture = &std::get<sf::Texture>(copy.m_texture);
@@ -273,12 +364,16 @@ namespace obe::Graphics
     Texture& Texture::operator=(const sf::Texture& texture)
     {
         m_texture = &texture;
+        m_subRect.reset();
+        m_loading.reset();
         return *this;
     }
 
     Texture& Texture::operator=(std::shared_ptr<sf::Texture> texture)
     {
         m_texture = texture;
+        m_subRect.reset();
+        m_loading.reset();
         return *this;
     }
 }
@@ -0,0 +1,245 @@
+#include <algorithm>
+
+#include <Debug/Logger.hpp>
+#include <Graphics/SoftwareRenderTarget.hpp>
+#include <Graphics/TextureAtlas.hpp>
+
+namespace obe::Graphics
+{
+    SkylinePacker::SkylinePacker(unsigned int width, unsigned int height)
+        : m_width(width)
+        , m_height(height)
+    {
+        this->clear();
+    }
+
+    std::optional<unsigned int> SkylinePacker::fit(
+        std::size_t index, unsigned int width, unsigned int height) const
+    {
+        const unsigned int x = m_skyline[index].x;
+        if (x + width > m_width)
+            return std::nullopt;
+        unsigned int y = m_skyline[index].y;
+        int widthLeft = static_cast<int>(width);
+        for (std::size_t i = index; widthLeft > 0; i++)
+        {
+            if (i >= m_skyline.size())
+                return std::nullopt;
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height)
+                return std::nullopt;
+            widthLeft -= static_cast<int>(m_skyline[i].width);
+        }
+        return y;
+    }
+
+    void SkylinePacker::addLevel(std::size_t index, unsigned int x, unsigned int y,
+        unsigned int width, unsigned int height)
+    {
+        m_skyline.insert(m_skyline.begin() + index, SkylineNode { x, y + height, width });
+
+        // Shrink or remove the nodes now covered by the new level
+        for (std::size_t i = index + 1; i < m_skyline.size();)
+        {
+            const SkylineNode& previous = m_skyline[i - 1];
+            SkylineNode& node = m_skyline[i];
+            const unsigned int previousEnd = previous.x + previous.width;
+            if (node.x >= previousEnd)
+                break;
+            const unsigned int shrink = previousEnd - node.x;
+            if (node.width <= shrink)
+            {
+                m_skyline.erase(m_skyline.begin() + i);
+                continue;
+            }
+            node.x += shrink;
+            node.width -= shrink;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (std::size_t i = 0; i + 1 < m_skyline.size();)
+        {
+            if (m_skyline[i].y == m_skyline[i + 1].y)
+            {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+    }
+
+    std::optional<sf::Vector2u> SkylinePacker::insert(
+        unsigned int width, unsigned int height)
+    {
+        if (width == 0 || height == 0)
+            return std::nullopt;
+        std::optional<std::size_t> bestIndex;
+        unsigned int bestBottom = 0;
+        unsigned int bestWidth = 0;
+        unsigned int bestY = 0;
+        for (std::size_t i = 0; i < m_skyline.size(); i++)
+        {
+            if (const std::optional<unsigned int> y = this->fit(i, width, height); y)
+            {
+                const unsigned int bottom = *y + height;
+                if (!bestIndex || bottom < bestBottom
+                    || (bottom == bestBottom && m_skyline[i].width < bestWidth))
+                {
+                    bestIndex = i;
+                    bestBottom = bottom;
+                    bestWidth = m_skyline[i].width;
+                    bestY = *y;
+                }
+            }
+        }
+        if (!bestIndex)
+            return std::nullopt;
+
+        const unsigned int x = m_skyline[*bestIndex].x;
+        this->addLevel(*bestIndex, x, bestY, width, height);
+        m_usedArea += width * height;
+        return sf::Vector2u(x, bestY);
+    }
+
+    void SkylinePacker::clear()
+    {
+        m_skyline.clear();
+        m_skyline.push_back(SkylineNode { 0, 0, m_width });
+        m_usedArea = 0;
+    }
+
+    double SkylinePacker::getOccupancy() const
+    {
+        return static_cast<double>(m_usedArea)
+            / (static_cast<double>(m_width) * static_cast<double>(m_height));
+    }
+
+    unsigned int SkylinePacker::getWidth() const
+    {
+        return m_width;
+    }
+
+    unsigned int SkylinePacker::getHeight() const
+    {
+        return m_height;
+    }
+
+    TextureAtlas::TextureAtlas(
+        unsigned int pageSize, unsigned int padding, bool antiAliasing)
+        : m_pageSize(pageSize)
+        , m_padding(padding)
+        , m_antiAliasing(antiAliasing)
+    {
+    }
+
+    std::shared_ptr<sf::Texture> TextureAtlas::createPage()
+    {
+        std::shared_ptr<sf::Texture> texture = SoftwareRenderTarget::MakeTexture();
+        if (!texture->create(m_pageSize, m_pageSize))
+        {
+            Debug::Log->warn("<TextureAtlas> Unable to create atlas page of size {0}x{0}",
+                m_pageSize);
+            return nullptr;
+        }
+        // Newly created textures have undefined content
+        const std::vector<sf::Uint8> blank(
+            static_cast<std::size_t>(m_pageSize) * m_pageSize * 4, 0);
+        texture->update(blank.data());
+        texture->setSmooth(m_antiAliasing);
+        Debug::Log->debug(
+            "<TextureAtlas> Creating atlas page {} ({}x{}, antiAliasing: {})",
+            m_pages.size(), m_pageSize, m_pageSize, m_antiAliasing);
+        m_pages.push_back(AtlasPage { texture, SkylinePacker(m_pageSize, m_pageSize) });
+        return texture;
+    }
+
+    bool TextureAtlas::accepts(unsigned int width, unsigned int height) const
+    {
+        return width > 0 && height > 0 && width + m_padding * 2 <= m_pageSize
+            && height + m_padding * 2 <= m_pageSize;
+    }
+
+    std::optional<Texture> TextureAtlas::insert(const sf::Image& image)
+    {
+        const sf::Vector2u imageSize = image.getSize();
+        if (!this->accepts(imageSize.x, imageSize.y))
+            return std::nullopt;
+        const unsigned int paddedWidth = imageSize.x + m_padding * 2;
+        const unsigned int paddedHeight = imageSize.y + m_padding * 2;
+
+        // Pages without any Texture view left have been freed
+        m_pages.erase(std::remove_if(m_pages.begin(), m_pages.end(),
+                          [](const AtlasPage& page) { return page.texture.expired(); }),
+            m_pages.end());
+        std::shared_ptr<sf::Texture> texture;
+        std::optional<sf::Vector2u> position;
+        for (AtlasPage& page : m_pages)
+        {
+            if ((position = page.packer.insert(paddedWidth, paddedHeight)))
+            {
+                texture = page.texture.lock();
+                break;
+            }
+        }
+        if (!texture)
+        {
+            texture = this->createPage();
+            if (!texture)
+                return std::nullopt;
+            position = m_pages.back().packer.insert(paddedWidth, paddedHeight);
+        }
+
+        // Extrude the image borders in the padding area
+        const sf::Uint8* source = image.getPixelsPtr();
+        std::vector<sf::Uint8> padded(
+            static_cast<std::size_t>(paddedWidth) * paddedHeight * 4);
+        for (unsigned int y = 0; y < paddedHeight; y++)
+        {
+            const unsigned int sourceY
+                = std::min(std::max(y, m_padding) - m_padding, imageSize.y - 1);
+            for (unsigned int x = 0; x < paddedWidth; x++)
+            {
+                const unsigned int sourceX
+                    = std::min(std::max(x, m_padding) - m_padding, imageSize.x - 1);
+                const std::size_t from
+                    = (static_cast<std::size_t>(sourceY) * imageSize.x + sourceX) * 4;
+                const std::size_t to
+                    = (static_cast<std::size_t>(y) * paddedWidth + x) * 4;
+                std::copy(source + from, source + from + 4, padded.begin() + to);
+            }
+        }
+        texture->update(
+            padded.data(), paddedWidth, paddedHeight, position->x, position->y);
+        SoftwareRenderTarget::InvalidateTexture(*texture);
+
+        const sf::IntRect region(position->x + m_padding, position->y + m_padding,
+            imageSize.x, imageSize.y);
+        // Each view owns the page through its own control block so the use
+        // count of a view only counts the references to its region
+        const auto owner = std::make_shared<std::shared_ptr<sf::Texture>>(texture);
+        return Texture(std::shared_ptr<sf::Texture>(owner, texture.get()), region);
+    }
+
+    void TextureAtlas::clear()
+    {
+        m_pages.clear();
+    }
+
+    std::size_t TextureAtlas::getPageCount() const
+    {
+        return std::count_if(m_pages.begin(), m_pages.end(),
+            [](const AtlasPage& page) { return !page.texture.expired(); });
+    }
+
+    unsigned int TextureAtlas::getPageSize() const
+    {
+        return m_pageSize;
+    }
+
+    unsigned int TextureAtlas::getPadding() const
+    {
+        return m_padding;
+    }
+} // namespace obe::Graphics
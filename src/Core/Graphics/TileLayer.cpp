@@ -0,0 +1,449 @@
+#include <algorithm>
+
+#include <Engine/ResourceManager.hpp>
+#include <Graphics/Exceptions.hpp>
+#include <Graphics/TileLayer.hpp>
+#include <System/Path.hpp>
+
+#include <vili/node.hpp>
+
+namespace obe::Graphics
+{
+    namespace
+    {
+        double toDouble(const vili::node& number)
+        {
+            if (number.is_integer())
+                return static_cast<double>(number.as<vili::integer>());
+            return number.as<vili::number>();
+        }
+
+        Transform::UnitVector loadUnitVector(const vili::node& vector,
+            const std::string& xKey, const std::string& yKey)
+        {
+            Transform::Units unit = Transform::Units::SceneUnits;
+            if (vector.contains("unit"))
+                unit = Transform::stringToUnits(vector.at("unit"));
+            return Transform::UnitVector(
+                toDouble(vector.at(xKey)), toDouble(vector.at(yKey)), unit);
+        }
+    }
+
+    TileLayer::TileLayer(const std::string& id)
+        : Component(id)
+    {
+    }
+
+    void TileLayer::attachResourceManager(Engine::ResourceManager& resources)
+    {
+        m_resources = &resources;
+    }
+
+    std::size_t TileLayer::getChunkIndex(unsigned int x, unsigned int y) const
+    {
+        return (y / m_chunkSize) * m_chunksX + (x / m_chunkSize);
+    }
+
+    void TileLayer::createChunks()
+    {
+        m_chunksX = (m_width + m_chunkSize - 1) / m_chunkSize;
+        const unsigned int chunksY = (m_height + m_chunkSize - 1) / m_chunkSize;
+        m_chunks.clear();
+        m_chunks.resize(static_cast<std::size_t>(m_chunksX) * chunksY);
+        m_solidAreasChanged = true;
+    }
+
+    void TileLayer::invalidateChunks()
+    {
+        for (Chunk& chunk : m_chunks)
+            chunk.dirty = true;
+    }
+
+    void TileLayer::buildChunk(std::size_t chunkIndex, sf::Vector2f scale)
+    {
+        Chunk& chunk = m_chunks[chunkIndex];
+        const unsigned int firstX
+            = static_cast<unsigned int>(chunkIndex % m_chunksX) * m_chunkSize;
+        const unsigned int firstY
+            = static_cast<unsigned int>(chunkIndex / m_chunksX) * m_chunkSize;
+        const unsigned int lastX = std::min(firstX + m_chunkSize, m_width);
+        const unsigned int lastY = std::min(firstY + m_chunkSize, m_height);
+
+        const Transform::UnitVector origin
+            = m_position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector tileSize
+            = m_tileSize.to<Transform::Units::SceneUnits>();
+        const float originX = static_cast<float>(origin.x) * scale.x;
+        const float originY = static_cast<float>(origin.y) * scale.y;
+        const float tileWidth = static_cast<float>(tileSize.x) * scale.x;
+        const float tileHeight = static_cast<float>(tileSize.y) * scale.y;
+
+        sf::IntRect tilesetRect;
+        if (!m_path.empty())
+            tilesetRect = m_tileset.getTextureRect();
+        const unsigned int columns = std::max(
+            1u, static_cast<unsigned int>(tilesetRect.width) / std::max(1u, m_tileWidth));
+
+        chunk.vertices.clear();
+        for (unsigned int y = firstY; y < lastY; y++)
+        {
+            for (unsigned int x = firstX; x < lastX; x++)
+            {
+                const TileId tile = m_tiles[static_cast<std::size_t>(y) * m_width + x];
+                if (tile == 0)
+                    continue;
+                const float left = originX + static_cast<float>(x) * tileWidth;
+                const float top = originY + static_cast<float>(y) * tileHeight;
+                const float texLeft = static_cast<float>(
+                    tilesetRect.left + ((tile - 1) % columns) * m_tileWidth);
+                const float texTop = static_cast<float>(
+                    tilesetRect.top + ((tile - 1) / columns) * m_tileHeight);
+                const float texRight = texLeft + static_cast<float>(m_tileWidth);
+                const float texBottom = texTop + static_cast<float>(m_tileHeight);
+
+                const sf::Vertex topLeft(sf::Vector2f(left, top), sf::Color::White,
+                    sf::Vector2f(texLeft, texTop));
+                const sf::Vertex topRight(sf::Vector2f(left + tileWidth, top),
+                    sf::Color::White, sf::Vector2f(texRight, texTop));
+                const sf::Vertex bottomRight(
+                    sf::Vector2f(left + tileWidth, top + tileHeight), sf::Color::White,
+                    sf::Vector2f(texRight, texBottom));
+                const sf::Vertex bottomLeft(sf::Vector2f(left, top + tileHeight),
+                    sf::Color::White, sf::Vector2f(texLeft, texBottom));
+                chunk.vertices.insert(chunk.vertices.end(),
+                    { topLeft, topRight, bottomRight, topLeft, bottomRight, bottomLeft });
+            }
+        }
+        chunk.bounds = sf::FloatRect(originX + static_cast<float>(firstX) * tileWidth,
+            originY + static_cast<float>(firstY) * tileHeight,
+            static_cast<float>(lastX - firstX) * tileWidth,
+            static_cast<float>(lastY - firstY) * tileHeight);
+        chunk.dirty = false;
+        chunk.uploaded = false;
+    }
+
+    void TileLayer::create(unsigned int width, unsigned int height)
+    {
+        m_width = width;
+        m_height = height;
+        m_tiles.assign(static_cast<std::size_t>(width) * height, 0);
+        this->createChunks();
+    }
+
+    unsigned int TileLayer::getWidth() const
+    {
+        return m_width;
+    }
+
+    unsigned int TileLayer::getHeight() const
+    {
+        return m_height;
+    }
+
+    void TileLayer::setTile(unsigned int x, unsigned int y, TileId tile)
+    {
+        if (x >= m_width || y >= m_height)
+            return;
+        TileId& cell = m_tiles[static_cast<std::size_t>(y) * m_width + x];
+        if (cell == tile)
+            return;
+        const bool wasSolid = this->isSolid(x, y);
+        cell = tile;
+        m_chunks[this->getChunkIndex(x, y)].dirty = true;
+        if (wasSolid != this->isSolid(x, y))
+            m_solidAreasChanged = true;
+    }
+
+    TileId TileLayer::getTile(unsigned int x, unsigned int y) const
+    {
+        if (x >= m_width || y >= m_height)
+            return 0;
+        return m_tiles[static_cast<std::size_t>(y) * m_width + x];
+    }
+
+    void TileLayer::setTileset(
+        const std::string& path, unsigned int tileWidth, unsigned int tileHeight)
+    {
+        m_tileWidth = tileWidth;
+        m_tileHeight = tileHeight;
+        if (path != m_path)
+        {
+            m_path = path;
+            if (path.empty())
+                m_tileset.reset();
+            else if (m_resources)
+                m_tileset = m_resources->getTexture(path);
+            else
+            {
+                m_tileset.reset();
+                m_tileset.loadFromFile(System::Path(path).find());
+            }
+        }
+        this->invalidateChunks();
+    }
+
+    std::string TileLayer::getTilesetPath() const
+    {
+        return m_path;
+    }
+
+    void TileLayer::setTileSize(const Transform::UnitVector& size)
+    {
+        m_tileSize = size;
+        this->invalidateChunks();
+        m_solidAreasChanged = true;
+    }
+
+    Transform::UnitVector TileLayer::getTileSize() const
+    {
+        return m_tileSize;
+    }
+
+    void TileLayer::setPosition(const Transform::UnitVector& position)
+    {
+        m_position = position;
+        this->invalidateChunks();
+        m_solidAreasChanged = true;
+    }
+
+    Transform::UnitVector TileLayer::getPosition() const
+    {
+        return m_position;
+    }
+
+    void TileLayer::setChunkSize(unsigned int chunkSize)
+    {
+        m_chunkSize = std::max(1u, chunkSize);
+        this->createChunks();
+    }
+
+    unsigned int TileLayer::getChunkSize() const
+    {
+        return m_chunkSize;
+    }
+
+    std::size_t TileLayer::getChunkAmount() const
+    {
+        return m_chunks.size();
+    }
+
+    std::size_t TileLayer::getDrawnChunkAmount() const
+    {
+        return m_drawnChunks;
+    }
+
+    void TileLayer::setSolidTiles(const std::vector<TileId>& tiles)
+    {
+        m_solidTiles = std::unordered_set<TileId>(tiles.begin(), tiles.end());
+        m_solidTiles.erase(0);
+        m_solidAreasChanged = true;
+    }
+
+    std::vector<TileId> TileLayer::getSolidTiles() const
+    {
+        std::vector<TileId> tiles(m_solidTiles.begin(), m_solidTiles.end());
+        std::sort(tiles.begin(), tiles.end());
+        return tiles;
+    }
+
+    bool TileLayer::isSolid(unsigned int x, unsigned int y) const
+    {
+        return m_solidTiles.find(this->getTile(x, y)) != m_solidTiles.end();
+    }
+
+    std::vector<Transform::Rect> TileLayer::getSolidAreas() const
+    {
+        std::vector<Transform::Rect> areas;
+        if (m_solidTiles.empty())
+            return areas;
+        const Transform::UnitVector origin
+            = m_position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector tileSize
+            = m_tileSize.to<Transform::Units::SceneUnits>();
+        std::vector<bool> covered(m_tiles.size(), false);
+        const auto isFree = [&](unsigned int x, unsigned int y) {
+            return this->isSolid(x, y)
+                && !covered[static_cast<std::size_t>(y) * m_width + x];
+        };
+        for (unsigned int y = 0; y < m_height; y++)
+        {
+            for (unsigned int x = 0; x < m_width; x++)
+            {
+                if (!isFree(x, y))
+                    continue;
+                // Widest run on this row, then as many identical rows below as possible
+                unsigned int width = 1;
+                while (x + width < m_width && isFree(x + width, y))
+                    width++;
+                unsigned int height = 1;
+                for (bool fullRow = true; fullRow && y + height < m_height;)
+                {
+                    for (unsigned int runX = x; runX < x + width && fullRow; runX++)
+                        fullRow = isFree(runX, y + height);
+                    if (fullRow)
+                        height++;
+                }
+                for (unsigned int areaY = y; areaY < y + height; areaY++)
+                {
+                    for (unsigned int areaX = x; areaX < x + width; areaX++)
+                        covered[static_cast<std::size_t>(areaY) * m_width + areaX] = true;
+                }
+                areas.emplace_back(Transform::UnitVector(origin.x + x * tileSize.x,
+                                       origin.y + y * tileSize.y),
+                    Transform::UnitVector(width * tileSize.x, height * tileSize.y));
+            }
+        }
+        return areas;
+    }
+
+    bool TileLayer::consumeSolidAreasChange()
+    {
+        const bool changed = m_solidAreasChanged;
+        m_solidAreasChanged = false;
+        return changed;
+    }
+
+    void TileLayer::draw(RenderTarget surface, const Transform::UnitVector& camera)
+    {
+        m_drawnChunks = 0;
+        const Transform::UnitVector pixels
+            = Transform::UnitVector(1, 1).to<Transform::Units::ScenePixels>();
+        const sf::Vector2f scale(
+            static_cast<float>(pixels.x), static_cast<float>(pixels.y));
+        if (scale != m_builtScale)
+        {
+            this->invalidateChunks();
+            m_builtScale = scale;
+        }
+
+        // Chunks are stored in Scene pixels, the view is moved to them instead
+        const sf::View& view = surface.getView();
+        const sf::FloatRect viewRect(
+            view.getCenter().x - view.getSize().x / 2.f + static_cast<float>(camera.x),
+            view.getCenter().y - view.getSize().y / 2.f + static_cast<float>(camera.y),
+            view.getSize().x, view.getSize().y);
+
+        sf::RenderStates states;
+        states.transform.translate(
+            static_cast<float>(-camera.x), static_cast<float>(-camera.y));
+        if (!m_path.empty())
+        {
+            states.texture = &static_cast<const sf::Texture&>(m_tileset);
+            surface.retain(m_tileset.getSharedTexture());
+        }
+        // Vertex buffers live in the OpenGL context of the thread that draws
+        const bool useBuffers = !surface.isSoftware() && !surface.isDeferred()
+            && sf::VertexBuffer::isAvailable();
+        for (std::size_t i = 0; i < m_chunks.size(); i++)
+        {
+            Chunk& chunk = m_chunks[i];
+            if (chunk.dirty)
+                this->buildChunk(i, scale);
+            if (chunk.vertices.empty() || !chunk.bounds.intersects(viewRect))
+                continue;
+            m_drawnChunks++;
+            if (useBuffers)
+            {
+                if (!chunk.uploaded)
+                {
+                    chunk.buffer.setPrimitiveType(sf::Triangles);
+                    chunk.buffer.setUsage(sf::VertexBuffer::Static);
+                    chunk.uploaded = chunk.buffer.create(chunk.vertices.size())
+                        && chunk.buffer.update(chunk.vertices.data());
+                }
+                if (chunk.uploaded)
+                {
+                    RenderStatsCollector::CountDraw(chunk.buffer, states);
+                    surface.draw(chunk.buffer, states);
+                    continue;
+                }
+            }
+            surface.draw(
+                chunk.vertices.data(), chunk.vertices.size(), sf::Triangles, states);
+        }
+    }
+
+    vili::node TileLayer::dump() const
+    {
+        const Transform::UnitVector position
+            = m_position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector tileSize
+            = m_tileSize.to<Transform::Units::SceneUnits>();
+        const std::string sceneUnits
+            = Transform::unitsToString(Transform::Units::SceneUnits);
+        vili::node result = vili::object {};
+        result["tileset"] = vili::object { { "path", m_path },
+            { "tileWidth", static_cast<vili::integer>(m_tileWidth) },
+            { "tileHeight", static_cast<vili::integer>(m_tileHeight) } };
+        result["width"] = static_cast<vili::integer>(m_width);
+        result["height"] = static_cast<vili::integer>(m_height);
+        result["tileSize"] = vili::object { { "width", tileSize.x },
+            { "height", tileSize.y }, { "unit", sceneUnits } };
+        result["position"] = vili::object { { "x", position.x }, { "y", position.y },
+            { "unit", sceneUnits } };
+        result["layer"] = m_layer;
+        result["zdepth"] = m_zdepth;
+        result["chunkSize"] = static_cast<vili::integer>(m_chunkSize);
+        result["visible"] = m_visible;
+        vili::node tiles = vili::array {};
+        for (const TileId tile : m_tiles)
+            tiles.push(static_cast<vili::integer>(tile));
+        result["tiles"] = tiles;
+        if (!m_solidTiles.empty())
+        {
+            vili::node solid = vili::array {};
+            for (const TileId tile : this->getSolidTiles())
+                solid.push(static_cast<vili::integer>(tile));
+            result["solid"] = solid;
+        }
+        return result;
+    }
+
+    void TileLayer::load(vili::node& data)
+    {
+        if (data.contains("tileset"))
+        {
+            vili::node& tileset = data.at("tileset");
+            unsigned int tileWidth = m_tileWidth;
+            unsigned int tileHeight = m_tileHeight;
+            if (tileset.contains("tileWidth"))
+                tileWidth = tileset.at("tileWidth").as<vili::integer>();
+            if (tileset.contains("tileHeight"))
+                tileHeight = tileset.at("tileHeight").as<vili::integer>();
+            this->setTileset(tileset.at("path"), tileWidth, tileHeight);
+        }
+        if (data.contains("tileSize"))
+            m_tileSize = loadUnitVector(data.at("tileSize"), "width", "height");
+        if (data.contains("position"))
+            m_position = loadUnitVector(data.at("position"), "x", "y");
+        if (data.contains("layer"))
+            m_layer = data.at("layer").as<vili::integer>();
+        if (data.contains("zdepth"))
+            m_zdepth = data.at("zdepth").as<vili::integer>();
+        if (data.contains("visible"))
+            m_visible = data.at("visible");
+        if (data.contains("chunkSize"))
+        {
+            m_chunkSize
+                = std::max<unsigned int>(1, data.at("chunkSize").as<vili::integer>());
+        }
+        this->create(data.at("width").as<vili::integer>(),
+            data.at("height").as<vili::integer>());
+        if (data.contains("tiles"))
+        {
+            vili::node& tiles = data.at("tiles");
+            if (tiles.size() != m_tiles.size())
+                throw Exceptions::InvalidTileAmount(
+                    this->getId(), m_width, m_height, tiles.size(), EXC_INFO);
+            for (std::size_t i = 0; i < tiles.size(); i++)
+                m_tiles[i] = static_cast<TileId>(tiles.at(i).as<vili::integer>());
+        }
+        if (data.contains("solid"))
+        {
+            std::vector<TileId> solidTiles;
+            for (vili::node& tile : data.at("solid"))
+                solidTiles.push_back(static_cast<TileId>(tile.as<vili::integer>()));
+            this->setSolidTiles(solidTiles);
+        }
+    }
+} // namespace obe::Graphics
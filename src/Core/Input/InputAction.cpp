@@ -10,6 +10,7 @@ namespace obe::Input
     {
         m_actionTrigger = triggerPtr;
         triggerPtr->add(id);
+        m_trigger = triggerPtr->getHandle(id);
     }
 
     void InputAction::addCondition(const InputCondition& condition)
@@ -75,8 +76,7 @@ namespace obe::Input
                         const InputActionEvent ev(*this, condition);
                         if (m_callback)
                             m_callback(ev);
-                        m_actionTrigger->pushParameter(m_id, "event", ev);
-                        m_actionTrigger->trigger(m_id);
+                        m_trigger.pushParameter("event", ev).trigger();
                     }
                 }
                 else
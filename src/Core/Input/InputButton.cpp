@@ -80,6 +80,8 @@ namespace obe::Input
 
     bool InputButton::isPressed() const
     {
+        if (m_simulatedState)
+            return *m_simulatedState;
         if (m_type == InputType::Mouse)
             return sf::Mouse::isButtonPressed(std::get<sf::Mouse::Button>(m_button));
         if (m_type == InputType::GamepadButton)
@@ -97,6 +99,16 @@ namespace obe::Input
         return sf::Keyboard::isKeyPressed(std::get<sf::Keyboard::Key>(m_button));
     }
 
+    void InputButton::setSimulatedState(const bool pressed)
+    {
+        m_simulatedState = pressed;
+    }
+
+    void InputButton::clearSimulatedState()
+    {
+        m_simulatedState.reset();
+    }
+
     float InputButton::getAxisPosition()
     {
         if (m_type == InputType::GamepadAxis)
@@ -54,9 +54,11 @@ namespace obe::Input
         }
         if (oldState != m_buttonState)
         {
-            triggers->pushParameter(m_button.getName(), "previousState", oldState);
-            triggers->pushParameter(m_button.getName(), "state", m_buttonState);
-            triggers->trigger(m_button.getName());
+            if (!m_trigger)
+                m_trigger = triggers->getHandle(m_button.getName());
+            m_trigger.pushParameter("previousState", oldState)
+                .pushParameter("state", m_buttonState)
+                .trigger();
         }
     }
 
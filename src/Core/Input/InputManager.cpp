@@ -1,5 +1,6 @@
 #include <set>
 
+#include <Debug/Profiler.hpp>
 #include <Input/Exceptions.hpp>
 #include <Input/InputManager.hpp>
 #include <Triggers/TriggerManager.hpp>
@@ -36,6 +37,7 @@ namespace obe::Input
 
     InputManager::InputManager()
         : Togglable(true)
+        , m_recorder(*this)
     {
     }
 
@@ -66,6 +68,8 @@ namespace obe::Input
 
     void InputManager::update()
     {
+        OBE_PROFILE_ZONE("InputManager::update");
+        m_recorder.updateButtons();
         if (m_enabled)
         {
             auto actionBuffer = m_currentActions;
@@ -336,6 +340,11 @@ namespace obe::Input
         m_refresh = true;
     }
 
+    InputRecorder& InputManager::getRecorder()
+    {
+        return m_recorder;
+    }
+
     bool isKeyAlreadyInCombination(InputCombination& combination, InputButton* button)
     {
         for (auto& [monitoredButton, _] : combination)
@@ -0,0 +1,332 @@
+#include <cstring>
+#include <unordered_map>
+
+#include <Debug/Logger.hpp>
+#include <Input/Exceptions.hpp>
+#include <Input/InputManager.hpp>
+#include <Input/InputRecorder.hpp>
+#include <Utils/MathUtils.hpp>
+
+namespace obe::Input
+{
+    namespace
+    {
+        constexpr char RecordingMagic[4] = { 'O', 'B', 'I', 'R' };
+        constexpr std::uint32_t RecordingVersion = 1;
+
+        // Values are written with the byte order of the host
+        template <class T> void write(std::ostream& output, const T& value)
+        {
+            output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <class T> bool read(std::istream& input, T& value)
+        {
+            return static_cast<bool>(
+                input.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        std::int32_t getEventCode(const sf::Event& event)
+        {
+            switch (event.type)
+            {
+            case sf::Event::KeyPressed:
+                [[fallthrough]];
+            case sf::Event::KeyReleased:
+                return event.key.code;
+            case sf::Event::MouseButtonPressed:
+                [[fallthrough]];
+            case sf::Event::MouseButtonReleased:
+                return event.mouseButton.button;
+            case sf::Event::JoystickButtonPressed:
+                [[fallthrough]];
+            case sf::Event::JoystickButtonReleased:
+                return event.joystickButton.button;
+            case sf::Event::JoystickMoved:
+                return event.joystickMove.axis;
+            default:
+                return -1;
+            }
+        }
+
+        sf::Event makeEvent(sf::Event::EventType type, std::int32_t code)
+        {
+            sf::Event event;
+            std::memset(&event, 0, sizeof(sf::Event));
+            event.type = type;
+            if (type == sf::Event::KeyPressed || type == sf::Event::KeyReleased)
+                event.key.code = static_cast<sf::Keyboard::Key>(code);
+            else if (type == sf::Event::MouseButtonPressed
+                || type == sf::Event::MouseButtonReleased)
+                event.mouseButton.button = static_cast<sf::Mouse::Button>(code);
+            else if (type == sf::Event::JoystickButtonPressed
+                || type == sf::Event::JoystickButtonReleased)
+                event.joystickButton.button = code;
+            else if (type == sf::Event::JoystickMoved)
+                event.joystickMove.axis = static_cast<sf::Joystick::Axis>(code);
+            return event;
+        }
+    }
+
+    InputRecorder::InputRecorder(InputManager& input)
+        : m_input(input)
+    {
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        this->stop();
+    }
+
+    void InputRecorder::startRecording(const std::string& path, const unsigned int seed)
+    {
+        this->stop();
+        m_output.open(path, std::ios::binary);
+        if (!m_output)
+            throw Exceptions::InputRecordingError(path, "can't open file", EXC_INFO);
+        m_path = path;
+        m_seed = seed;
+        m_frame = 0;
+        m_buttons = m_input.getInputs();
+        m_states.assign(m_buttons.size(), false);
+        Utils::Math::setSeed(m_seed);
+
+        m_output.write(RecordingMagic, sizeof(RecordingMagic));
+        write(m_output, RecordingVersion);
+        write(m_output, static_cast<std::uint32_t>(m_seed));
+        write(m_output, static_cast<std::uint32_t>(m_buttons.size()));
+        for (const InputButton* button : m_buttons)
+        {
+            const std::string name = button->getName();
+            write(m_output, static_cast<std::uint16_t>(name.size()));
+            m_output.write(name.data(), name.size());
+        }
+        Debug::Log->info(
+            "<InputRecorder> Recording inputs to '{}' (seed {})", m_path, m_seed);
+    }
+
+    void InputRecorder::startReplay(const std::string& path)
+    {
+        this->stop();
+        m_replay.open(path, std::ios::binary);
+        if (!m_replay)
+            throw Exceptions::InputRecordingError(path, "can't open file", EXC_INFO);
+        m_path = path;
+        m_frame = 0;
+
+        char magic[sizeof(RecordingMagic)];
+        std::uint32_t version = 0;
+        std::uint32_t seed = 0;
+        std::uint32_t buttonAmount = 0;
+        m_replay.read(magic, sizeof(magic));
+        if (!m_replay || std::memcmp(magic, RecordingMagic, sizeof(magic)) != 0
+            || !read(m_replay, version) || version != RecordingVersion)
+        {
+            m_replay.close();
+            throw Exceptions::InputRecordingError(
+                path, "not an input recording or unsupported version", EXC_INFO);
+        }
+        read(m_replay, seed);
+        read(m_replay, buttonAmount);
+
+        std::unordered_map<std::string, InputButton*> buttons;
+        for (InputButton* button : m_input.getInputs())
+            buttons.emplace(button->getName(), button);
+        m_buttons.clear();
+        for (std::uint32_t i = 0; i < buttonAmount; i++)
+        {
+            std::uint16_t nameSize = 0;
+            read(m_replay, nameSize);
+            std::string name(nameSize, '\0');
+            m_replay.read(name.data(), nameSize);
+            if (const auto button = buttons.find(name); button != buttons.end())
+                m_buttons.push_back(button->second);
+            else
+            {
+                Debug::Log->warn(
+                    "<InputRecorder> InputButton '{}' of the recording is unknown", name);
+                m_buttons.push_back(nullptr);
+            }
+        }
+        if (!m_replay)
+        {
+            m_replay.close();
+            throw Exceptions::InputRecordingError(path, "truncated header", EXC_INFO);
+        }
+
+        // Devices are ignored for the whole replay
+        for (const auto& [_, button] : buttons)
+            button->setSimulatedState(false);
+        m_states.assign(m_buttons.size(), false);
+        m_seed = seed;
+        Utils::Math::setSeed(m_seed);
+        Debug::Log->info(
+            "<InputRecorder> Replaying inputs from '{}' (seed {})", m_path, m_seed);
+    }
+
+    void InputRecorder::stop()
+    {
+        if (m_output.is_open())
+        {
+            if (m_pendingFrame)
+                this->writeFrame();
+            m_output.close();
+            Debug::Log->info(
+                "<InputRecorder> Recorded {} frames to '{}'", m_frame, m_path);
+        }
+        if (m_replay.is_open())
+        {
+            m_replay.close();
+            for (InputButton* button : m_input.getInputs())
+                button->clearSimulatedState();
+            Debug::Log->info(
+                "<InputRecorder> Replayed {} frames from '{}'", m_frame, m_path);
+        }
+        m_pendingFrame = false;
+        m_changes.clear();
+        m_events.clear();
+    }
+
+    bool InputRecorder::isRecording() const
+    {
+        return m_output.is_open();
+    }
+
+    bool InputRecorder::isReplaying() const
+    {
+        return m_replay.is_open();
+    }
+
+    std::string InputRecorder::getPath() const
+    {
+        return m_path;
+    }
+
+    unsigned int InputRecorder::getSeed() const
+    {
+        return m_seed;
+    }
+
+    std::size_t InputRecorder::getFrame() const
+    {
+        return m_frame;
+    }
+
+    void InputRecorder::writeFrame()
+    {
+        write(m_output, m_deltaTime);
+        write(m_output, static_cast<std::uint16_t>(m_changes.size()));
+        for (const std::uint16_t change : m_changes)
+            write(m_output, change);
+        write(m_output, static_cast<std::uint16_t>(m_events.size()));
+        for (const sf::Event& event : m_events)
+        {
+            write(m_output, static_cast<std::uint8_t>(event.type));
+            write(m_output, getEventCode(event));
+        }
+        m_pendingFrame = false;
+    }
+
+    bool InputRecorder::readFrame()
+    {
+        m_changes.clear();
+        m_events.clear();
+        if (!read(m_replay, m_deltaTime))
+            return false;
+        std::uint16_t amount = 0;
+        read(m_replay, amount);
+        m_changes.resize(amount);
+        for (std::uint16_t& change : m_changes)
+            read(m_replay, change);
+        read(m_replay, amount);
+        for (std::uint16_t i = 0; i < amount; i++)
+        {
+            std::uint8_t type = 0;
+            std::int32_t code = 0;
+            read(m_replay, type);
+            read(m_replay, code);
+            m_events.push_back(makeEvent(static_cast<sf::Event::EventType>(type), code));
+        }
+        if (!m_replay)
+        {
+            Debug::Log->warn(
+                "<InputRecorder> Frame {} of '{}' is truncated", m_frame, m_path);
+            return false;
+        }
+        for (const std::uint16_t change : m_changes)
+        {
+            if (change >= m_buttons.size())
+            {
+                const std::string reason
+                    = fmt::format("invalid InputButton in frame {}", m_frame);
+                this->stop();
+                throw Exceptions::InputRecordingError(m_path, reason, EXC_INFO);
+            }
+        }
+        return true;
+    }
+
+    void InputRecorder::recordFrame(const Time::TimeUnit deltaTime)
+    {
+        if (!m_output.is_open())
+            return;
+        if (m_pendingFrame)
+            this->writeFrame();
+        m_deltaTime = deltaTime;
+        m_changes.clear();
+        m_events.clear();
+        m_pendingFrame = true;
+        m_frame++;
+    }
+
+    bool InputRecorder::replayFrame(Time::TimeUnit& deltaTime)
+    {
+        if (!m_replay.is_open())
+            return false;
+        if (!this->readFrame())
+        {
+            this->stop();
+            return false;
+        }
+        deltaTime = m_deltaTime;
+        m_frame++;
+        return true;
+    }
+
+    void InputRecorder::recordEvent(const sf::Event& event)
+    {
+        if (m_pendingFrame && getEventCode(event) != -1)
+            m_events.push_back(event);
+    }
+
+    const std::vector<sf::Event>& InputRecorder::getReplayedEvents() const
+    {
+        return m_events;
+    }
+
+    void InputRecorder::updateButtons()
+    {
+        if (m_pendingFrame)
+        {
+            for (std::size_t i = 0; i < m_buttons.size(); i++)
+            {
+                const bool pressed = m_buttons[i]->isPressed();
+                if (pressed != m_states[i])
+                {
+                    m_states[i] = pressed;
+                    m_changes.push_back(static_cast<std::uint16_t>(i));
+                }
+            }
+        }
+        else if (m_replay.is_open())
+        {
+            for (const std::uint16_t change : m_changes)
+            {
+                m_states[change] = !m_states[change];
+                if (m_buttons[change])
+                    m_buttons[change]->setSimulatedState(m_states[change]);
+            }
+            m_changes.clear();
+        }
+    }
+} // namespace obe::Input
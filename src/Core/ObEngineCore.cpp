@@ -30,9 +30,6 @@ namespace obe
         Debug::Log->debug("<ObEngine> Mounting paths");
         System::MountablePath::LoadMountFile();
 
-        Debug::Log->debug("<ObEngine> Initialising NullTexture");
-        Graphics::MakeNullTexture();
-
         Debug::Log->info("<ObEngine> Initialisation over !");
     }
 }
\ No newline at end of file
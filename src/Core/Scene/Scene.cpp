@@ -1,4 +1,5 @@
 #include <Config/Templates/Scene.hpp>
+#include <Debug/Profiler.hpp>
 #include <Scene/Exceptions.hpp>
 #include <Scene/Scene.hpp>
 #include <Script/ViliLuaBridge.hpp>
@@ -13,6 +14,21 @@
 
 namespace obe::Scene
 {
+    namespace
+    {
+        /**
+         * \brief Order in which the Scene draws its elements, higher layers
+         *        and z-depths are drawn first
+         */
+        template <class First, class Second>
+        bool isDrawnBefore(const First& first, const Second& second)
+        {
+            if (first.getLayer() == second.getLayer())
+                return first.getZDepth() > second.getZDepth();
+            return first.getLayer() > second.getLayer();
+        }
+    }
+
     Scene::Scene(Triggers::TriggerManager& triggers, sol::state_view lua)
         : m_lua(lua)
         , m_triggers(triggers)
@@ -121,6 +137,7 @@ namespace obe::Scene
 
     void Scene::loadFromFile(const std::string& path)
     {
+        OBE_PROFILE_ZONE("Scene::loadFromFile");
         Debug::Log->debug("<Scene> Loading Scene from map file : '{0}'", path);
         this->clear();
         Debug::Log->debug("<Scene> Cleared Scene");
@@ -143,6 +160,11 @@ namespace obe::Scene
         m_onLoadCallback = callback;
     }
 
+    bool Scene::hasFutureLoad() const
+    {
+        return !m_futureLoad.empty();
+    }
+
     void Scene::clear()
     {
         if (m_resources)
@@ -183,6 +205,10 @@ namespace obe::Scene
                     return true;
                 }),
             m_colliderArray.end());
+        Debug::Log->debug("<Scene> Cleaning ParticleEmitter Array");
+        m_particleEmitterArray.clear();
+        Debug::Log->debug("<Scene> Cleaning TileLayer Array");
+        m_tileLayerArray.clear();
         Debug::Log->debug("<Scene> Clearing MapScript Array");
         m_scriptArray.clear();
         Debug::Log->debug("<Scene> Scene Cleared !");
@@ -225,6 +251,22 @@ namespace obe::Scene
             }
         }
 
+        // TileLayers
+        if (!m_tileLayerArray.empty())
+            result["TileLayers"] = vili::object {};
+        for (auto& tileLayer : m_tileLayerArray)
+        {
+            result["TileLayers"][tileLayer->getId()] = tileLayer->dump();
+        }
+
+        // ParticleEmitters
+        if (!m_particleEmitterArray.empty())
+            result["ParticleEmitters"] = vili::object {};
+        for (auto& emitter : m_particleEmitterArray)
+        {
+            result["ParticleEmitters"][emitter->getId()] = emitter->dump();
+        }
+
         // GameObjects
         if (!m_gameObjectArray.empty())
             result["GameObjects"] = vili::object {};
@@ -317,6 +359,23 @@ namespace obe::Scene
             }
         }
 
+        if (!data["TileLayers"].is_null())
+        {
+            for (auto [tileLayerId, tileLayer] : data.at("TileLayers").items())
+            {
+                this->createTileLayer(tileLayerId).load(tileLayer);
+            }
+            this->updateTileLayerColliders();
+        }
+
+        if (!data["ParticleEmitters"].is_null())
+        {
+            for (auto [emitterId, emitter] : data.at("ParticleEmitters").items())
+            {
+                this->createParticleEmitter(emitterId).load(emitter);
+            }
+        }
+
         if (!data["GameObjects"].is_null())
         {
             vili::node& gameObjects = data.at("GameObjects");
@@ -377,6 +436,7 @@ namespace obe::Scene
 
     void Scene::update()
     {
+        OBE_PROFILE_ZONE("Scene::update");
         if (!m_futureLoad.empty())
         {
             const std::string futureLoadBuffer = std::move(m_futureLoad);
@@ -396,6 +456,7 @@ namespace obe::Scene
                 }
             }
         }
+        this->updateTileLayerColliders();
         if (m_updateState)
         {
             const size_t arraySize = m_gameObjectArray.size();
@@ -421,11 +482,16 @@ namespace obe::Scene
                         return false;
                     }),
                 m_gameObjectArray.end());
+            for (auto& emitter : m_particleEmitterArray)
+            {
+                emitter->update();
+            }
         }
     }
 
     void Scene::draw(Graphics::RenderTarget surface)
     {
+        OBE_PROFILE_ZONE("Scene::draw");
         for (auto it = m_spriteArray.begin(); it != m_spriteArray.end(); ++it)
         {
             if (it->get()->m_layerChanged)
@@ -441,13 +507,39 @@ namespace obe::Scene
 
         const Transform::UnitVector pixelCamera
             = m_camera.getPosition().to<Transform::Units::ScenePixels>();
+        m_renderables.clear();
+        for (auto& tileLayer : m_tileLayerArray)
+            m_renderables.push_back(tileLayer.get());
+        for (auto& emitter : m_particleEmitterArray)
+            m_renderables.push_back(emitter.get());
+        std::stable_sort(m_renderables.begin(), m_renderables.end(),
+            [](Graphics::Renderable* renderable1, Graphics::Renderable* renderable2) {
+                return isDrawnBefore(*renderable1, *renderable2);
+            });
+        auto renderable = m_renderables.begin();
+        const auto drawRenderable = [&pixelCamera, &surface](
+                                        Graphics::Renderable* renderableToDraw) {
+            if (renderableToDraw->isVisible())
+                renderableToDraw->draw(surface, pixelCamera);
+        };
         for (auto& sprite : m_spriteArray)
         {
+            // TileLayers and ParticleEmitters are interleaved with Sprites
+            for (; renderable != m_renderables.end()
+                 && isDrawnBefore(**renderable, *sprite);
+                 ++renderable)
+            {
+                drawRenderable(*renderable);
+            }
             if (sprite->isVisible())
             {
                 sprite->draw(surface, pixelCamera);
             }
         }
+        for (; renderable != m_renderables.end(); ++renderable)
+        {
+            drawRenderable(*renderable);
+        }
 
         if (m_showElements["SceneNodes"])
         {
@@ -466,6 +558,8 @@ namespace obe::Scene
                 sceneNodeCircle.setOutlineColor(sf::Color::Black);
                 sceneNodeCircle.setOutlineThickness(2);
                 sceneNodeCircle.setRadius(6);
+                Graphics::RenderStatsCollector::CountDraw(
+                    sceneNodeCircle, sf::RenderStates::Default);
                 surface.draw(sceneNodeCircle);
             }
         }
@@ -589,14 +683,7 @@ namespace obe::Scene
     {
         std::sort(
             m_spriteArray.begin(), m_spriteArray.end(), [](auto& sprite1, auto& sprite2) {
-                if (sprite1->getLayer() == sprite2->getLayer())
-                {
-                    return sprite1->getZDepth() > sprite2->getZDepth();
-                }
-                else
-                {
-                    return sprite1->getLayer() > sprite2->getLayer();
-                }
+                return isDrawnBefore(*sprite1, *sprite2);
             });
     }
 
@@ -692,6 +779,205 @@ namespace obe::Scene
             m_spriteArray.end());
     }
 
+    Graphics::ParticleEmitter& Scene::createParticleEmitter(const std::string& id)
+    {
+        std::string createId = id;
+        if (createId.empty())
+        {
+            int i = 0;
+            std::string testId
+                = "emitter" + std::to_string(this->getParticleEmitterAmount() + i);
+            while (this->doesParticleEmitterExists(testId))
+            {
+                testId = "emitter"
+                    + std::to_string(this->getParticleEmitterAmount() + i++);
+            }
+            createId = testId;
+        }
+        if (!this->doesParticleEmitterExists(createId))
+        {
+            std::unique_ptr<Graphics::ParticleEmitter> newEmitter
+                = std::make_unique<Graphics::ParticleEmitter>(createId);
+            if (m_resources)
+                newEmitter->attachResourceManager(*m_resources);
+            m_particleEmitterArray.push_back(move(newEmitter));
+            return *m_particleEmitterArray.back();
+        }
+        else
+        {
+            Debug::Log->warn("<Scene> ParticleEmitter '{0}' already exists !", createId);
+            return this->getParticleEmitter(createId);
+        }
+    }
+
+    std::size_t Scene::getParticleEmitterAmount() const
+    {
+        return m_particleEmitterArray.size();
+    }
+
+    std::vector<Graphics::ParticleEmitter*> Scene::getAllParticleEmitters()
+    {
+        std::vector<Graphics::ParticleEmitter*> allEmitters;
+        allEmitters.reserve(m_particleEmitterArray.size());
+        for (auto& emitter : m_particleEmitterArray)
+            allEmitters.push_back(emitter.get());
+        return allEmitters;
+    }
+
+    Graphics::ParticleEmitter& Scene::getParticleEmitter(const std::string& id)
+    {
+        for (auto& emitter : m_particleEmitterArray)
+        {
+            if (emitter->getId() == id)
+                return *emitter;
+        }
+        std::vector<std::string> emittersIds;
+        emittersIds.reserve(m_particleEmitterArray.size());
+        for (const auto& emitter : m_particleEmitterArray)
+        {
+            emittersIds.push_back(emitter->getId());
+        }
+        throw Exceptions::UnknownParticleEmitter(
+            m_levelFileName, id, emittersIds, EXC_INFO);
+    }
+
+    bool Scene::doesParticleEmitterExists(const std::string& id)
+    {
+        for (auto& emitter : m_particleEmitterArray)
+        {
+            if (emitter->getId() == id)
+                return true;
+        }
+        return false;
+    }
+
+    void Scene::removeParticleEmitter(const std::string& id)
+    {
+        Debug::Log->debug("<Scene> Removing ParticleEmitter {0}", id);
+        m_particleEmitterArray.erase(
+            std::remove_if(m_particleEmitterArray.begin(), m_particleEmitterArray.end(),
+                [&id](const std::unique_ptr<Graphics::ParticleEmitter>& emitter) {
+                    return (emitter->getId() == id);
+                }),
+            m_particleEmitterArray.end());
+    }
+
+    Graphics::TileLayer& Scene::createTileLayer(const std::string& id)
+    {
+        std::string createId = id;
+        if (createId.empty())
+        {
+            int i = 0;
+            std::string testId
+                = "tileLayer" + std::to_string(this->getTileLayerAmount() + i);
+            while (this->doesTileLayerExists(testId))
+            {
+                testId = "tileLayer" + std::to_string(this->getTileLayerAmount() + i++);
+            }
+            createId = testId;
+        }
+        if (!this->doesTileLayerExists(createId))
+        {
+            std::unique_ptr<Graphics::TileLayer> newTileLayer
+                = std::make_unique<Graphics::TileLayer>(createId);
+            if (m_resources)
+                newTileLayer->attachResourceManager(*m_resources);
+            m_tileLayerArray.push_back(move(newTileLayer));
+            return *m_tileLayerArray.back();
+        }
+        else
+        {
+            Debug::Log->warn("<Scene> TileLayer '{0}' already exists !", createId);
+            return this->getTileLayer(createId);
+        }
+    }
+
+    std::size_t Scene::getTileLayerAmount() const
+    {
+        return m_tileLayerArray.size();
+    }
+
+    std::vector<Graphics::TileLayer*> Scene::getAllTileLayers()
+    {
+        std::vector<Graphics::TileLayer*> allTileLayers;
+        allTileLayers.reserve(m_tileLayerArray.size());
+        for (auto& tileLayer : m_tileLayerArray)
+            allTileLayers.push_back(tileLayer.get());
+        return allTileLayers;
+    }
+
+    Graphics::TileLayer& Scene::getTileLayer(const std::string& id)
+    {
+        for (auto& tileLayer : m_tileLayerArray)
+        {
+            if (tileLayer->getId() == id)
+                return *tileLayer;
+        }
+        std::vector<std::string> tileLayersIds;
+        tileLayersIds.reserve(m_tileLayerArray.size());
+        for (const auto& tileLayer : m_tileLayerArray)
+        {
+            tileLayersIds.push_back(tileLayer->getId());
+        }
+        throw Exceptions::UnknownTileLayer(m_levelFileName, id, tileLayersIds, EXC_INFO);
+    }
+
+    bool Scene::doesTileLayerExists(const std::string& id)
+    {
+        for (auto& tileLayer : m_tileLayerArray)
+        {
+            if (tileLayer->getId() == id)
+                return true;
+        }
+        return false;
+    }
+
+    void Scene::removeTileLayer(const std::string& id)
+    {
+        Debug::Log->debug("<Scene> Removing TileLayer {0}", id);
+        m_tileLayerArray.erase(
+            std::remove_if(m_tileLayerArray.begin(), m_tileLayerArray.end(),
+                [&id](const std::unique_ptr<Graphics::TileLayer>& tileLayer) {
+                    return (tileLayer->getId() == id);
+                }),
+            m_tileLayerArray.end());
+        m_colliderArray.erase(
+            std::remove_if(m_colliderArray.begin(), m_colliderArray.end(),
+                [&id](const std::unique_ptr<Collision::PolygonalCollider>& collider) {
+                    return (collider->getParentId() == id);
+                }),
+            m_colliderArray.end());
+    }
+
+    void Scene::updateTileLayerColliders()
+    {
+        for (auto& tileLayer : m_tileLayerArray)
+        {
+            if (!tileLayer->consumeSolidAreasChange())
+                continue;
+            const std::string& layerId = tileLayer->getId();
+            m_colliderArray.erase(
+                std::remove_if(m_colliderArray.begin(), m_colliderArray.end(),
+                    [&layerId](const std::unique_ptr<Collision::PolygonalCollider>& ptr) {
+                        return (ptr->getParentId() == layerId);
+                    }),
+                m_colliderArray.end());
+            std::size_t index = 0;
+            for (const Transform::Rect& area : tileLayer->getSolidAreas())
+            {
+                // Parented to the TileLayer so they are not dumped with the Scene
+                auto collider = std::make_unique<Collision::PolygonalCollider>(
+                    layerId + "_solid" + std::to_string(index++));
+                collider->setParentId(layerId);
+                collider->addPoint(area.getPosition(Transform::Referential::TopLeft));
+                collider->addPoint(area.getPosition(Transform::Referential::TopRight));
+                collider->addPoint(area.getPosition(Transform::Referential::BottomRight));
+                collider->addPoint(area.getPosition(Transform::Referential::BottomLeft));
+                m_colliderArray.push_back(std::move(collider));
+            }
+        }
+    }
+
     void Scene::enableShowSceneNodes(bool showNodes)
     {
         m_showElements["SceneNodes"] = showNodes;
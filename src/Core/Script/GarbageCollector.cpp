@@ -0,0 +1,231 @@
+#include <algorithm>
+
+#include <Debug/Logger.hpp>
+#include <Script/GarbageCollector.hpp>
+
+namespace obe::Script
+{
+    namespace
+    {
+        constexpr std::chrono::seconds HeapLimitWarningInterval(10);
+
+        double toDouble(const vili::node& node)
+        {
+            if (node.is_integer())
+                return static_cast<double>(node.as<vili::integer>());
+            return node.as<vili::number>();
+        }
+
+        double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+        {
+            const std::chrono::duration<double, std::milli> elapsed
+                = std::chrono::steady_clock::now() - start;
+            return elapsed.count();
+        }
+    }
+
+    GarbageCollector::GarbageCollector(sol::state_view lua)
+        : m_lua(lua)
+    {
+        this->applyMode();
+        this->updateHeapThreshold();
+    }
+
+    void GarbageCollector::applyMode() const
+    {
+        lua_State* L = m_lua.lua_state();
+        if (m_mode == GarbageCollectorMode::Generational)
+        {
+            lua_gc(L, LUA_GCGEN, 0, 0);
+            lua_gc(L, LUA_GCRESTART);
+        }
+        else
+        {
+            lua_gc(L, LUA_GCINC, 0, 0, 0);
+            // Incremental steps are driven by update() only, the heap limit is
+            // what keeps the heap bounded when they can't keep up
+            if (m_mode == GarbageCollectorMode::Incremental && m_heapLimit > 0)
+                lua_gc(L, LUA_GCSTOP);
+            else
+                lua_gc(L, LUA_GCRESTART);
+        }
+    }
+
+    void GarbageCollector::fullCollection(GarbageCollectorStats& stats)
+    {
+        lua_gc(m_lua.lua_state(), LUA_GCCOLLECT);
+        stats.fullCollection = true;
+        stats.cycles++;
+        this->updateHeapThreshold();
+    }
+
+    void GarbageCollector::updateHeapThreshold()
+    {
+        // A fixed limit would force a full collection every frame once the
+        // live data outgrows it
+        m_heapThreshold = std::max(m_heapLimit, this->getHeapSize() * m_heapGrowth);
+    }
+
+    void GarbageCollector::configure(const vili::node& config)
+    {
+        if (config.contains("mode"))
+        {
+            const std::string mode = config.at("mode");
+            if (mode == "full")
+                m_mode = GarbageCollectorMode::Full;
+            else if (mode == "incremental")
+                m_mode = GarbageCollectorMode::Incremental;
+            else if (mode == "generational")
+                m_mode = GarbageCollectorMode::Generational;
+            else
+            {
+                Debug::Log->warn(
+                    "<GarbageCollector> Unknown mode '{}', using 'incremental' instead",
+                    mode);
+                m_mode = GarbageCollectorMode::Incremental;
+            }
+        }
+        if (config.contains("timeBudget"))
+            m_timeBudget = toDouble(config.at("timeBudget"));
+        if (config.contains("stepSize"))
+            m_stepSize = config.at("stepSize").as<vili::integer>();
+        if (config.contains("heapLimit"))
+            m_heapLimit = toDouble(config.at("heapLimit"));
+        if (config.contains("heapGrowth"))
+            m_heapGrowth = toDouble(config.at("heapGrowth"));
+        if (config.contains("collectOnSceneChange"))
+            m_collectOnSceneChange = config.at("collectOnSceneChange");
+        this->applyMode();
+        this->updateHeapThreshold();
+    }
+
+    void GarbageCollector::setMode(GarbageCollectorMode mode)
+    {
+        m_mode = mode;
+        this->applyMode();
+    }
+
+    GarbageCollectorMode GarbageCollector::getMode() const
+    {
+        return m_mode;
+    }
+
+    void GarbageCollector::setTimeBudget(double budget)
+    {
+        m_timeBudget = budget;
+    }
+
+    double GarbageCollector::getTimeBudget() const
+    {
+        return m_timeBudget;
+    }
+
+    void GarbageCollector::setStepSize(int size)
+    {
+        m_stepSize = size;
+    }
+
+    int GarbageCollector::getStepSize() const
+    {
+        return m_stepSize;
+    }
+
+    void GarbageCollector::setHeapLimit(double limit)
+    {
+        m_heapLimit = limit;
+        this->applyMode();
+        this->updateHeapThreshold();
+    }
+
+    double GarbageCollector::getHeapLimit() const
+    {
+        return m_heapLimit;
+    }
+
+    void GarbageCollector::setHeapGrowth(double growth)
+    {
+        m_heapGrowth = growth;
+        this->updateHeapThreshold();
+    }
+
+    double GarbageCollector::getHeapGrowth() const
+    {
+        return m_heapGrowth;
+    }
+
+    void GarbageCollector::setCollectOnSceneChange(bool collect)
+    {
+        m_collectOnSceneChange = collect;
+    }
+
+    bool GarbageCollector::getCollectOnSceneChange() const
+    {
+        return m_collectOnSceneChange;
+    }
+
+    void GarbageCollector::notifySceneChange()
+    {
+        m_sceneChanged = true;
+    }
+
+    void GarbageCollector::update()
+    {
+        GarbageCollectorStats stats;
+        const auto start = std::chrono::steady_clock::now();
+        lua_State* L = m_lua.lua_state();
+        if ((m_sceneChanged && m_collectOnSceneChange)
+            || m_mode == GarbageCollectorMode::Full)
+        {
+            this->fullCollection(stats);
+        }
+        else if (m_mode == GarbageCollectorMode::Incremental)
+        {
+            do
+            {
+                stats.steps++;
+                if (lua_gc(L, LUA_GCSTEP, m_stepSize))
+                {
+                    stats.cycles++;
+                    this->updateHeapThreshold();
+                    break;
+                }
+            } while (elapsedMilliseconds(start) < m_timeBudget);
+
+            if (m_heapLimit > 0 && this->getHeapSize() > m_heapThreshold)
+            {
+                m_forcedCollections++;
+                const auto now = std::chrono::steady_clock::now();
+                if (now - m_lastWarning >= HeapLimitWarningInterval)
+                {
+                    Debug::Log->warn("<GarbageCollector> Lua heap went over {} KB, "
+                                     "{} full collection(s) forced since last warning",
+                        m_heapThreshold, m_forcedCollections);
+                    m_forcedCollections = 0;
+                    m_lastWarning = now;
+                }
+                this->fullCollection(stats);
+            }
+        }
+        m_sceneChanged = false;
+        stats.collectionTime = elapsedMilliseconds(start);
+        stats.heapSize = this->getHeapSize();
+        m_lastFrame = stats;
+    }
+
+    void GarbageCollector::collect()
+    {
+        this->fullCollection(m_lastFrame);
+        m_lastFrame.heapSize = this->getHeapSize();
+    }
+
+    double GarbageCollector::getHeapSize() const
+    {
+        lua_State* L = m_lua.lua_state();
+        return lua_gc(L, LUA_GCCOUNT) + lua_gc(L, LUA_GCCOUNTB) / 1024.0;
+    }
+
+    const GarbageCollectorStats& GarbageCollector::getLastFrameStats() const
+    {
+        return m_lastFrame;
+    }
+} // namespace obe::Script
@@ -1,5 +1,6 @@
 #include <SFML/Window/Mouse.hpp>
 
+#include <Debug/Profiler.hpp>
 #include <Input/InputManager.hpp>
 #include <System/Cursor.hpp>
 #include <System/Window.hpp>
@@ -46,6 +47,10 @@ namespace obe::System
         m_cursorTriggers->add("Press");
         m_cursorTriggers->add("Release");
         m_cursorTriggers->add("Hold");
+        m_moveTrigger = m_cursorTriggers->getHandle("Move");
+        m_pressTrigger = m_cursorTriggers->getHandle("Press");
+        m_releaseTrigger = m_cursorTriggers->getHandle("Release");
+        m_holdTrigger = m_cursorTriggers->getHandle("Hold");
 
         m_saveOldPos = sf::Mouse::getPosition();
     }
@@ -120,16 +125,17 @@ namespace obe::System
 
     void Cursor::update()
     {
+        OBE_PROFILE_ZONE("Cursor::update");
         const sf::Vector2i mousePos = sf::Mouse::getPosition(m_window.getWindow());
         m_x = mousePos.x;
         m_y = mousePos.y;
         if (mousePos != m_saveOldPos)
         {
-            m_cursorTriggers->pushParameter("Move", "x", m_x);
-            m_cursorTriggers->pushParameter("Move", "y", m_y);
-            m_cursorTriggers->pushParameter("Move", "oldX", m_saveOldPos.x);
-            m_cursorTriggers->pushParameter("Move", "oldY", m_saveOldPos.y);
-            m_cursorTriggers->trigger("Move");
+            m_moveTrigger.pushParameter("x", m_x)
+                .pushParameter("y", m_y)
+                .pushParameter("oldX", m_saveOldPos.x)
+                .pushParameter("oldY", m_saveOldPos.y)
+                .trigger();
             m_saveOldPos = mousePos;
         }
         std::pair<int, int> constrainedPosition;
@@ -148,27 +154,24 @@ namespace obe::System
         {
             if (sf::Mouse::isButtonPressed(state.first) && state.second)
             {
-                m_cursorTriggers->pushParameter(
-                    "Hold", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Hold", "x", m_x);
-                m_cursorTriggers->pushParameter("Hold", "y", m_y);
+                m_holdTrigger.pushParameter(MouseButtonToString(state.first), true)
+                    .pushParameter("x", m_x)
+                    .pushParameter("y", m_y);
                 hold = true;
             }
             if (sf::Mouse::isButtonPressed(state.first) && !state.second)
             {
-                m_cursorTriggers->pushParameter(
-                    "Press", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Press", "x", m_x);
-                m_cursorTriggers->pushParameter("Press", "y", m_y);
+                m_pressTrigger.pushParameter(MouseButtonToString(state.first), true)
+                    .pushParameter("x", m_x)
+                    .pushParameter("y", m_y);
                 state.second = true;
                 press = true;
             }
             if (!sf::Mouse::isButtonPressed(state.first) && state.second)
             {
-                m_cursorTriggers->pushParameter(
-                    "Release", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Release", "x", m_x);
-                m_cursorTriggers->pushParameter("Release", "y", m_y);
+                m_releaseTrigger.pushParameter(MouseButtonToString(state.first), true)
+                    .pushParameter("x", m_x)
+                    .pushParameter("y", m_y);
                 state.second = false;
                 release = true;
             }
@@ -176,11 +179,11 @@ namespace obe::System
         }
 
         if (hold)
-            m_cursorTriggers->trigger("Hold");
+            m_holdTrigger.trigger();
         if (press)
-            m_cursorTriggers->trigger("Press");
+            m_pressTrigger.trigger();
         if (release)
-            m_cursorTriggers->trigger("Release");
+            m_releaseTrigger.trigger();
     }
 
     void Cursor::setConstraint(
@@ -1,5 +1,6 @@
 #include <SFML/Window/WindowStyle.hpp>
 
+#include <Debug/Logger.hpp>
 #include <System/Path.hpp>
 #include <System/Window.hpp>
 #include <Transform/UnitVector.hpp>
@@ -64,76 +65,139 @@ namespace obe::System
         std::string title = "ObEngine";
         if (configuration.contains("title"))
             m_title = configuration.at("title");
+
+        if (configuration.contains("renderer"))
+        {
+            const std::string renderer = configuration.at("renderer");
+            if (renderer == "software")
+                m_software = true;
+            else if (renderer != "opengl")
+            {
+                Debug::Log->warn(
+                    "<Window> Unknown renderer '{}', using 'opengl' instead", renderer);
+            }
+        }
+        Graphics::SoftwareRenderTarget::SetEnabled(m_software);
+
+        if (configuration.contains("renderThread"))
+            m_useRenderThread = configuration.at("renderThread");
+        if (m_useRenderThread && m_software)
+        {
+            Debug::Log->warn("<Window> The render thread can't be used with the software "
+                             "renderer, it has been disabled");
+            m_useRenderThread = false;
+        }
     }
 
     void Window::create()
     {
         Transform::UnitVector::Init(m_width, m_height);
+        if (m_software)
+        {
+            m_softwareTarget.create(m_width, m_height);
+            m_softwareOpen = true;
+            Debug::Log->info("<Window> Rendering {}x{} frames with the software renderer",
+                m_width, m_height);
+            return;
+        }
         m_window.create(sf::VideoMode(m_width, m_height), m_title, m_style);
         m_window.setKeyRepeatEnabled(false);
+        if (m_useRenderThread)
+        {
+            m_renderThread = std::make_unique<Graphics::RenderThread>(m_window);
+            m_renderThread->start();
+        }
     }
 
     void Window::clear()
     {
-        m_window.clear(m_background);
+        if (m_software)
+            m_softwareTarget.clear(m_background);
+        else if (m_renderThread)
+            m_renderThread->getFrame().clear(m_background);
+        else
+            m_window.clear(m_background);
     }
 
     void Window::close()
     {
-        m_window.close();
+        if (m_software)
+            m_softwareOpen = false;
+        else
+        {
+            // The OpenGL context has to be back on this thread before closing
+            m_renderThread.reset();
+            m_window.close();
+        }
     }
 
     void Window::display()
     {
-        m_window.display();
+        if (m_renderThread)
+            m_renderThread->submitFrame();
+        else if (!m_software)
+            m_window.display();
     }
 
     void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states)
     {
-        m_window.draw(drawable, states);
+        this->getTarget().draw(drawable, states);
     }
 
     void Window::draw(const sf::Vertex* vertices, std::size_t vertexCount,
         sf::PrimitiveType type, const sf::RenderStates& states)
     {
-        m_window.draw(vertices, vertexCount, type, states);
+        this->getTarget().draw(vertices, vertexCount, type, states);
     }
 
     Transform::UnitVector Window::getSize() const
     {
-        const sf::Vector2u windowSize = m_window.getSize();
+        const sf::Vector2u windowSize
+            = m_software ? m_softwareTarget.getSize() : m_window.getSize();
         return Transform::UnitVector(
             windowSize.x, windowSize.y, Transform::Units::ScenePixels);
     }
 
     bool Window::isOpen() const
     {
+        if (m_software)
+            return m_softwareOpen;
         return m_window.isOpen();
     }
 
     bool Window::pollEvent(sf::Event& event)
     {
+        if (m_software)
+            return false;
         return m_window.pollEvent(event);
     }
 
     void Window::setTitle(const std::string& title)
     {
         m_title = title;
-        m_window.setTitle(title);
+        if (!m_software)
+            m_window.setTitle(title);
     }
 
     void Window::setVerticalSyncEnabled(bool enabled)
     {
-        m_window.setVerticalSyncEnabled(enabled);
+        if (m_renderThread)
+            m_renderThread->setVerticalSyncEnabled(enabled);
+        else if (!m_software)
+            m_window.setVerticalSyncEnabled(enabled);
     }
 
     void Window::setView(const sf::View& view)
     {
-        m_window.setView(view);
+        this->getTarget().setView(view);
     }
 
     Graphics::RenderTarget Window::getTarget()
     {
+        if (m_software)
+            return m_softwareTarget;
+        if (m_renderThread)
+            return m_renderThread->getFrame();
         return m_window;
     }
 
@@ -142,6 +206,21 @@ namespace obe::System
         return m_window;
     }
 
+    bool Window::isSoftware() const
+    {
+        return m_software;
+    }
+
+    Graphics::SoftwareRenderTarget& Window::getSoftwareTarget()
+    {
+        return m_softwareTarget;
+    }
+
+    bool Window::isRenderThreadEnabled() const
+    {
+        return m_renderThread != nullptr;
+    }
+
     Graphics::Color Window::getClearColor() const
     {
         return m_background;
@@ -163,7 +242,10 @@ namespace obe::System
         Transform::UnitVector::Screen.h = height;
         m_width = width;
         m_height = height;
-        m_window.setSize(sf::Vector2u(width, height));
+        if (m_software)
+            m_softwareTarget.create(width, height);
+        else
+            m_window.setSize(sf::Vector2u(width, height));
         this->setView(sf::View(sf::FloatRect(0, 0, width, height)));
     }
 } // namespace obe::System
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <thread>
+
+#include <Time/FramePacer.hpp>
+
+namespace obe::Time
+{
+    namespace
+    {
+        std::chrono::steady_clock::duration toDuration(TimeUnit time)
+        {
+            return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(time));
+        }
+    }
+
+    FramePacer::FramePacer(TimeUnit interval, TimeUnit tolerance)
+        : m_interval(toDuration(interval))
+        , m_tolerance(toDuration(tolerance))
+    {
+    }
+
+    void FramePacer::advance(Clock::time_point now)
+    {
+        m_deadline += m_interval;
+        // Missed deadlines are skipped instead of rendering several frames in a row
+        if (m_deadline < now)
+            m_deadline = now + m_interval;
+    }
+
+    void FramePacer::setInterval(TimeUnit interval)
+    {
+        m_interval = toDuration(interval);
+        this->reset();
+    }
+
+    TimeUnit FramePacer::getInterval() const
+    {
+        return std::chrono::duration<double>(m_interval).count();
+    }
+
+    void FramePacer::setTolerance(TimeUnit tolerance)
+    {
+        m_tolerance = toDuration(tolerance);
+    }
+
+    TimeUnit FramePacer::getTolerance() const
+    {
+        return std::chrono::duration<double>(m_tolerance).count();
+    }
+
+    TimeUnit FramePacer::wait()
+    {
+        Clock::time_point now = Clock::now();
+        if (!m_started)
+        {
+            m_started = true;
+            m_deadline = now + m_interval;
+            return 0;
+        }
+        if (now < m_deadline - m_tolerance)
+            std::this_thread::sleep_until(m_deadline - m_tolerance);
+        while ((now = Clock::now()) < m_deadline)
+            std::this_thread::yield();
+        const std::chrono::duration<double> lateness = now - m_deadline;
+        this->advance(now);
+        return lateness.count();
+    }
+
+    bool FramePacer::poll()
+    {
+        const Clock::time_point now = Clock::now();
+        if (!m_started)
+        {
+            m_started = true;
+            m_deadline = now + m_interval;
+            return true;
+        }
+        if (now < m_deadline)
+            return false;
+        this->advance(now);
+        return true;
+    }
+
+    void FramePacer::reset()
+    {
+        m_started = false;
+    }
+} // namespace obe::Time
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Time/FrameTimeHistogram.hpp>
+
+namespace obe::Time
+{
+    FrameTimeHistogram::FrameTimeHistogram(TimeUnit bucketWidth, std::size_t bucketAmount)
+        : m_bucketWidth(bucketWidth)
+        , m_buckets(std::max<std::size_t>(bucketAmount, 1), 0)
+    {
+    }
+
+    void FrameTimeHistogram::add(TimeUnit time)
+    {
+        time = std::max(time, 0.0);
+        const auto bucket = static_cast<std::size_t>(time / m_bucketWidth);
+        m_buckets[std::min(bucket, m_buckets.size() - 1)]++;
+        if (m_count == 0 || time < m_min)
+            m_min = time;
+        if (m_count == 0 || time > m_max)
+            m_max = time;
+        m_total += time;
+        m_count++;
+    }
+
+    void FrameTimeHistogram::reset()
+    {
+        std::fill(m_buckets.begin(), m_buckets.end(), 0);
+        m_count = 0;
+        m_total = 0;
+        m_min = 0;
+        m_max = 0;
+    }
+
+    std::size_t FrameTimeHistogram::getCount() const
+    {
+        return m_count;
+    }
+
+    TimeUnit FrameTimeHistogram::getMin() const
+    {
+        return m_min;
+    }
+
+    TimeUnit FrameTimeHistogram::getMax() const
+    {
+        return m_max;
+    }
+
+    TimeUnit FrameTimeHistogram::getMean() const
+    {
+        if (m_count == 0)
+            return 0;
+        return m_total / static_cast<double>(m_count);
+    }
+
+    TimeUnit FrameTimeHistogram::getPercentile(double fraction) const
+    {
+        if (m_count == 0)
+            return 0;
+        fraction = std::clamp(fraction, 0.0, 1.0);
+        const auto rank = static_cast<std::size_t>(
+            std::max(1.0, std::ceil(fraction * static_cast<double>(m_count))));
+        std::size_t seen = 0;
+        // The last bucket has no upper bound
+        for (std::size_t i = 0; i + 1 < m_buckets.size(); i++)
+        {
+            seen += m_buckets[i];
+            if (seen >= rank)
+                return std::min(static_cast<double>(i + 1) * m_bucketWidth, m_max);
+        }
+        return m_max;
+    }
+
+    TimeUnit FrameTimeHistogram::getBucketWidth() const
+    {
+        return m_bucketWidth;
+    }
+
+    const std::vector<std::size_t>& FrameTimeHistogram::getBuckets() const
+    {
+        return m_buckets;
+    }
+} // namespace obe::Time
@@ -1,19 +1,34 @@
+#include <algorithm>
 #include <cmath>
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 #include <System/Window.hpp>
 #include <Time/FramerateManager.hpp>
-#include <thread>
 
 namespace obe::Time
 {
+    namespace
+    {
+        double toDouble(const vili::node& node)
+        {
+            if (node.is_integer())
+                return static_cast<double>(node.as<vili::integer>());
+            return node.as<vili::number>();
+        }
+    }
+
     FramerateManager::FramerateManager(System::Window& window)
-        : m_window(window)
+        : m_window(&window)
+        , m_lastFrame(preciseNow())
+        , m_pacingErrors(0.05 * milliseconds, 200)
+    {
+    }
+
+    FramerateManager::FramerateManager()
+        : m_lastFrame(preciseNow())
+        , m_pacingErrors(0.05 * milliseconds, 200)
     {
-        m_frameLimiterClock = epoch();
-        m_currentFrame = 0;
-        m_frameProgression = 0;
-        m_needToRender = false;
     }
 
     void FramerateManager::configure(vili::node& config)
@@ -31,39 +46,87 @@ namespace obe::Time
         {
             m_syncUpdateRender = config["syncUpdateToRender"];
         }
-        m_reqFramerateInterval = 1.0 / static_cast<double>(m_framerateTarget);
+        if (!config["spinTolerance"].is_null())
+        {
+            m_pacer.setTolerance(toDouble(config["spinTolerance"]) * milliseconds);
+        }
+        if (!config["fixedUpdateRate"].is_null())
+        {
+            const double rate = toDouble(config["fixedUpdateRate"]);
+            unsigned int maxUpdates = m_maxFixedUpdates;
+            if (!config["maxFixedUpdates"].is_null())
+                maxUpdates = config["maxFixedUpdates"].as<vili::integer>();
+            this->setFixedTimestep((rate > 0) ? 1.0 / rate : 0, maxUpdates);
+        }
+        m_pacer.setInterval(1.0 / static_cast<double>(m_framerateTarget));
         Debug::Log->info("Framerate parameters : {} FPS {}, V-sync {}, Update Lock {}",
             m_framerateTarget, (m_limitFramerate) ? "capped" : "uncapped",
             (m_vsyncEnabled) ? "enabled" : "disabled",
             (m_syncUpdateRender) ? "enabled" : "disabled");
 
-        m_window.setVerticalSyncEnabled(m_vsyncEnabled);
+        if (m_window)
+            m_window->setVerticalSyncEnabled(m_vsyncEnabled);
+    }
+
+    void FramerateManager::pace()
+    {
+        m_needToRender = !m_limitFramerate;
+        if (m_limitFramerate && m_syncUpdateRender)
+        {
+            m_pacingErrors.add(m_pacer.wait());
+            m_needToRender = true;
+        }
+        else if (m_limitFramerate)
+            m_needToRender = m_pacer.poll();
+    }
+
+    void FramerateManager::startFrame(const TimeUnit deltaTime)
+    {
+        const TimeUnit frameStart = now();
+        m_deltaTime = deltaTime;
+        m_lastFrame = frameStart;
+
+        if (m_needToRender)
+        {
+            if (m_rendered)
+                m_frameTimes.add(frameStart - m_lastRender);
+            m_lastRender = frameStart;
+            m_rendered = true;
+        }
+
+        if (m_fixedTimestep > 0)
+        {
+            m_accumulator += this->getGameSpeed();
+            m_fixedUpdates = 0;
+        }
     }
 
     void FramerateManager::update()
     {
-        const sf::Time timeBuffer = m_deltaClock.restart();
-        m_deltaTime = static_cast<double>(timeBuffer.asMicroseconds()) * microseconds;
-        if (m_limitFramerate)
+        OBE_PROFILE_ZONE("FramerateManager::update");
+        this->pace();
+        updateClock();
+        this->startFrame(now() - m_lastFrame);
+    }
+
+    void FramerateManager::replay(const TimeUnit deltaTime)
+    {
+        OBE_PROFILE_ZONE("FramerateManager::update");
+        this->pace();
+        advanceClock(deltaTime);
+        this->startFrame(deltaTime);
+    }
+
+    void FramerateManager::step(const TimeUnit deltaTime)
+    {
+        advanceClock(deltaTime);
+        m_lastFrame = now();
+        m_deltaTime = deltaTime;
+        m_needToRender = false;
+        if (m_fixedTimestep > 0)
         {
-            if (epoch() - m_frameLimiterClock > 1)
-            {
-                m_frameLimiterClock = epoch();
-                m_currentFrame = 0;
-            }
-            m_frameProgression
-                = round((epoch() - m_frameLimiterClock) / (m_reqFramerateInterval));
-            m_needToRender = false;
-            if (m_frameProgression > m_currentFrame)
-            {
-                m_currentFrame = m_frameProgression;
-                m_needToRender = true;
-            }
-            else
-            {
-                std::this_thread::sleep_for(
-                    std::chrono::duration<double>(m_reqFramerateInterval));
-            }
+            m_accumulator += this->getGameSpeed();
+            m_fixedUpdates = 0;
         }
     }
 
@@ -105,21 +168,88 @@ namespace obe::Time
     void FramerateManager::limitFramerate(const bool state)
     {
         m_limitFramerate = state;
+        m_pacer.reset();
     }
 
     void FramerateManager::setFramerateTarget(const unsigned int limit)
     {
         m_framerateTarget = limit;
+        m_pacer.setInterval(1.0 / static_cast<double>(m_framerateTarget));
     }
 
     void FramerateManager::setVSyncEnabled(const bool vsync)
     {
         m_vsyncEnabled = vsync;
-        m_window.setVerticalSyncEnabled(vsync);
+        if (m_window)
+            m_window->setVerticalSyncEnabled(vsync);
     }
 
     bool FramerateManager::doRender() const
     {
         return (!m_limitFramerate || m_needToRender);
     }
+
+    void FramerateManager::setPacingTolerance(const TimeUnit tolerance)
+    {
+        m_pacer.setTolerance(tolerance);
+    }
+
+    TimeUnit FramerateManager::getPacingTolerance() const
+    {
+        return m_pacer.getTolerance();
+    }
+
+    void FramerateManager::setFixedTimestep(
+        const TimeUnit timestep, const unsigned int maxUpdates)
+    {
+        m_fixedTimestep = timestep;
+        m_maxFixedUpdates = maxUpdates;
+        m_accumulator = 0;
+        m_fixedUpdates = 0;
+    }
+
+    TimeUnit FramerateManager::getFixedTimestep() const
+    {
+        return m_fixedTimestep;
+    }
+
+    bool FramerateManager::doFixedUpdate()
+    {
+        if (m_fixedTimestep <= 0 || m_accumulator < m_fixedTimestep)
+            return false;
+        if (m_maxFixedUpdates && m_fixedUpdates >= m_maxFixedUpdates)
+        {
+            Debug::Log->debug("<FramerateManager> Dropping {}s of fixed updates",
+                m_accumulator - std::fmod(m_accumulator, m_fixedTimestep));
+            m_accumulator = std::fmod(m_accumulator, m_fixedTimestep);
+            return false;
+        }
+        m_accumulator -= m_fixedTimestep;
+        m_fixedUpdates++;
+        return true;
+    }
+
+    double FramerateManager::getInterpolationAlpha() const
+    {
+        if (m_fixedTimestep <= 0)
+            return 1.0;
+        return std::min(m_accumulator / m_fixedTimestep, 1.0);
+    }
+
+    const FrameTimeHistogram& FramerateManager::getFrameTimes() const
+    {
+        return m_frameTimes;
+    }
+
+    const FrameTimeHistogram& FramerateManager::getPacingErrors() const
+    {
+        return m_pacingErrors;
+    }
+
+    void FramerateManager::resetStatistics()
+    {
+        m_frameTimes.reset();
+        m_pacingErrors.reset();
+        m_rendered = false;
+    }
 } // namespace obe::Time
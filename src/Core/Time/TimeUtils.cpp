@@ -4,6 +4,13 @@
 
 namespace obe::Time
 {
+    namespace
+    {
+        const std::chrono::steady_clock::time_point ClockStart
+            = std::chrono::steady_clock::now();
+        TimeUnit FrameTime = 0;
+    }
+
     TimeUnit epoch()
     {
         return double(std::chrono::duration_cast<std::chrono::microseconds>(
@@ -11,4 +18,26 @@ namespace obe::Time
                           .count())
             * microseconds;
     }
+
+    TimeUnit now()
+    {
+        return FrameTime;
+    }
+
+    TimeUnit preciseNow()
+    {
+        const std::chrono::duration<double> elapsed
+            = std::chrono::steady_clock::now() - ClockStart;
+        return elapsed.count();
+    }
+
+    void updateClock()
+    {
+        FrameTime = preciseNow();
+    }
+
+    void advanceClock(TimeUnit elapsed)
+    {
+        FrameTime += elapsed;
+    }
 } // namespace obe::Time
\ No newline at end of file
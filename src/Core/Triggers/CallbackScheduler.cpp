@@ -1,7 +1,25 @@
 #include <Triggers/CallbackScheduler.hpp>
+#include <Triggers/TriggerManager.hpp>
 
 namespace obe::Triggers
 {
+    CallbackHandle::CallbackHandle(std::weak_ptr<CallbackScheduler> scheduler)
+        : m_scheduler(std::move(scheduler))
+    {
+    }
+
+    void CallbackHandle::cancel()
+    {
+        if (const std::shared_ptr<CallbackScheduler> scheduler = m_scheduler.lock())
+            scheduler->stop();
+    }
+
+    bool CallbackHandle::isPending() const
+    {
+        const std::shared_ptr<CallbackScheduler> scheduler = m_scheduler.lock();
+        return scheduler && scheduler->m_state == CallbackSchedulerState::Ready;
+    }
+
     void CallbackScheduler::execute()
     {
         if (!m_repeat)
@@ -10,15 +28,11 @@ namespace obe::Triggers
         }
         else
         {
-            if (m_times > 0 && m_times == (m_currentTimes - 1))
+            m_currentTimes++;
+            if (m_times > 0 && m_currentTimes >= m_times)
             {
                 m_state = CallbackSchedulerState::Done;
             }
-            else
-            {
-                m_start = Time::epoch();
-                m_currentTimes++;
-            }
         }
         m_callback();
     }
@@ -42,21 +56,44 @@ namespace obe::Triggers
         return *this;
     }
 
+    CallbackScheduler& CallbackScheduler::afterFrames(std::uint64_t amount)
+    {
+        m_afterFrames = amount;
+        m_wait = true;
+        m_useFrames = true;
+        return *this;
+    }
+
+    CallbackScheduler& CallbackScheduler::everyFrames(std::uint64_t amount)
+    {
+        m_everyFrames = amount;
+        m_repeat = true;
+        m_useFrames = true;
+        return *this;
+    }
+
     CallbackScheduler& CallbackScheduler::repeat(unsigned amount)
     {
         m_times = amount;
         return *this;
     }
 
-    void CallbackScheduler::run(const Callback& callback)
+    CallbackHandle CallbackScheduler::run(const Callback& callback)
     {
         m_callback = callback;
         m_state = CallbackSchedulerState::Ready;
-        m_start = Time::epoch();
+        m_currentTimes = 0;
+        // Only the CallbackSchedulers owned by the TriggerManager can be scheduled
+        std::shared_ptr<CallbackScheduler> self = this->weak_from_this().lock();
+        if (!self)
+            return CallbackHandle();
+        m_triggers.start(self);
+        return CallbackHandle(self);
     }
 
     void CallbackScheduler::stop()
     {
         m_state = CallbackSchedulerState::Done;
+        m_triggers.unschedule(*this);
     }
 }
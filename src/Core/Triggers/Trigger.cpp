@@ -1,3 +1,4 @@
+#include <Debug/Profiler.hpp>
 #include <Script/GameObject.hpp>
 #include <Triggers/Exceptions.hpp>
 #include <Triggers/Trigger.hpp>
@@ -32,7 +33,7 @@ namespace obe::Triggers
 
     std::string Trigger::getTriggerLuaTableName() const
     {
-        return this->getNamespace() + "__" + this->getGroup() + "__" + m_name;
+        return m_luaTableName;
     }
 
     Trigger::Trigger(TriggerGroup& parent, const std::string& name, bool startState)
@@ -43,9 +44,10 @@ namespace obe::Triggers
         m_parent = parent;
         m_enabled = startState;
         m_fullName = this->getNamespace() + "." + this->getGroup() + "." + m_name;
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()].get_or_create<sol::table>();
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"]
-            .get_or_create<sol::table>();
+        m_luaTableName = this->getNamespace() + "__" + this->getGroup() + "__" + m_name;
+        m_profilerZone = Debug::Profiler::Intern(m_fullName);
+        m_luaTable = m_lua["__TRIGGERS"][m_luaTableName].get_or_create<sol::table>();
+        m_argTable = m_luaTable["ArgTable"].get_or_create<sol::table>();
         Debug::Log->trace(
             "<Trigger> Creating Trigger {0} @{1}", m_fullName, fmt::ptr(this));
     }
@@ -122,8 +124,29 @@ namespace obe::Triggers
 
     void Trigger::execute()
     {
+        OBE_PROFILE_ZONE(m_profilerZone);
         m_currentlyTriggered = true;
         Debug::Log->trace("<Trigger> Executing Trigger {0}", m_fullName);
+        TriggerStatistics* statistics = m_parent.m_statistics;
+        if (statistics && !statistics->isEnabled())
+            statistics = nullptr;
+        Time::TimeUnit callStart = 0;
+        if (statistics && !m_subscribers.empty())
+            callStart = Time::preciseNow();
+        for (const NativeSubscriber& subscriber : m_subscribers)
+        {
+            if (!subscriber.removed)
+                subscriber.callback(m_parameters);
+        }
+        if (statistics && !m_subscribers.empty())
+        {
+            if (!m_nativeStats)
+            {
+                m_nativeStats = &statistics->get(
+                    m_fullName, TriggerStatistics::NativeEnvironmentId);
+            }
+            TriggerStatistics::record(*m_nativeStats, Time::preciseNow() - callStart);
+        }
         for (std::size_t i = 0; i < m_registeredEnvs.size(); i++)
         {
             auto& rEnv = m_registeredEnvs[i];
@@ -136,25 +159,39 @@ namespace obe::Triggers
 
                 if (!rEnv.call)
                 {
-                    rEnv.call = makeCallback(m_lua, this->getTriggerLuaTableName(), rEnv);
+                    rEnv.call = makeCallback(m_lua, m_luaTableName, rEnv);
                 }
 
+                if (statistics)
+                    callStart = Time::preciseNow();
                 sol::protected_function_result result = rEnv.call();
+                // The callback may have registered environments, rEnv can dangle
+                TriggerEnv& calledEnv = m_registeredEnvs[i];
+                if (statistics)
+                {
+                    if (!calledEnv.stats)
+                        calledEnv.stats = &statistics->get(m_fullName, calledEnv.id);
+                    TriggerStatistics::record(
+                        *calledEnv.stats, Time::preciseNow() - callStart);
+                }
                 if (!result.valid())
                 {
                     const auto errObj = result.get<sol::error>();
                     const std::string errMsg = "\n        \""
                         + Utils::String::replace(errObj.what(), "\n", "\n        ")
                         + "\"";
-                    const std::string fullName = this->getNamespace() + "."
-                        + this->getGroup() + "." + this->getName();
                     throw Exceptions::TriggerExecutionError(
-                        fullName, rEnv.id, rEnv.callback, errMsg, EXC_INFO);
+                        m_fullName, calledEnv.id, calledEnv.callback, errMsg, EXC_INFO);
                 }
             }
         }
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"].set(
-            sol::new_table());
+        if (m_hasParameters)
+        {
+            sol::stack::clear(m_argTable);
+            m_hasParameters = false;
+        }
+        m_parameters.clear();
+        this->applySubscriberChanges();
         if (!m_envsToRemove.empty())
         {
             for (sol::environment envToRemove : m_envsToRemove)
@@ -169,12 +206,201 @@ namespace obe::Triggers
         m_currentlyTriggered = false;
     }
 
+    void Trigger::fire()
+    {
+        TriggerQueue* queue = m_parent.m_queue;
+        std::shared_ptr<Trigger> self;
+        if (m_dispatchMode != TriggerDispatchMode::Immediate && queue)
+            self = this->weak_from_this().lock();
+        if (!self)
+        {
+            this->execute();
+            return;
+        }
+        if (m_dispatchMode == TriggerDispatchMode::Queued)
+        {
+            QueuedTrigger queued { std::move(self), true, sol::table(),
+                std::move(m_parameters) };
+            m_parameters.clear();
+            if (m_hasParameters)
+            {
+                queued.arguments = std::exchange(m_argTable, this->takeSpareTable());
+                m_luaTable["ArgTable"] = m_argTable;
+                m_hasParameters = false;
+            }
+            queue->push(std::move(queued));
+            return;
+        }
+        if (m_dispatchMode == TriggerDispatchMode::CoalesceList)
+        {
+            if (m_hasParameters)
+            {
+                if (!m_accumulatedArgs.valid())
+                    m_accumulatedArgs = this->takeSpareTable();
+                for (const auto& [key, value] : m_argTable)
+                {
+                    sol::table values
+                        = m_accumulatedArgs[key].get_or_create<sol::table>();
+                    values.add(value);
+                }
+                sol::stack::clear(m_argTable);
+                m_hasParameters = false;
+            }
+            m_accumulatedParameters.accumulate(m_parameters);
+            m_parameters.clear();
+        }
+        if (m_queued)
+            queue->countCoalesced();
+        else
+        {
+            queue->push(QueuedTrigger { std::move(self) });
+            m_queued = true;
+        }
+    }
+
+    sol::table Trigger::takeSpareTable()
+    {
+        if (m_spareTables.empty())
+            return m_lua.create_table();
+        sol::table table = std::move(m_spareTables.back());
+        m_spareTables.pop_back();
+        return table;
+    }
+
+    bool Trigger::isDispatchDeferred() const
+    {
+        // Listeners registered between the fire and the drain need the parameters
+        return m_dispatchMode != TriggerDispatchMode::Immediate;
+    }
+
+    void Trigger::executeQueued(QueuedTrigger& queued)
+    {
+        if (m_queued && (m_accumulatedArgs.valid() || !m_accumulatedParameters.empty()))
+        {
+            queued.snapshot = true;
+            queued.arguments = std::exchange(m_accumulatedArgs, sol::table());
+            queued.parameters = std::move(m_accumulatedParameters);
+            m_accumulatedParameters.clear();
+        }
+        m_queued = false;
+        if (!queued.snapshot)
+        {
+            this->execute();
+            return;
+        }
+        // Parameters of the fire are swapped in for the execution only
+        const bool hadParameters = m_hasParameters;
+        const bool hasArguments = queued.arguments.valid();
+        if (hasArguments)
+        {
+            std::swap(m_argTable, queued.arguments);
+            m_luaTable["ArgTable"] = m_argTable;
+            m_hasParameters = true;
+        }
+        std::swap(m_parameters, queued.parameters);
+        this->execute();
+        std::swap(m_parameters, queued.parameters);
+        if (hasArguments)
+        {
+            std::swap(m_argTable, queued.arguments);
+            m_luaTable["ArgTable"] = m_argTable;
+            m_hasParameters = hadParameters;
+            m_spareTables.push_back(std::move(queued.arguments));
+        }
+    }
+
+    void Trigger::dropQueued()
+    {
+        m_queued = false;
+        if (m_accumulatedArgs.valid())
+        {
+            sol::stack::clear(m_accumulatedArgs);
+            m_spareTables.push_back(std::exchange(m_accumulatedArgs, sol::table()));
+        }
+        m_accumulatedParameters.clear();
+    }
+
+    void Trigger::setDispatchMode(const TriggerDispatchMode mode)
+    {
+        m_dispatchMode = mode;
+    }
+
+    TriggerDispatchMode Trigger::getDispatchMode() const
+    {
+        return m_dispatchMode;
+    }
+
     void Trigger::pushParameterFromLua(const std::string& name, sol::object parameter)
     {
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} (type: {1}) to Trigger {2} (From Lua)", name,
             static_cast<int>(parameter.get_type()), m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
+        const bool deferred = this->isDispatchDeferred();
+        if (deferred || !m_subscribers.empty())
+            m_parameters.set(name, parameter);
+        if (deferred || !m_registeredEnvs.empty())
+        {
+            m_argTable[name] = parameter;
+            m_hasParameters = true;
+        }
+    }
+
+    SubscriptionId Trigger::subscribe(NativeCallback callback)
+    {
+        Debug::Log->trace(
+            "<Trigger> Adding native subscriber to Trigger {0}", m_fullName);
+        const SubscriptionId subscription = m_nextSubscription++;
+        m_subscribersToAdd.push_back(
+            NativeSubscriber { subscription, std::move(callback) });
+        if (!m_currentlyTriggered)
+            this->applySubscriberChanges();
+        return subscription;
+    }
+
+    void Trigger::unsubscribe(const SubscriptionId subscription)
+    {
+        Debug::Log->trace(
+            "<Trigger> Removing native subscriber from Trigger {0}", m_fullName);
+        for (NativeSubscriber& subscriber : m_subscribers)
+        {
+            if (subscriber.id == subscription)
+                subscriber.removed = true;
+        }
+        m_subscribersToAdd.erase(std::remove_if(m_subscribersToAdd.begin(),
+                                     m_subscribersToAdd.end(),
+                                     [subscription](const NativeSubscriber& subscriber) {
+                                         return subscriber.id == subscription;
+                                     }),
+            m_subscribersToAdd.end());
+        m_subscribersToRemove = true;
+        if (!m_currentlyTriggered)
+            this->applySubscriberChanges();
+    }
+
+    void Trigger::applySubscriberChanges()
+    {
+        if (m_subscribersToRemove)
+        {
+            m_subscribers.erase(std::remove_if(m_subscribers.begin(), m_subscribers.end(),
+                                    [](const NativeSubscriber& subscriber) {
+                                        return subscriber.removed;
+                                    }),
+                m_subscribers.end());
+            m_subscribersToRemove = false;
+        }
+        for (NativeSubscriber& subscriber : m_subscribersToAdd)
+            m_subscribers.push_back(std::move(subscriber));
+        m_subscribersToAdd.clear();
+    }
+
+    bool Trigger::hasLuaListeners() const
+    {
+        return !m_registeredEnvs.empty();
+    }
+
+    bool Trigger::hasNativeListeners() const
+    {
+        return !m_subscribers.empty();
     }
 
     void Trigger::onRegister(std::function<void(const TriggerEnv&)> callback)
@@ -29,6 +29,17 @@ namespace obe::Triggers
             m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
     }
 
+    TriggerHandle TriggerGroup::getHandle(const std::string& triggerName)
+    {
+        if (const auto trigger = m_triggerMap.find(triggerName);
+            trigger != m_triggerMap.end())
+        {
+            return TriggerHandle(trigger->second);
+        }
+        throw Exceptions::UnknownTrigger(
+            m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
+    }
+
     TriggerGroup& TriggerGroup::add(const std::string& triggerName)
     {
         Debug::Log->debug("<TriggerGroup> Add Trigger {0} to TriggerGroup {1}.{2}",
@@ -55,7 +66,20 @@ namespace obe::Triggers
     {
         Debug::Log->trace("<TriggerGroup> Trigger {0} from TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
-        this->get(triggerName).lock()->execute();
+        if (const auto trigger = m_triggerMap.find(triggerName);
+            trigger != m_triggerMap.end())
+        {
+            trigger->second->fire();
+            return *this;
+        }
+        throw Exceptions::UnknownTrigger(
+            m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
+    }
+
+    TriggerGroup& TriggerGroup::setDispatchMode(
+        const std::string& triggerName, const TriggerDispatchMode mode)
+    {
+        this->get(triggerName).lock()->setDispatchMode(mode);
         return *this;
     }
 
@@ -75,6 +99,18 @@ namespace obe::Triggers
         this->get(triggerName).lock()->pushParameterFromLua(parameterName, parameter);
     }
 
+    SubscriptionId TriggerGroup::subscribe(
+        const std::string& triggerName, NativeCallback callback)
+    {
+        return this->get(triggerName).lock()->subscribe(std::move(callback));
+    }
+
+    void TriggerGroup::unsubscribe(
+        const std::string& triggerName, const SubscriptionId subscription)
+    {
+        this->get(triggerName).lock()->unsubscribe(subscription);
+    }
+
     std::vector<std::string> TriggerGroup::getTriggersNames()
     {
         std::vector<std::string> returnVec(m_triggerMap.size());
@@ -0,0 +1,24 @@
+#include <Triggers/TriggerHandle.hpp>
+
+namespace obe::Triggers
+{
+    TriggerHandle::TriggerHandle(std::shared_ptr<Trigger> trigger)
+        : m_trigger(std::move(trigger))
+    {
+    }
+
+    void TriggerHandle::trigger() const
+    {
+        m_trigger->fire();
+    }
+
+    Trigger* TriggerHandle::get() const
+    {
+        return m_trigger.get();
+    }
+
+    TriggerHandle::operator bool() const
+    {
+        return static_cast<bool>(m_trigger);
+    }
+} // namespace obe::Triggers
@@ -1,8 +1,24 @@
+#include <algorithm>
+
+#include <Debug/Profiler.hpp>
 #include <Triggers/Exceptions.hpp>
 #include <Triggers/TriggerManager.hpp>
 
 namespace obe::Triggers
 {
+    namespace
+    {
+        constexpr std::size_t MinimumStaleTimersToPurge = 64;
+
+        // Ordering of the heaps, callbacks due at the same time keep the order
+        // in which they were scheduled
+        constexpr auto isLater = [](const auto& first, const auto& second) {
+            if (first.due != second.due)
+                return first.due > second.due;
+            return first.order > second.order;
+        };
+    }
+
     TriggerManager::TriggerManager(sol::state_view lua)
         : m_lua(lua)
     {
@@ -59,6 +75,8 @@ namespace obe::Triggers
             {
                 TriggerGroupPtr newGroup(new TriggerGroup(m_lua, space, group),
                     [this](TriggerGroup* ptr) { this->removeTriggerGroup(ptr); });
+                newGroup->m_queue = &m_queue;
+                newGroup->m_statistics = &m_statistics;
                 m_allTriggers[space][group] = newGroup;
                 return newGroup;
             }
@@ -174,27 +192,161 @@ namespace obe::Triggers
         throw Exceptions::UnknownTriggerNamespace(space, namespaces, EXC_INFO);
     }
 
+    void TriggerManager::start(std::shared_ptr<CallbackScheduler> scheduler)
+    {
+        this->unschedule(*scheduler);
+        for (auto standby = m_standby.rbegin(); standby != m_standby.rend(); ++standby)
+        {
+            if (*standby == scheduler)
+            {
+                std::swap(*standby, m_standby.back());
+                m_standby.pop_back();
+                break;
+            }
+        }
+        this->enqueue(std::move(scheduler), true);
+    }
+
+    void TriggerManager::enqueue(std::shared_ptr<CallbackScheduler> scheduler, bool first)
+    {
+        CallbackScheduler& target = *scheduler;
+        ScheduledCallback entry {
+            0, m_order++, target.m_generation, std::move(scheduler)
+        };
+        target.m_scheduled = true;
+        if (target.m_useFrames)
+        {
+            const std::uint64_t delay
+                = (first && target.m_wait) ? target.m_afterFrames : target.m_everyFrames;
+            entry.due = static_cast<Time::TimeUnit>(m_frame + delay);
+            m_frameTimers.push_back(std::move(entry));
+            std::push_heap(m_frameTimers.begin(), m_frameTimers.end(), isLater);
+        }
+        else
+        {
+            const Time::TimeUnit delay
+                = (first && target.m_wait) ? target.m_after : target.m_every;
+            entry.due = Time::now() + delay;
+            m_timers.push_back(std::move(entry));
+            std::push_heap(m_timers.begin(), m_timers.end(), isLater);
+        }
+    }
+
+    void TriggerManager::unschedule(CallbackScheduler& scheduler)
+    {
+        // Entries of the previous generation are skipped, they stay in their
+        // heap until popped or purged
+        scheduler.m_generation++;
+        if (!scheduler.m_scheduled)
+            return;
+        scheduler.m_scheduled = false;
+        m_staleTimers++;
+        if (m_staleTimers >= MinimumStaleTimersToPurge
+            && m_staleTimers * 2 >= m_timers.size() + m_frameTimers.size())
+        {
+            this->purgeStaleTimers();
+        }
+    }
+
+    bool TriggerManager::isCurrentRun(
+        const CallbackScheduler& scheduler, const std::uint64_t generation)
+    {
+        return scheduler.m_state == CallbackSchedulerState::Ready
+            && scheduler.m_generation == generation;
+    }
+
+    void TriggerManager::popExpired(
+        std::vector<ScheduledCallback>& timers, const Time::TimeUnit until)
+    {
+        while (!timers.empty() && timers.front().due <= until)
+        {
+            std::pop_heap(timers.begin(), timers.end(), isLater);
+            ScheduledCallback entry = std::move(timers.back());
+            timers.pop_back();
+            if (entry.generation != entry.scheduler->m_generation)
+            {
+                m_staleTimers--;
+                continue;
+            }
+            entry.scheduler->m_scheduled = false;
+            m_expired.push_back(std::move(entry));
+        }
+    }
+
+    void TriggerManager::purgeStaleTimers()
+    {
+        const auto isStale = [](const ScheduledCallback& entry) {
+            return entry.generation != entry.scheduler->m_generation;
+        };
+        for (std::vector<ScheduledCallback>* timers : { &m_timers, &m_frameTimers })
+        {
+            timers->erase(
+                std::remove_if(timers->begin(), timers->end(), isStale), timers->end());
+            std::make_heap(timers->begin(), timers->end(), isLater);
+        }
+        m_staleTimers = 0;
+    }
+
     void TriggerManager::update()
     {
+        OBE_PROFILE_ZONE("TriggerManager::update");
         Debug::Log->trace("<TriggerManager> Updating TriggerManager");
-        for (auto& scheduler : m_schedulers)
+        if (!m_standby.empty())
         {
-            if (scheduler->m_state == CallbackSchedulerState::Ready)
+            m_standby.erase(std::remove_if(m_standby.begin(), m_standby.end(),
+                                [](const auto& scheduler) {
+                                    return scheduler->m_state
+                                        == CallbackSchedulerState::Done;
+                                }),
+                m_standby.end());
+        }
+        this->popExpired(m_timers, Time::now());
+        this->popExpired(m_frameTimers, static_cast<Time::TimeUnit>(m_frame));
+
+        // Callbacks scheduled by the expired ones wait for the next update
+        std::size_t index = 0;
+        try
+        {
+            for (; index < m_expired.size(); index++)
             {
-                const Time::TimeUnit elapsed = Time::epoch() - scheduler->m_start;
-                if ((scheduler->m_wait && elapsed >= scheduler->m_after)
-                    || (scheduler->m_repeat && elapsed >= scheduler->m_every))
+                // Previous callbacks may have stopped or restarted this one
+                CallbackScheduler& scheduler = *m_expired[index].scheduler;
+                if (!isCurrentRun(scheduler, m_expired[index].generation))
+                    continue;
+                scheduler.execute();
+                if (scheduler.m_state == CallbackSchedulerState::Ready
+                    && !scheduler.m_scheduled)
                 {
-                    scheduler->execute();
+                    this->enqueue(std::move(m_expired[index].scheduler), false);
                 }
             }
         }
-        m_schedulers.erase(std::remove_if(m_schedulers.begin(), m_schedulers.end(),
-                               [](auto& scheduler) {
-                                   return scheduler->m_state
-                                       == CallbackSchedulerState::Done;
-                               }),
-            m_schedulers.end());
+        catch (...)
+        {
+            // The failing callback keeps repeating unless it stopped or
+            // restarted itself, callbacks after it are called on the next update
+            ScheduledCallback& failing = m_expired[index];
+            if (isCurrentRun(*failing.scheduler, failing.generation)
+                && !failing.scheduler->m_scheduled)
+            {
+                this->enqueue(std::move(failing.scheduler), false);
+            }
+            for (index++; index < m_expired.size(); index++)
+            {
+                ScheduledCallback& entry = m_expired[index];
+                if (!isCurrentRun(*entry.scheduler, entry.generation))
+                    continue;
+                entry.scheduler->m_scheduled = true;
+                auto& timers = entry.scheduler->m_useFrames ? m_frameTimers : m_timers;
+                timers.push_back(std::move(entry));
+                std::push_heap(timers.begin(), timers.end(), isLater);
+            }
+            m_expired.clear();
+            m_frame++;
+            throw;
+        }
+        m_expired.clear();
+        m_frame++;
     }
 
     void TriggerManager::clear()
@@ -202,13 +354,53 @@ namespace obe::Triggers
         Debug::Log->debug("<TriggerManager> Clearing TriggerManager");
         m_databaseChrono.stop();
         m_allTriggers.clear();
+        m_queue.clear();
+        // Scheduled callbacks may refer to the removed Triggers, the expired
+        // ones are only cancelled as they can be the one calling clear
+        const auto cancel = [](CallbackScheduler& scheduler) {
+            scheduler.m_state = CallbackSchedulerState::Done;
+            scheduler.m_generation++;
+            scheduler.m_scheduled = false;
+        };
+        for (std::vector<ScheduledCallback>* timers :
+            { &m_timers, &m_frameTimers, &m_expired })
+        {
+            for (const ScheduledCallback& entry : *timers)
+            {
+                if (entry.scheduler)
+                    cancel(*entry.scheduler);
+            }
+        }
+        m_timers.clear();
+        m_frameTimers.clear();
+        m_staleTimers = 0;
         m_databaseChrono.start();
         // Need to delete Map-only stuff !!
     }
 
     CallbackScheduler& TriggerManager::schedule()
     {
-        m_schedulers.push_back(std::make_unique<CallbackScheduler>(*this));
-        return *m_schedulers.back().get();
+        m_standby.push_back(std::make_shared<CallbackScheduler>(*this));
+        return *m_standby.back();
+    }
+
+    std::size_t TriggerManager::getScheduledAmount() const
+    {
+        return m_timers.size() + m_frameTimers.size() - m_staleTimers;
+    }
+
+    std::uint64_t TriggerManager::getFrame() const
+    {
+        return m_frame;
+    }
+
+    TriggerQueue& TriggerManager::getQueue()
+    {
+        return m_queue;
+    }
+
+    TriggerStatistics& TriggerManager::getStatistics()
+    {
+        return m_statistics;
     }
 } // namespace obe::Triggers
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <algorithm>
+
+#include <Triggers/TriggerParameters.hpp>
+
+namespace obe::Triggers
+{
+    void TriggerParameters::accumulate(const TriggerParameters& other)
+    {
+        for (const auto& [name, value] : other.m_parameters)
+        {
+            auto parameter = std::find_if(m_parameters.begin(), m_parameters.end(),
+                [&name](const auto& parameter) { return parameter.first == name; });
+            if (parameter == m_parameters.end())
+            {
+                m_parameters.emplace_back(name, std::vector<std::any>());
+                parameter = std::prev(m_parameters.end());
+            }
+            std::any_cast<std::vector<std::any>&>(parameter->second).push_back(value);
+        }
+    }
+
+    bool TriggerParameters::contains(std::string_view name) const
+    {
+        for (const auto& [parameterName, _] : m_parameters)
+        {
+            if (parameterName == name)
+                return true;
+        }
+        return false;
+    }
+
+    std::size_t TriggerParameters::size() const
+    {
+        return m_parameters.size();
+    }
+
+    bool TriggerParameters::empty() const
+    {
+        return m_parameters.empty();
+    }
+
+    void TriggerParameters::clear()
+    {
+        m_parameters.clear();
+    }
+} // namespace obe::Triggers
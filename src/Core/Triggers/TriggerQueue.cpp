@@ -0,0 +1,80 @@
+#include <algorithm>
+
+#include <Debug/Profiler.hpp>
+#include <Triggers/Trigger.hpp>
+#include <Triggers/TriggerQueue.hpp>
+
+namespace obe::Triggers
+{
+    void TriggerQueue::push(QueuedTrigger queued)
+    {
+        m_queue.push_back(std::move(queued));
+        m_stats.fired++;
+    }
+
+    void TriggerQueue::countCoalesced()
+    {
+        m_stats.fired++;
+        m_stats.coalesced++;
+    }
+
+    std::size_t TriggerQueue::drain()
+    {
+        if (m_isDraining || m_queue.empty())
+            return 0;
+        OBE_PROFILE_ZONE("TriggerQueue::drain");
+        const Time::TimeUnit start = Time::preciseNow();
+        m_isDraining = true;
+        std::swap(m_queue, m_draining);
+        const std::size_t depth = m_draining.size();
+        std::size_t index = 0;
+        try
+        {
+            for (; index < depth; index++)
+                m_draining[index].trigger->executeQueued(m_draining[index]);
+        }
+        catch (...)
+        {
+            // Executions after the failing one are dropped
+            for (index++; index < depth; index++)
+                m_draining[index].trigger->dropQueued();
+            m_draining.clear();
+            m_isDraining = false;
+            throw;
+        }
+        m_draining.clear();
+        m_isDraining = false;
+
+        const Time::TimeUnit drainTime = Time::preciseNow() - start;
+        m_stats.executed += depth;
+        m_stats.drains++;
+        m_stats.lastDepth = depth;
+        m_stats.maxDepth = std::max(m_stats.maxDepth, depth);
+        m_stats.lastDrainTime = drainTime;
+        m_stats.maxDrainTime = std::max(m_stats.maxDrainTime, drainTime);
+        m_stats.totalDrainTime += drainTime;
+        return depth;
+    }
+
+    std::size_t TriggerQueue::getSize() const
+    {
+        return m_queue.size();
+    }
+
+    const TriggerQueueStats& TriggerQueue::getStats() const
+    {
+        return m_stats;
+    }
+
+    void TriggerQueue::resetStats()
+    {
+        m_stats = TriggerQueueStats();
+    }
+
+    void TriggerQueue::clear()
+    {
+        for (QueuedTrigger& queued : m_queue)
+            queued.trigger->dropQueued();
+        m_queue.clear();
+    }
+} // namespace obe::Triggers
@@ -0,0 +1,87 @@
+#include <algorithm>
+
+#include <Debug/Logger.hpp>
+#include <Triggers/TriggerStatistics.hpp>
+
+namespace obe::Triggers
+{
+    void TriggerStatistics::setEnabled(const bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    bool TriggerStatistics::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    TriggerCallbackStats& TriggerStatistics::get(
+        const std::string& trigger, const std::string& environment)
+    {
+        const auto [entry, inserted] = m_stats.try_emplace({ trigger, environment });
+        if (inserted)
+        {
+            entry->second.trigger = trigger;
+            entry->second.environment = environment;
+        }
+        return entry->second;
+    }
+
+    void TriggerStatistics::record(
+        TriggerCallbackStats& stats, const Time::TimeUnit elapsed)
+    {
+        stats.calls++;
+        stats.totalTime += elapsed;
+        stats.maxTime = std::max(stats.maxTime, elapsed);
+        stats.lastTime = elapsed;
+    }
+
+    std::vector<TriggerCallbackStats> TriggerStatistics::getTop(
+        const std::size_t count) const
+    {
+        std::vector<TriggerCallbackStats> top;
+        top.reserve(m_stats.size());
+        for (const auto& [_, stats] : m_stats)
+        {
+            if (stats.calls)
+                top.push_back(stats);
+        }
+        const auto byTotalTime = [](const auto& first, const auto& second) {
+            return first.totalTime > second.totalTime;
+        };
+        if (count && count < top.size())
+        {
+            std::partial_sort(top.begin(), top.begin() + count, top.end(), byTotalTime);
+            top.resize(count);
+        }
+        else
+            std::sort(top.begin(), top.end(), byTotalTime);
+        return top;
+    }
+
+    void TriggerStatistics::dump(const std::size_t count) const
+    {
+        const std::vector<TriggerCallbackStats> top = this->getTop(count);
+        Debug::Log->info("<TriggerStatistics> {} most expensive Trigger callbacks",
+            top.size());
+        for (const TriggerCallbackStats& stats : top)
+        {
+            Debug::Log->info("<TriggerStatistics>   {} ({}) : {} calls, total "
+                             "{:.3f}ms, max {:.3f}ms, last {:.3f}ms",
+                stats.trigger, stats.environment, stats.calls,
+                stats.totalTime / Time::milliseconds, stats.maxTime / Time::milliseconds,
+                stats.lastTime / Time::milliseconds);
+        }
+    }
+
+    void TriggerStatistics::reset()
+    {
+        for (auto& [_, stats] : m_stats)
+        {
+            stats.calls = 0;
+            stats.totalTime = 0;
+            stats.maxTime = 0;
+            stats.lastTime = 0;
+        }
+    }
+} // namespace obe::Triggers
@@ -24,4 +24,59 @@ namespace obe::Utils::Exec
         }
         return "";
     }
+
+    void ThreadPool::work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                if (m_stopping)
+                    return;
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+    ThreadPool::ThreadPool(unsigned int workers)
+    {
+        workers = std::max(workers, 1u);
+        m_workers.reserve(workers);
+        for (unsigned int i = 0; i < workers; i++)
+        {
+            m_workers.emplace_back(&ThreadPool::work, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+            m_tasks = {};
+        }
+        m_condition.notify_all();
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    std::size_t ThreadPool::getWorkerCount() const
+    {
+        return m_workers.size();
+    }
 } // namespace obe::Utils::Exec
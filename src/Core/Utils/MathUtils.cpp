@@ -6,7 +6,8 @@
 namespace obe::Utils::Math
 {
     std::random_device rd;
-    std::mt19937 rng { rd() };
+    unsigned int seed = rd();
+    std::mt19937 rng { seed };
 
     int randint(const int& min, const int& max)
     {
@@ -20,6 +21,17 @@ namespace obe::Utils::Math
         return dis(rng);
     }
 
+    void setSeed(const unsigned int newSeed)
+    {
+        seed = newSeed;
+        rng.seed(seed);
+    }
+
+    unsigned int getSeed()
+    {
+        return seed;
+    }
+
     bool isDoubleInt(const double& value)
     {
         return (int(value) == value);
@@ -6,9 +6,10 @@
 
 namespace obe::Modes
 {
-    void startGame()
+    void startGame(const vili::node& configOverrides)
     {
         Engine::Engine engine;
+        engine.overrideConfiguration(configOverrides);
         engine.init();
         engine.run();
     }
@@ -3,8 +3,6 @@
 #include <fstream>
 #include <iostream>
 
-#include <SFML/Window/VideoMode.hpp>
-
 #include <Config/Config.hpp>
 #include <Debug/Logger.hpp>
 #include <Exception.hpp>
@@ -18,13 +16,58 @@
 
 using namespace obe;
 
+/**
+ * \brief Converts the command line arguments to configuration values
+ *        --headless runs the game without window, --frames=N stops after N
+ *        frames and --timestep=S simulates frames of S seconds,
+ *        --record=path and --replay=path record or replay the inputs
+ */
+vili::node parseArguments(int argc, char** argv)
+{
+    vili::node overrides = vili::object {};
+    vili::node headless = vili::object {};
+    vili::node recording = vili::object {};
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        const std::size_t separator = argument.find('=');
+        const std::string name = argument.substr(0, separator);
+        const std::string value
+            = (separator == std::string::npos) ? "" : argument.substr(separator + 1);
+        try
+        {
+            if (name == "--headless")
+                headless.insert("enabled", true);
+            else if (name == "--frames")
+                headless.insert("frames", static_cast<vili::integer>(std::stoll(value)));
+            else if (name == "--timestep")
+                headless.insert("timestep", std::stod(value));
+            else if (name == "--record" || name == "--replay")
+            {
+                recording.insert("mode", name.substr(2));
+                recording.insert("path", value);
+            }
+            else
+                std::cerr << "Unknown argument '" << argument << "'" << std::endl;
+        }
+        catch (const std::logic_error&)
+        {
+            std::cerr << "Invalid value for argument '" << argument << "'" << std::endl;
+        }
+    }
+    if (!headless.empty())
+        overrides.insert("Headless", headless);
+    if (!recording.empty())
+        overrides.insert("InputRecording", recording);
+    return overrides;
+}
+
 int main(int argc, char** argv)
 {
-    const unsigned int surfaceWidth = sf::VideoMode::getDesktopMode().width;
-    const unsigned int surfaceHeight = sf::VideoMode::getDesktopMode().height;
     try
     {
-        InitEngine(surfaceWidth, surfaceHeight);
+        // The surface is set by the Engine once it knows if it runs headless
+        InitEngine();
     }
     catch (Exception& e)
     {
@@ -32,12 +75,10 @@ int main(int argc, char** argv)
         Debug::Log->error("Error occured while initializing ObEngine");
     }
 
-    Debug::Log->info("<ObEngine> Screen surface resolution {0}x{1}",
-        Transform::UnitVector::Screen.w, Transform::UnitVector::Screen.h);
     // Modes::startGame();
     try
     {
-        Modes::startGame();
+        Modes::startGame(parseArguments(argc, argv));
     }
     catch (std::exception& e)
     {
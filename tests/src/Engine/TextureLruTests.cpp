@@ -0,0 +1,101 @@
+#include <catch/catch.hpp>
+
+#include <Engine/TextureLru.hpp>
+
+using obe::Engine::TextureKey;
+using obe::Engine::TextureLru;
+
+namespace
+{
+    bool always(const TextureKey&)
+    {
+        return true;
+    }
+}
+
+TEST_CASE("Textures are ordered from the least recently used", "[obe.Engine.TextureLru]")
+{
+    TextureLru lru;
+    const TextureKey first("first.png", false);
+    const TextureKey second("second.png", false);
+    const TextureKey third("third.png", true);
+    lru.track(first, 100);
+    lru.track(second, 200);
+    lru.track(third, 300);
+    SECTION("Tracking order")
+    {
+        REQUIRE(lru.getOrder() == std::vector<TextureKey> { first, second, third });
+        REQUIRE(lru.getBytes() == 600);
+    }
+    SECTION("Touching a texture makes it the most recently used")
+    {
+        lru.touch(first);
+        REQUIRE(lru.getOrder() == std::vector<TextureKey> { second, third, first });
+    }
+    SECTION("Tracking a texture again updates its size")
+    {
+        lru.track(second, 50);
+        REQUIRE(lru.getBytes() == 450);
+        REQUIRE(lru.getOrder() == std::vector<TextureKey> { first, third, second });
+    }
+    SECTION("Released textures are no longer tracked")
+    {
+        lru.release(second);
+        REQUIRE_FALSE(lru.contains(second));
+        REQUIRE(lru.getBytes() == 400);
+        REQUIRE(lru.getOrder() == std::vector<TextureKey> { first, third });
+    }
+    SECTION("Anti-aliasing is part of the key")
+    {
+        lru.touch(TextureKey("third.png", false));
+        REQUIRE_FALSE(lru.contains(TextureKey("third.png", false)));
+        REQUIRE(lru.getOrder() == std::vector<TextureKey> { first, second, third });
+    }
+}
+
+TEST_CASE("Evictions follow the least recently used order", "[obe.Engine.TextureLru]")
+{
+    TextureLru lru;
+    const TextureKey first("first.png", false);
+    const TextureKey second("second.png", false);
+    const TextureKey third("third.png", false);
+    lru.track(first, 100);
+    lru.track(second, 200);
+    lru.track(third, 300);
+    SECTION("Nothing is evicted within the budget")
+    {
+        REQUIRE(lru.selectEvictions(600, 600, always).empty());
+        REQUIRE(lru.selectEvictions(600, 0, always).size() == 3);
+    }
+    SECTION("Least recently used textures are evicted first")
+    {
+        REQUIRE(
+            lru.selectEvictions(600, 500, always) == std::vector<TextureKey> { first });
+        REQUIRE(lru.selectEvictions(600, 350, always)
+            == std::vector<TextureKey> { first, second });
+        lru.touch(first);
+        REQUIRE(lru.selectEvictions(600, 350, always)
+            == std::vector<TextureKey> { second, third });
+    }
+    SECTION("Untracked memory counts towards the budget")
+    {
+        REQUIRE(lru.selectEvictions(1600, 1300, always)
+            == std::vector<TextureKey> { first, second });
+    }
+    SECTION("Referenced textures are never evicted")
+    {
+        const auto isEvictable = [&](const TextureKey& key) { return key != second; };
+        REQUIRE(lru.selectEvictions(600, 350, isEvictable)
+            == std::vector<TextureKey> { first, third });
+        REQUIRE(lru.selectEvictions(600, 0, isEvictable)
+            == std::vector<TextureKey> { first, third });
+        const auto nothing = [](const TextureKey&) { return false; };
+        REQUIRE(lru.selectEvictions(600, 0, nothing).empty());
+    }
+    SECTION("Selecting evictions does not modify the tracking")
+    {
+        static_cast<void>(lru.selectEvictions(600, 0, always));
+        REQUIRE(lru.getBytes() == 600);
+        REQUIRE(lru.getOrder().size() == 3);
+    }
+}
@@ -0,0 +1,61 @@
+#include <catch/catch.hpp>
+
+#include <Graphics/TextureAtlas.hpp>
+
+using obe::Graphics::SkylinePacker;
+
+TEST_CASE(
+    "Rectangles should be packed without overlapping", "[obe.Graphics.SkylinePacker]")
+{
+    SkylinePacker packer(64, 64);
+    SECTION("First rectangle goes in the top-left corner")
+    {
+        const auto position = packer.insert(16, 16);
+        REQUIRE(position.has_value());
+        REQUIRE(position->x == 0);
+        REQUIRE(position->y == 0);
+    }
+    SECTION("Rectangles are placed side by side before stacking")
+    {
+        packer.insert(32, 16);
+        const auto second = packer.insert(32, 16);
+        REQUIRE(second.has_value());
+        REQUIRE(second->x == 32);
+        REQUIRE(second->y == 0);
+        const auto third = packer.insert(64, 16);
+        REQUIRE(third.has_value());
+        REQUIRE(third->x == 0);
+        REQUIRE(third->y == 16);
+    }
+    SECTION("Full area fills up completely")
+    {
+        for (unsigned int i = 0; i < 16; i++)
+        {
+            REQUIRE(packer.insert(16, 16).has_value());
+        }
+        REQUIRE(packer.getOccupancy() == Approx(1.0));
+        REQUIRE_FALSE(packer.insert(1, 1).has_value());
+    }
+}
+
+TEST_CASE("Rectangles that can't fit should be rejected", "[obe.Graphics.SkylinePacker]")
+{
+    SkylinePacker packer(64, 64);
+    SECTION("Rectangle bigger than the area")
+    {
+        REQUIRE_FALSE(packer.insert(65, 1).has_value());
+        REQUIRE_FALSE(packer.insert(1, 65).has_value());
+    }
+    SECTION("Empty rectangle")
+    {
+        REQUIRE_FALSE(packer.insert(0, 10).has_value());
+    }
+    SECTION("Clearing frees the area")
+    {
+        REQUIRE(packer.insert(64, 64).has_value());
+        REQUIRE_FALSE(packer.insert(8, 8).has_value());
+        packer.clear();
+        REQUIRE(packer.getOccupancy() == Approx(0.0));
+        REQUIRE(packer.insert(8, 8).has_value());
+    }
+}
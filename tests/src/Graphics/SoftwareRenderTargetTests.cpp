@@ -0,0 +1,171 @@
+#include <catch/catch.hpp>
+
+#include <Graphics/SoftwareRenderTarget.hpp>
+
+using obe::Graphics::SoftwareRenderTarget;
+
+namespace
+{
+    /**
+     * \brief Vertices of an axis aligned rectangle, drawn as two triangles
+     */
+    std::vector<sf::Vertex> makeRectangle(float left, float top, float right,
+        float bottom, const sf::Color& leftColor, const sf::Color& rightColor)
+    {
+        return { sf::Vertex(sf::Vector2f(left, top), leftColor),
+            sf::Vertex(sf::Vector2f(right, top), rightColor),
+            sf::Vertex(sf::Vector2f(right, bottom), rightColor),
+            sf::Vertex(sf::Vector2f(left, bottom), leftColor) };
+    }
+
+    sf::Color getPixel(const SoftwareRenderTarget& target, unsigned int x, unsigned int y)
+    {
+        const std::size_t index
+            = (static_cast<std::size_t>(y) * target.getSize().x + x) * 4;
+        const std::vector<std::uint8_t>& pixels = target.getPixels();
+        return sf::Color(
+            pixels[index], pixels[index + 1], pixels[index + 2], pixels[index + 3]);
+    }
+
+    sf::Color blendOnto(const sf::Color& destination, const sf::Color& source,
+        const sf::BlendMode& mode)
+    {
+        SoftwareRenderTarget target(1, 1);
+        target.clear(destination);
+        const std::vector<sf::Vertex> rectangle
+            = makeRectangle(0, 0, 1, 1, source, source);
+        target.draw(rectangle.data(), rectangle.size(), sf::Quads, mode);
+        return getPixel(target, 0, 0);
+    }
+}
+
+TEST_CASE("Triangles should cover the pixels whose center is inside",
+    "[obe.Graphics.SoftwareRenderTarget]")
+{
+    SoftwareRenderTarget target(4, 4);
+    target.clear(sf::Color::Black);
+    SECTION("A rectangle fills exactly its pixels")
+    {
+        const std::vector<sf::Vertex> rectangle
+            = makeRectangle(1, 1, 3, 4, sf::Color::White, sf::Color::White);
+        target.draw(rectangle.data(), rectangle.size(), sf::Quads, sf::BlendNone);
+        for (unsigned int y = 0; y < 4; y++)
+        {
+            for (unsigned int x = 0; x < 4; x++)
+            {
+                const bool inside = x >= 1 && x < 3 && y >= 1;
+                REQUIRE(getPixel(target, x, y)
+                    == (inside ? sf::Color::White : sf::Color::Black));
+            }
+        }
+        REQUIRE(target.getDrawCalls() == 1);
+    }
+    SECTION("Pixels on the edge shared by two triangles are drawn once")
+    {
+        const sf::Color red(100, 0, 0);
+        const std::vector<sf::Vertex> rectangle = makeRectangle(0, 0, 4, 4, red, red);
+        target.draw(rectangle.data(), rectangle.size(), sf::Quads, sf::BlendAdd);
+        for (unsigned int i = 0; i < 4; i++)
+            REQUIRE(getPixel(target, i, i) == red);
+    }
+    SECTION("Triangles wound both ways are drawn")
+    {
+        const sf::Vertex clockwise[] = { sf::Vertex(sf::Vector2f(0, 0)),
+            sf::Vertex(sf::Vector2f(4, 0)), sf::Vertex(sf::Vector2f(0, 4)) };
+        const sf::Vertex counterClockwise[]
+            = { clockwise[0], clockwise[2], clockwise[1] };
+        target.draw(clockwise, 3, sf::Triangles, sf::BlendNone);
+        const sf::Image clockwiseImage = target.copyToImage();
+        target.clear(sf::Color::Black);
+        target.draw(counterClockwise, 3, sf::Triangles, sf::BlendNone);
+        REQUIRE(target.compare(clockwiseImage) == 0);
+        REQUIRE(getPixel(target, 0, 0) == sf::Color::White);
+        REQUIRE(getPixel(target, 3, 3) == sf::Color::Black);
+    }
+    SECTION("The view maps the scene to the framebuffer")
+    {
+        target.setView(sf::View(sf::FloatRect(0, 0, 2, 2)));
+        const std::vector<sf::Vertex> rectangle
+            = makeRectangle(1, 1, 2, 2, sf::Color::White, sf::Color::White);
+        target.draw(rectangle.data(), rectangle.size(), sf::Quads, sf::BlendNone);
+        REQUIRE(getPixel(target, 1, 1) == sf::Color::Black);
+        REQUIRE(getPixel(target, 2, 2) == sf::Color::White);
+        REQUIRE(getPixel(target, 3, 3) == sf::Color::White);
+    }
+}
+
+TEST_CASE("Vertex colors should be interpolated across triangles",
+    "[obe.Graphics.SoftwareRenderTarget]")
+{
+    SoftwareRenderTarget target(4, 1);
+    target.clear(sf::Color::Black);
+    const std::vector<sf::Vertex> gradient = makeRectangle(
+        0, 0, 4, 1, sf::Color(0, 0, 0, 255), sf::Color(255, 0, 255, 255));
+    target.draw(gradient.data(), gradient.size(), sf::Quads, sf::BlendNone);
+    // Colors are sampled at the pixel centers (1/8, 3/8, 5/8 and 7/8)
+    const sf::Uint8 expected[] = { 32, 96, 159, 223 };
+    for (unsigned int x = 0; x < 4; x++)
+    {
+        const sf::Color pixel = getPixel(target, x, 0);
+        REQUIRE(pixel.r == Approx(expected[x]).margin(1));
+        REQUIRE(pixel.g == 0);
+        REQUIRE(pixel.b == pixel.r);
+        REQUIRE(pixel.a == 255);
+    }
+}
+
+TEST_CASE("Blend modes should follow the OpenGL blend equations",
+    "[obe.Graphics.SoftwareRenderTarget]")
+{
+    const sf::Color destination(100, 50, 200, 255);
+    const sf::Color source(200, 100, 0, 128);
+    SECTION("BlendAlpha")
+    {
+        REQUIRE(blendOnto(destination, source, sf::BlendAlpha)
+            == sf::Color(150, 75, 100, 255));
+    }
+    SECTION("BlendAdd")
+    {
+        REQUIRE(blendOnto(destination, source, sf::BlendAdd)
+            == sf::Color(200, 100, 200, 255));
+    }
+    SECTION("BlendMultiply")
+    {
+        REQUIRE(blendOnto(destination, source, sf::BlendMultiply)
+            == sf::Color(78, 20, 0, 128));
+    }
+    SECTION("BlendNone")
+    {
+        REQUIRE(blendOnto(destination, source, sf::BlendNone) == source);
+    }
+    SECTION("Subtractions are clamped")
+    {
+        const sf::BlendMode reverseSubtract(
+            sf::BlendMode::One, sf::BlendMode::One, sf::BlendMode::ReverseSubtract);
+        REQUIRE(blendOnto(destination, source, reverseSubtract)
+            == sf::Color(0, 0, 200, 127));
+        const sf::BlendMode subtract(
+            sf::BlendMode::One, sf::BlendMode::One, sf::BlendMode::Subtract);
+        REQUIRE(blendOnto(destination, source, subtract) == sf::Color(100, 50, 0, 0));
+    }
+}
+
+TEST_CASE("Framebuffers should be compared to reference images with a tolerance",
+    "[obe.Graphics.SoftwareRenderTarget]")
+{
+    SoftwareRenderTarget target(3, 2);
+    target.clear(sf::Color(10, 20, 30, 255));
+    sf::Image reference;
+    reference.create(3, 2, sf::Color(10, 20, 30, 255));
+    REQUIRE(target.compare(reference) == 0);
+
+    reference.setPixel(1, 0, sf::Color(13, 20, 30, 255));
+    reference.setPixel(2, 1, sf::Color(10, 20, 30, 250));
+    REQUIRE(target.compare(reference) == 2);
+    REQUIRE(target.compare(reference, 3) == 1);
+    REQUIRE(target.compare(reference, 5) == 0);
+
+    sf::Image smaller;
+    smaller.create(2, 2, sf::Color(10, 20, 30, 255));
+    REQUIRE(target.compare(smaller, 255) == 6);
+}
@@ -0,0 +1,50 @@
+#include <catch/catch.hpp>
+
+#include <Time/FrameTimeHistogram.hpp>
+
+using obe::Time::FrameTimeHistogram;
+using obe::Time::milliseconds;
+
+TEST_CASE("Frame times should be summarized", "[obe.Time.FrameTimeHistogram]")
+{
+    FrameTimeHistogram histogram(1 * milliseconds, 100);
+    SECTION("Empty histogram")
+    {
+        REQUIRE(histogram.getCount() == 0);
+        REQUIRE(histogram.getMean() == 0);
+        REQUIRE(histogram.getPercentile(0.99) == 0);
+    }
+    SECTION("Min, max and mean")
+    {
+        histogram.add(10 * milliseconds);
+        histogram.add(20 * milliseconds);
+        histogram.add(30 * milliseconds);
+        REQUIRE(histogram.getCount() == 3);
+        REQUIRE(histogram.getMin() == Approx(10 * milliseconds));
+        REQUIRE(histogram.getMax() == Approx(30 * milliseconds));
+        REQUIRE(histogram.getMean() == Approx(20 * milliseconds));
+    }
+    SECTION("Percentiles are rounded up to the end of their bucket")
+    {
+        for (int i = 0; i < 99; i++)
+            histogram.add(16.2 * milliseconds);
+        histogram.add(50.5 * milliseconds);
+        REQUIRE(histogram.getBuckets()[16] == 99);
+        REQUIRE(histogram.getPercentile(0.5) == Approx(17 * milliseconds));
+        REQUIRE(histogram.getPercentile(0.99) == Approx(17 * milliseconds));
+        REQUIRE(histogram.getPercentile(1) == Approx(50.5 * milliseconds));
+    }
+    SECTION("Times out of range go in the last bucket")
+    {
+        histogram.add(2);
+        REQUIRE(histogram.getBuckets().back() == 1);
+        REQUIRE(histogram.getPercentile(1) == Approx(2));
+    }
+    SECTION("Reset removes all frame times")
+    {
+        histogram.add(5 * milliseconds);
+        histogram.reset();
+        REQUIRE(histogram.getCount() == 0);
+        REQUIRE(histogram.getBuckets()[5] == 0);
+    }
+}
@@ -0,0 +1,193 @@
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Debug/Logger.hpp>
+#include <Time/TimeUtils.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe::Triggers;
+
+namespace
+{
+    struct SchedulerFixture
+    {
+        sol::state lua;
+        std::unique_ptr<TriggerManager> manager;
+
+        SchedulerFixture()
+        {
+            if (!obe::Debug::Log)
+                obe::Debug::InitLogger();
+            manager = std::make_unique<TriggerManager>(lua);
+        }
+
+        void advance(obe::Time::TimeUnit elapsed)
+        {
+            obe::Time::advanceClock(elapsed);
+            manager->update();
+        }
+    };
+}
+
+TEST_CASE("Scheduled callbacks should be called in the order of their due time",
+    "[obe.Triggers.CallbackScheduler]")
+{
+    SchedulerFixture fixture;
+    std::string calls;
+    SECTION("Earlier due times are called first")
+    {
+        fixture.manager->schedule().after(3).run([&calls]() { calls += "C"; });
+        fixture.manager->schedule().after(1).run([&calls]() { calls += "A"; });
+        fixture.manager->schedule().after(2).run([&calls]() { calls += "B"; });
+        fixture.advance(1.5);
+        REQUIRE(calls == "A");
+        fixture.advance(2);
+        REQUIRE(calls == "ABC");
+        REQUIRE(fixture.manager->getScheduledAmount() == 0);
+    }
+    SECTION("Callbacks due at the same time are called in scheduling order")
+    {
+        for (const char name : std::string("ABCDEFGH"))
+            fixture.manager->schedule().after(1).run([&calls, name]() { calls += name; });
+        fixture.advance(1);
+        REQUIRE(calls == "ABCDEFGH");
+    }
+    SECTION("Callbacks scheduled by a callback wait for the next update")
+    {
+        fixture.manager->schedule().run([&]() {
+            calls += "A";
+            fixture.manager->schedule().run([&calls]() { calls += "B"; });
+        });
+        fixture.advance(0);
+        REQUIRE(calls == "A");
+        fixture.advance(0);
+        REQUIRE(calls == "AB");
+    }
+}
+
+TEST_CASE("Stopped callbacks should never be called",
+    "[obe.Triggers.CallbackScheduler]")
+{
+    SchedulerFixture fixture;
+    int calls = 0;
+    SECTION("A cancelled handle is not pending anymore")
+    {
+        CallbackHandle handle
+            = fixture.manager->schedule().after(1).run([&calls]() { calls++; });
+        REQUIRE(handle.isPending());
+        handle.cancel();
+        REQUIRE_FALSE(handle.isPending());
+        REQUIRE(fixture.manager->getScheduledAmount() == 0);
+        fixture.advance(2);
+        REQUIRE(calls == 0);
+    }
+    SECTION("Restarting a callback invalidates its previous run")
+    {
+        CallbackScheduler& scheduler = fixture.manager->schedule().after(1);
+        scheduler.run([&calls]() { calls++; });
+        fixture.advance(0.5);
+        scheduler.run([&calls]() { calls += 10; });
+        REQUIRE(fixture.manager->getScheduledAmount() == 1);
+        fixture.advance(0.75);
+        REQUIRE(calls == 0);
+        fixture.advance(0.5);
+        REQUIRE(calls == 10);
+    }
+    SECTION("A callback can stop the ones due after it")
+    {
+        CallbackHandle second;
+        fixture.manager->schedule().after(1).run([&second]() { second.cancel(); });
+        second = fixture.manager->schedule().after(1).run([&calls]() { calls++; });
+        fixture.advance(1);
+        REQUIRE(calls == 0);
+    }
+    SECTION("Stale entries are purged")
+    {
+        std::vector<CallbackHandle> handles;
+        for (int i = 0; i < 200; i++)
+            handles.push_back(
+                fixture.manager->schedule().after(1).run([&calls]() { calls++; }));
+        for (std::size_t i = 1; i < handles.size(); i++)
+            handles[i].cancel();
+        REQUIRE(fixture.manager->getScheduledAmount() == 1);
+
+        CallbackScheduler& restarted = fixture.manager->schedule().after(1);
+        for (int i = 0; i < 200; i++)
+            restarted.run([&calls]() { calls += 10; });
+        REQUIRE(fixture.manager->getScheduledAmount() == 2);
+        fixture.advance(1);
+        REQUIRE(calls == 11);
+        REQUIRE(fixture.manager->getScheduledAmount() == 0);
+    }
+    SECTION("Clearing the TriggerManager cancels the scheduled callbacks")
+    {
+        CallbackHandle handle
+            = fixture.manager->schedule().every(1).run([&calls]() { calls++; });
+        fixture.manager->schedule().afterFrames(1).run([&calls]() { calls++; });
+        fixture.manager->clear();
+        REQUIRE_FALSE(handle.isPending());
+        REQUIRE(fixture.manager->getScheduledAmount() == 0);
+        fixture.advance(2);
+        REQUIRE(calls == 0);
+    }
+}
+
+TEST_CASE("Repeated callbacks should be called the requested amount of times",
+    "[obe.Triggers.CallbackScheduler]")
+{
+    SchedulerFixture fixture;
+    int calls = 0;
+    SECTION("repeat(n) calls the callback n times in total")
+    {
+        CallbackHandle handle
+            = fixture.manager->schedule().every(1).repeat(3).run([&calls]() { calls++; });
+        for (int update = 1; update <= 5; update++)
+        {
+            fixture.advance(1);
+            REQUIRE(calls == std::min(update, 3));
+        }
+        REQUIRE_FALSE(handle.isPending());
+    }
+    SECTION("A failing repeated callback keeps being called")
+    {
+        CallbackHandle handle = fixture.manager->schedule().every(1).run([&calls]() {
+            if (++calls == 1)
+                throw std::runtime_error("failure");
+        });
+        REQUIRE_THROWS_AS(fixture.advance(1), std::runtime_error);
+        REQUIRE(handle.isPending());
+        REQUIRE(fixture.manager->getScheduledAmount() == 1);
+        fixture.advance(1);
+        REQUIRE(calls == 2);
+    }
+}
+
+TEST_CASE("Callbacks waiting in frames should count the updates",
+    "[obe.Triggers.CallbackScheduler]")
+{
+    SchedulerFixture fixture;
+    std::vector<std::uint64_t> frames;
+    const auto record = [&frames, &fixture]() {
+        frames.push_back(fixture.manager->getFrame());
+    };
+    SECTION("afterFrames waits the given amount of updates")
+    {
+        fixture.manager->schedule().afterFrames(2).run(record);
+        fixture.advance(0);
+        fixture.advance(0);
+        REQUIRE(frames.empty());
+        fixture.advance(0);
+        REQUIRE(frames == std::vector<std::uint64_t> { 2 });
+    }
+    SECTION("everyFrames ignores the elapsed time")
+    {
+        fixture.manager->schedule().everyFrames(2).repeat(3).run(record);
+        for (int update = 0; update < 8; update++)
+            fixture.advance(update % 2 ? 10 : 0);
+        REQUIRE(frames == std::vector<std::uint64_t> { 2, 4, 6 });
+    }
+}
@@ -0,0 +1,44 @@
+#include <catch/catch.hpp>
+
+#include <Triggers/TriggerParameters.hpp>
+
+using obe::Triggers::TriggerParameters;
+
+TEST_CASE("Trigger parameters should keep their C++ type",
+    "[obe.Triggers.TriggerParameters]")
+{
+    TriggerParameters parameters;
+    SECTION("Empty parameters")
+    {
+        REQUIRE(parameters.empty());
+        REQUIRE_FALSE(parameters.contains("dt"));
+        REQUIRE(parameters.find<double>("dt") == nullptr);
+    }
+    SECTION("Typed access")
+    {
+        parameters.set("dt", 0.016);
+        parameters.set("x", 12);
+        REQUIRE(parameters.size() == 2);
+        REQUIRE(parameters.get<double>("dt") == Approx(0.016));
+        REQUIRE(parameters.get<int>("x") == 12);
+        REQUIRE(parameters.find<int>("dt") == nullptr);
+    }
+    SECTION("C strings are stored as std::string")
+    {
+        parameters.set("name", "level1");
+        REQUIRE(parameters.get<std::string>("name") == "level1");
+    }
+    SECTION("Setting a parameter twice replaces it")
+    {
+        parameters.set("state", 1);
+        parameters.set("state", 2);
+        REQUIRE(parameters.size() == 1);
+        REQUIRE(parameters.get<int>("state") == 2);
+    }
+    SECTION("Clear")
+    {
+        parameters.set("dt", 0.016);
+        parameters.clear();
+        REQUIRE(parameters.empty());
+    }
+}
@@ -0,0 +1,249 @@
+#include <catch/catch.hpp>
+
+#include <any>
+#include <set>
+#include <vector>
+
+#include <Debug/Logger.hpp>
+#include <Triggers/Exceptions.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe::Triggers;
+
+namespace
+{
+    /**
+     * \brief TriggerManager with a "Test.Events" group, Lua callbacks receive
+     *        the ArgTable of their Trigger as only argument
+     */
+    struct QueueFixture
+    {
+        sol::state lua;
+        std::unique_ptr<TriggerManager> manager;
+        TriggerGroupPtr group;
+        std::vector<sol::environment> environments;
+        bool active = true;
+
+        QueueFixture()
+        {
+            if (!obe::Debug::Log)
+                obe::Debug::InitLogger();
+            lua.open_libraries();
+            lua["__TRIGGERS"] = lua.create_table();
+            // _ENV has to stay the first upvalue of the callback
+            lua.script("LuaCore = { MakeCallback = function(trigger, callback)"
+                       "    return function()"
+                       "        local args = _G.__TRIGGERS[trigger].ArgTable"
+                       "        return callback(args)"
+                       "    end "
+                       "end }");
+            lua["received"] = lua.create_table();
+            manager = std::make_unique<TriggerManager>(lua);
+            manager->createNamespace("Test");
+            group = manager->createTriggerGroup("Test", "Events");
+        }
+
+        Trigger& add(const std::string& name, TriggerDispatchMode mode)
+        {
+            group->add(name).setDispatchMode(name, mode);
+            return *group->get(name).lock();
+        }
+
+        void listen(Trigger& trigger, const std::string& source)
+        {
+            sol::environment environment(lua, sol::create, lua.globals());
+            lua.script(source, environment);
+            trigger.registerEnvironment(
+                std::to_string(environments.size()), environment, "callback", &active);
+            environments.push_back(environment);
+        }
+
+        std::vector<int> getReceived()
+        {
+            return lua["received"].get<std::vector<int>>();
+        }
+    };
+
+    const std::string StoreValue
+        = "function callback(args) table.insert(received, args.value or -1) end";
+}
+
+TEST_CASE("Queued Triggers should run when the queue is drained",
+    "[obe.Triggers.TriggerQueue]")
+{
+    QueueFixture fixture;
+    TriggerQueue& queue = fixture.manager->getQueue();
+    std::vector<int> values;
+    SECTION("Queued fires keep their own parameters")
+    {
+        Trigger& trigger = fixture.add("Fired", TriggerDispatchMode::Queued);
+        fixture.group->subscribe("Fired", [&values](const TriggerParameters& parameters) {
+            values.push_back(parameters.get<int>("value"));
+        });
+        fixture.listen(trigger, StoreValue);
+        fixture.group->pushParameter("Fired", "value", 1);
+        fixture.group->trigger("Fired");
+        fixture.group->pushParameter("Fired", "value", 2);
+        fixture.group->trigger("Fired");
+        REQUIRE(values.empty());
+        REQUIRE(queue.getSize() == 2);
+        REQUIRE(queue.drain() == 2);
+        REQUIRE(values == std::vector<int> { 1, 2 });
+        REQUIRE(fixture.getReceived() == std::vector<int> { 1, 2 });
+        REQUIRE(queue.getSize() == 0);
+    }
+    SECTION("CoalesceLast merges the fires, the last value wins")
+    {
+        Trigger& trigger = fixture.add("Fired", TriggerDispatchMode::CoalesceLast);
+        fixture.group->subscribe("Fired", [&values](const TriggerParameters& parameters) {
+            values.push_back(parameters.get<int>("value"));
+        });
+        fixture.listen(trigger, StoreValue);
+        for (int value = 1; value <= 3; value++)
+        {
+            fixture.group->pushParameter("Fired", "value", value);
+            fixture.group->trigger("Fired");
+        }
+        REQUIRE(queue.getSize() == 1);
+        REQUIRE(queue.getStats().coalesced == 2);
+        queue.drain();
+        REQUIRE(values == std::vector<int> { 3 });
+        REQUIRE(fixture.getReceived() == std::vector<int> { 3 });
+    }
+    SECTION("CoalesceList turns each parameter into the list of its values")
+    {
+        Trigger& trigger = fixture.add("Fired", TriggerDispatchMode::CoalesceList);
+        fixture.group->subscribe("Fired", [&values](const TriggerParameters& parameters) {
+            for (const std::any& value :
+                parameters.get<std::vector<std::any>>("value"))
+                values.push_back(std::any_cast<int>(value));
+        });
+        fixture.listen(trigger,
+            "function callback(args) "
+            "    for _, value in ipairs(args.value) do table.insert(received, value) end "
+            "end");
+        for (int value = 1; value <= 3; value++)
+        {
+            fixture.group->pushParameter("Fired", "value", value);
+            fixture.group->trigger("Fired");
+        }
+        REQUIRE(queue.getSize() == 1);
+        queue.drain();
+        REQUIRE(values == std::vector<int> { 1, 2, 3 });
+        REQUIRE(fixture.getReceived() == std::vector<int> { 1, 2, 3 });
+
+        // The accumulated values do not leak into the next drain
+        values.clear();
+        fixture.group->pushParameter("Fired", "value", 4);
+        fixture.group->trigger("Fired");
+        queue.drain();
+        REQUIRE(values == std::vector<int> { 4 });
+    }
+    SECTION("Listeners added between the fire and the drain get the parameters")
+    {
+        Trigger& trigger = fixture.add("Fired", TriggerDispatchMode::Queued);
+        fixture.group->pushParameter("Fired", "value", 5);
+        fixture.group->trigger("Fired");
+        fixture.group->subscribe("Fired", [&values](const TriggerParameters& parameters) {
+            values.push_back(parameters.get<int>("value"));
+        });
+        fixture.listen(trigger, StoreValue);
+        queue.drain();
+        REQUIRE(values == std::vector<int> { 5 });
+        REQUIRE(fixture.getReceived() == std::vector<int> { 5 });
+    }
+}
+
+TEST_CASE("Snapshots of queued fires should reuse their tables",
+    "[obe.Triggers.TriggerQueue]")
+{
+    QueueFixture fixture;
+    TriggerQueue& queue = fixture.manager->getQueue();
+    Trigger& trigger = fixture.add("Fired", TriggerDispatchMode::Queued);
+    fixture.listen(trigger, StoreValue);
+    const sol::table triggerTable
+        = fixture.lua["__TRIGGERS"][trigger.getTriggerLuaTableName()];
+    const auto fireTwice = [&fixture, &triggerTable]() {
+        std::set<const void*> tables;
+        for (int value = 1; value <= 2; value++)
+        {
+            tables.insert(triggerTable["ArgTable"].get<sol::table>().pointer());
+            fixture.group->pushParameter("Fired", "value", value);
+            fixture.group->trigger("Fired");
+        }
+        tables.insert(triggerTable["ArgTable"].get<sol::table>().pointer());
+        return tables;
+    };
+
+    const std::set<const void*> firstTables = fireTwice();
+    queue.drain();
+    const std::set<const void*> secondTables = fireTwice();
+    queue.drain();
+    REQUIRE(firstTables.size() == 3);
+    REQUIRE(secondTables == firstTables);
+
+    // Reused tables are empty, a fire without parameters gets no stale value
+    fixture.group->trigger("Fired");
+    queue.drain();
+    REQUIRE(fixture.getReceived() == std::vector<int> { 1, 2, 1, 2, -1 });
+}
+
+TEST_CASE("A failing queued execution should drop the following ones",
+    "[obe.Triggers.TriggerQueue]")
+{
+    QueueFixture fixture;
+    TriggerQueue& queue = fixture.manager->getQueue();
+    Trigger& failing = fixture.add("Failing", TriggerDispatchMode::Queued);
+    fixture.listen(failing, "function callback() error('failure') end");
+    fixture.add("Next", TriggerDispatchMode::CoalesceList);
+    std::size_t calls = 0;
+    fixture.group->subscribe("Next", [&calls](const TriggerParameters&) { calls++; });
+
+    fixture.group->trigger("Failing");
+    fixture.group->pushParameter("Next", "value", 1);
+    fixture.group->trigger("Next");
+    REQUIRE_THROWS_AS(queue.drain(), obe::Triggers::Exceptions::TriggerExecutionError);
+    REQUIRE(calls == 0);
+    REQUIRE(queue.getSize() == 0);
+    REQUIRE(queue.drain() == 0);
+
+    // The dropped Trigger can be queued again, without the dropped values
+    std::vector<int> values;
+    fixture.group->subscribe("Next", [&values](const TriggerParameters& parameters) {
+        for (const std::any& value : parameters.get<std::vector<std::any>>("value"))
+            values.push_back(std::any_cast<int>(value));
+    });
+    fixture.group->pushParameter("Next", "value", 2);
+    fixture.group->trigger("Next");
+    REQUIRE(queue.getSize() == 1);
+    queue.drain();
+    REQUIRE(calls == 1);
+    REQUIRE(values == std::vector<int> { 2 });
+}
+
+TEST_CASE("Fires made while draining should wait for the next drain",
+    "[obe.Triggers.TriggerQueue]")
+{
+    QueueFixture fixture;
+    TriggerQueue& queue = fixture.manager->getQueue();
+    fixture.add("First", TriggerDispatchMode::Queued);
+    fixture.add("Second", TriggerDispatchMode::Queued);
+    std::vector<std::string> executions;
+    std::size_t nestedDrain = 1;
+    fixture.group->subscribe("First", [&](const TriggerParameters&) {
+        executions.push_back("First");
+        fixture.group->trigger("Second");
+        nestedDrain = queue.drain();
+    });
+    fixture.group->subscribe("Second", [&executions](const TriggerParameters&) {
+        executions.push_back("Second");
+    });
+
+    fixture.group->trigger("First");
+    REQUIRE(queue.drain() == 1);
+    REQUIRE(nestedDrain == 0);
+    REQUIRE(executions == std::vector<std::string> { "First" });
+    REQUIRE(queue.getSize() == 1);
+    REQUIRE(queue.drain() == 1);
+    REQUIRE(executions == std::vector<std::string> { "First", "Second" });
+}
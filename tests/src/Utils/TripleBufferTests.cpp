@@ -0,0 +1,101 @@
+#include <catch/catch.hpp>
+
+#include <array>
+#include <thread>
+
+#include <Utils/ExecUtils.hpp>
+
+using obe::Utils::Exec::TripleBuffer;
+
+namespace
+{
+    struct Frame
+    {
+        int sequence = 0;
+        std::array<int, 64> payload {};
+    };
+}
+
+TEST_CASE("Published buffers should be acquired by the consumer",
+    "[obe.Utils.Exec.TripleBuffer]")
+{
+    TripleBuffer<int> buffer;
+    SECTION("Nothing to acquire before the first publish")
+    {
+        REQUIRE_FALSE(buffer.acquire());
+    }
+    SECTION("The published value is acquired once")
+    {
+        buffer.getWriteBuffer() = 1;
+        REQUIRE(buffer.publish());
+        REQUIRE(buffer.acquire());
+        REQUIRE(buffer.getReadBuffer() == 1);
+        REQUIRE_FALSE(buffer.acquire());
+        REQUIRE(buffer.getReadBuffer() == 1);
+    }
+    SECTION("An unacquired buffer is replaced by a newer one")
+    {
+        buffer.getWriteBuffer() = 1;
+        REQUIRE(buffer.publish());
+        buffer.getWriteBuffer() = 2;
+        REQUIRE_FALSE(buffer.publish());
+        REQUIRE(buffer.acquire());
+        REQUIRE(buffer.getReadBuffer() == 2);
+    }
+    SECTION("The producer never writes in the buffer being read")
+    {
+        buffer.getWriteBuffer() = 1;
+        buffer.publish();
+        buffer.acquire();
+        for (int i = 2; i < 10; i++)
+        {
+            REQUIRE(&buffer.getWriteBuffer() != &buffer.getReadBuffer());
+            buffer.getWriteBuffer() = i;
+            buffer.publish();
+        }
+        REQUIRE(buffer.getReadBuffer() == 1);
+    }
+}
+
+TEST_CASE("Buffers exchanged between threads should never be torn",
+    "[obe.Utils.Exec.TripleBuffer]")
+{
+    constexpr int frameAmount = 100000;
+    TripleBuffer<Frame> buffer;
+    int dropped = 0;
+    std::thread producer([&buffer, &dropped]() {
+        for (int sequence = 1; sequence <= frameAmount; sequence++)
+        {
+            Frame& frame = buffer.getWriteBuffer();
+            frame.sequence = sequence;
+            frame.payload.fill(sequence);
+            if (!buffer.publish())
+                dropped++;
+        }
+    });
+
+    int acquired = 0;
+    int lastSequence = 0;
+    bool ordered = true;
+    bool consistent = true;
+    while (lastSequence < frameAmount)
+    {
+        if (!buffer.acquire())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        acquired++;
+        const Frame& frame = buffer.getReadBuffer();
+        ordered = ordered && frame.sequence > lastSequence;
+        for (const int value : frame.payload)
+            consistent = consistent && value == frame.sequence;
+        lastSequence = frame.sequence;
+    }
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(consistent);
+    // Every frame is either rendered or replaced by a newer one
+    REQUIRE(acquired + dropped == frameAmount);
+}